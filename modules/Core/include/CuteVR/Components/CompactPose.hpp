@@ -0,0 +1,96 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_COMPONENTS_COMPACT_POSE
+#define CUTE_VR_COMPONENTS_COMPACT_POSE
+
+#include <type_traits>
+#include <QtGui/QQuaternion>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Components/Pose.hpp>
+
+namespace CuteVR { namespace Components {
+    /// @brief A CompactPose holds the same spatial information as a Pose, but as plain old data.
+    /// @details It is trivially copyable and every vector starts on a 16 byte boundary, which makes it cheap to pass
+    /// through callbacks, containers and queued signals and convenient to interpolate. Unlike a Pose, it does not carry
+    /// any accelerations, since these are derived from consecutive velocities by the receiver.
+    struct alignas(16) CompactPose {
+        /// @brief Bits of CompactPose::flags.
+        enum Flag :
+                quint8 {
+            isValid = 0x01, ///< The pose is known to be valid.
+            isInvalid = 0x02, ///< The pose is known to be invalid, the validity is unknown if neither bit is set.
+            hasLinearVelocity = 0x04, ///< CompactPose::linearVelocity is provided.
+            hasAngularVelocity = 0x08 ///< CompactPose::angularVelocity is provided.
+        };
+
+        /// @brief Position in the world coordinate system, in meters.
+        QVector3D position{};
+        /// @brief Combination of CompactPose::Flag bits.
+        quint8 flags{};
+        /// @brief Orientation in the world coordinate system as unit quaternion.
+        QQuaternion orientation{};
+        /// @brief Linear velocity in meters per second, only meaningful if CompactPose::hasLinearVelocity is set.
+        alignas(16) QVector3D linearVelocity{};
+        /// @brief Angular velocity in radians per second, only meaningful if CompactPose::hasAngularVelocity is set.
+        alignas(16) QVector3D angularVelocity{};
+
+        /// @return Validity of the pose as used by Pose::valid.
+        Extension::Trilean valid() const noexcept {
+            return (flags & isValid) ? Extension::yes : (flags & isInvalid) ? Extension::no : Extension::maybe;
+        }
+
+        /// @brief Converts the given pose, whereby its accelerations are dropped.
+        static CompactPose fromPose(Pose const &pose) {
+            CompactPose compact{};
+            compact.position = pose.poseTransform.column(3).toVector3D();
+            compact.orientation = QQuaternion::fromRotationMatrix(pose.poseTransform.toGenericMatrix<3, 3>());
+            compact.flags = pose.valid == Extension::yes ? isValid : pose.valid == Extension::no ? isInvalid : 0;
+            if (pose.linearVelocity.hasValue()) {
+                compact.linearVelocity = pose.linearVelocity.value();
+                compact.flags |= hasLinearVelocity;
+            }
+            if (pose.angularVelocity.hasValue()) {
+                compact.angularVelocity = pose.angularVelocity.value();
+                compact.flags |= hasAngularVelocity;
+            }
+            return compact;
+        }
+
+        /// @brief Converts this pose, whereby the accelerations of the result are not set.
+        Pose toPose() const {
+            Pose pose{};
+            pose.valid = valid();
+            pose.poseTransform = QMatrix4x4{orientation.toRotationMatrix()};
+            pose.poseTransform.setColumn(3, QVector4D{position, 1.0f});
+            if (flags & hasLinearVelocity) {
+                pose.linearVelocity.setValue(linearVelocity);
+            }
+            if (flags & hasAngularVelocity) {
+                pose.angularVelocity.setValue(angularVelocity);
+            }
+            return pose;
+        }
+    };
+
+    /// @return `true` if both poses hold the same values.
+    inline bool operator==(CompactPose const &left, CompactPose const &right) noexcept {
+        return left.flags == right.flags && left.position == right.position && left.orientation == right.orientation &&
+               left.linearVelocity == right.linearVelocity && left.angularVelocity == right.angularVelocity;
+    }
+
+    /// @return `true` if the poses differ in any value.
+    inline bool operator!=(CompactPose const &left, CompactPose const &right) noexcept {
+        return !(left == right);
+    }
+
+    static_assert(std::is_trivially_copyable<CompactPose>::value, "A compact pose must be trivially copyable.");
+    static_assert(sizeof(CompactPose) == 64, "A compact pose must fill exactly one cache line.");
+}}
+
+Q_DECLARE_METATYPE(CuteVR::Components::CompactPose)
+
+#endif // CUTE_VR_COMPONENTS_COMPACT_POSE
@@ -6,13 +6,52 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_CONE
 #define CUTE_VR_COMPONENTS_GEOMETRY_CONE
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
-    /// @brief This class is currently only a placeholder.
-    struct Cone :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+    /// @brief A Cone is defined by the radius of its base and its height.
+    /// @details The origin of the cone is set to (0, 0, 0) respectively its mass center, while its axis is the
+    /// y-axis, the center of its base is at (0, -h/4, 0) and its apex at (0, 3h/4, 0).
+    struct Cone final :
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
+    Q_GADGET
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief The radius of the base of the cone in meters.
+        Q_PROPERTY(qreal r MEMBER r FINAL)
+        /// @brief The height of the cone along the y-axis in meters.
+        Q_PROPERTY(qreal h MEMBER h FINAL)
+
+    public: // destructor
+        ~Cone() override = default;
+
+    public: // methods
+        QSharedPointer<Cloneable> clone() const override;
+
+        bool equals(Component const &other) const noexcept override;
+
+        QDataStream &serialize(QDataStream &stream) const override;
+
+        QDataStream &deserialize(QDataStream &stream) override;
+
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
+    public: // variables
+        qreal r{0.0};
+        qreal h{0.0};
     };
 }}}
 
+Q_DECLARE_METATYPE(CuteVR::Components::Geometry::Cone)
+
 #endif // CUTE_VR_COMPONENTS_GEOMETRY_CONE
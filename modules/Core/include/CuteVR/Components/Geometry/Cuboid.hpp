@@ -6,6 +6,7 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_CUBOID
 #define CUTE_VR_COMPONENTS_GEOMETRY_CUBOID
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
@@ -13,7 +14,8 @@ namespace CuteVR { namespace Components { namespace Geometry {
     /// @details The origin of the cuboid is set to (0, 0, 0) respectively its mass center, while it is aligned with
     /// the axes, and the upper right rear corner is at (a/2, b/2, c/2).
     struct Cuboid final :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
     Q_GADGET
         Q_CLASSINFO("author", "Marcus Meeßen")
         Q_CLASSINFO("package", "CuteVR")
@@ -38,6 +40,14 @@ namespace CuteVR { namespace Components { namespace Geometry {
 
         QDataStream &deserialize(QDataStream &stream) override;
 
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
     public: // variables
         qreal a{0.0};
         qreal b{0.0};
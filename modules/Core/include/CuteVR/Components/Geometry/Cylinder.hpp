@@ -6,13 +6,52 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_CYLINDER
 #define CUTE_VR_COMPONENTS_GEOMETRY_CYLINDER
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
-    /// @brief This class is currently only a placeholder.
-    struct Cylinder :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+    /// @brief A Cylinder is defined by its radius and its height.
+    /// @details The origin of the cylinder is set to (0, 0, 0) respectively its mass center, while its axis is the
+    /// y-axis, and the centers of its bottom and top are at (0, -h/2, 0) and (0, h/2, 0).
+    struct Cylinder final :
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
+    Q_GADGET
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief The radius of the cylinder in meters.
+        Q_PROPERTY(qreal r MEMBER r FINAL)
+        /// @brief The height of the cylinder along the y-axis in meters.
+        Q_PROPERTY(qreal h MEMBER h FINAL)
+
+    public: // destructor
+        ~Cylinder() override = default;
+
+    public: // methods
+        QSharedPointer<Cloneable> clone() const override;
+
+        bool equals(Component const &other) const noexcept override;
+
+        QDataStream &serialize(QDataStream &stream) const override;
+
+        QDataStream &deserialize(QDataStream &stream) override;
+
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
+    public: // variables
+        qreal r{0.0};
+        qreal h{0.0};
     };
 }}}
 
+Q_DECLARE_METATYPE(CuteVR::Components::Geometry::Cylinder)
+
 #endif // CUTE_VR_COMPONENTS_GEOMETRY_CYLINDER
@@ -6,13 +6,58 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_ELLIPSOID
 #define CUTE_VR_COMPONENTS_GEOMETRY_ELLIPSOID
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
-    /// @brief This class is currently only a placeholder.
-    struct Ellipsoid :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+    /// @brief An Ellipsoid is defined by its three semi-axes.
+    /// @details The origin of the ellipsoid is set to (0, 0, 0) respectively its center, while its semi-axes are
+    /// aligned with the axes, so that the points (a, 0, 0), (0, b, 0) and (0, 0, c) lie on its surface.
+    struct Ellipsoid final :
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
+    Q_GADGET
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief The semi-axis of the ellipsoid along the x-axis in meters.
+        Q_PROPERTY(qreal a MEMBER a FINAL)
+        /// @brief The semi-axis of the ellipsoid along the y-axis in meters.
+        Q_PROPERTY(qreal b MEMBER b FINAL)
+        /// @brief The semi-axis of the ellipsoid along the z-axis in meters.
+        Q_PROPERTY(qreal c MEMBER c FINAL)
+
+    public: // destructor
+        ~Ellipsoid() override = default;
+
+    public: // methods
+        QSharedPointer<Cloneable> clone() const override;
+
+        bool equals(Component const &other) const noexcept override;
+
+        QDataStream &serialize(QDataStream &stream) const override;
+
+        QDataStream &deserialize(QDataStream &stream) override;
+
+        /// @details The distance to an ellipsoid has no closed form, so it is approximated in a way that is exact for
+        /// spheres and keeps the sign exact everywhere. An ellipsoid with a vanishing semi-axis encloses no volume and
+        /// is infinitely far away.
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
+    public: // variables
+        qreal a{0.0};
+        qreal b{0.0};
+        qreal c{0.0};
     };
 }}}
 
+Q_DECLARE_METATYPE(CuteVR::Components::Geometry::Ellipsoid)
+
 #endif // CUTE_VR_COMPONENTS_GEOMETRY_ELLIPSOID
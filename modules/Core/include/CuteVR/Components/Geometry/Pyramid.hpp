@@ -6,13 +6,55 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_PYRAMID
 #define CUTE_VR_COMPONENTS_GEOMETRY_PYRAMID
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
-    /// @brief This class is currently only a placeholder.
-    struct Pyramid :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+    /// @brief A Pyramid is defined by the two edge lengths of its rectangular base and its height.
+    /// @details The origin of the pyramid is set to (0, 0, 0) respectively its mass center, while its base is aligned
+    /// with the axes, the center of its base is at (0, -b/4, 0) and its apex at (0, 3b/4, 0).
+    struct Pyramid final :
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
+    Q_GADGET
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief One edge length of the base in meters, by our convention a is the width along the x-axis.
+        Q_PROPERTY(qreal a MEMBER a FINAL)
+        /// @brief The height of the pyramid in meters, by our convention b is along the y-axis.
+        Q_PROPERTY(qreal b MEMBER b FINAL)
+        /// @brief One edge length of the base in meters, by our convention c is the depth along the z-axis.
+        Q_PROPERTY(qreal c MEMBER c FINAL)
+
+    public: // destructor
+        ~Pyramid() override = default;
+
+    public: // methods
+        QSharedPointer<Cloneable> clone() const override;
+
+        bool equals(Component const &other) const noexcept override;
+
+        QDataStream &serialize(QDataStream &stream) const override;
+
+        QDataStream &deserialize(QDataStream &stream) override;
+
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
+    public: // variables
+        qreal a{0.0};
+        qreal b{0.0};
+        qreal c{0.0};
     };
 }}}
 
+Q_DECLARE_METATYPE(CuteVR::Components::Geometry::Pyramid)
+
 #endif // CUTE_VR_COMPONENTS_GEOMETRY_PYRAMID
@@ -6,13 +6,15 @@
 #ifndef CUTE_VR_COMPONENTS_GEOMETRY_SPHERE
 #define CUTE_VR_COMPONENTS_GEOMETRY_SPHERE
 
+#include <CuteVR/Interface/Volumetric.hpp>
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Geometry {
     /// @brief A Sphere is defined by its radius.
     /// @details The origin of the sphere is set to (0, 0, 0) respectively its center.
     struct Sphere final :
-            public CategorizedComponent<Component::Category::geometry, Component> {
+            public CategorizedComponent<Component::Category::geometry, Component>,
+            public Interface::Volumetric {
     Q_GADGET
         Q_CLASSINFO("author", "Marcus Meeßen")
         Q_CLASSINFO("package", "CuteVR")
@@ -33,6 +35,14 @@ namespace CuteVR { namespace Components { namespace Geometry {
 
         QDataStream &deserialize(QDataStream &stream) override;
 
+        qreal distance(QVector3D const &point) const noexcept override;
+
+        bool contains(QVector3D const &point) const noexcept override;
+
+        qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept override;
+
+        QPair<QVector3D, QVector3D> bounds() const noexcept override;
+
     public: // variables
         qreal r{0.0};
     };
@@ -0,0 +1,46 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_COMPONENTS_INTERACTION_EYE_MATRICES
+#define CUTE_VR_COMPONENTS_INTERACTION_EYE_MATRICES
+
+#include <QtGui/QMatrix4x4>
+
+namespace CuteVR { namespace Components { namespace Interaction {
+    /// @brief The render matrices of an Eye for one tracking frame, including their inverses.
+    /// @details The view matrix maps from the world into the eye, hence it is the inverse of the head pose combined
+    /// with Eye::headTransform. The projection is the same as Eye::perspectiveProjection.
+    struct EyeMatrices {
+        /// @brief Maps world coordinates into eye coordinates.
+        QMatrix4x4 view{};
+        /// @brief Maps eye coordinates into clip coordinates.
+        QMatrix4x4 projection{};
+        /// @brief Maps world coordinates into clip coordinates, equals `projection * view`.
+        QMatrix4x4 viewProjection{};
+        /// @brief Maps eye coordinates into world coordinates.
+        QMatrix4x4 inverseView{};
+        /// @brief Maps clip coordinates into eye coordinates.
+        QMatrix4x4 inverseProjection{};
+        /// @brief Maps clip coordinates into world coordinates, e.g. to cast rays through pixels.
+        QMatrix4x4 inverseViewProjection{};
+    };
+
+    /// @return `true` if all matrices are the same.
+    inline bool operator==(EyeMatrices const &left, EyeMatrices const &right) noexcept {
+        return left.view == right.view && left.projection == right.projection &&
+               left.viewProjection == right.viewProjection && left.inverseView == right.inverseView &&
+               left.inverseProjection == right.inverseProjection &&
+               left.inverseViewProjection == right.inverseViewProjection;
+    }
+
+    /// @return `true` if any matrix differs.
+    inline bool operator!=(EyeMatrices const &left, EyeMatrices const &right) noexcept {
+        return !(left == right);
+    }
+}}}
+
+Q_DECLARE_METATYPE(CuteVR::Components::Interaction::EyeMatrices)
+
+#endif // CUTE_VR_COMPONENTS_INTERACTION_EYE_MATRICES
@@ -0,0 +1,67 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_COMPONENTS_OUTPUT_DISTORTION_MESH
+#define CUTE_VR_COMPONENTS_OUTPUT_DISTORTION_MESH
+
+#include <type_traits>
+#include <QtCore/QDataStream>
+#include <QtCore/QSize>
+#include <QtCore/QVector>
+#include <QtGui/QVector2D>
+
+namespace CuteVR { namespace Components { namespace Output {
+    /// @brief A regular grid that maps the display of an eye to the texture coordinates of the rendered image, so that
+    /// the lens distortion and the chromatic aberration are compensated.
+    /// @details The vertices are stored row by row and the indices form a triangle list, so that both buffers can be
+    /// uploaded to the graphics card as they are.
+    struct DistortionMesh {
+        /// @brief Interleaved vertex of the mesh, which is plain old data of 32 bytes.
+        struct Vertex {
+            /// @brief Position on the display, where both coordinates are within `[0, 1]`.
+            QVector2D position{};
+            /// @brief Texture coordinates for the red channel.
+            QVector2D red{};
+            /// @brief Texture coordinates for the green channel.
+            QVector2D green{};
+            /// @brief Texture coordinates for the blue channel.
+            QVector2D blue{};
+        };
+
+        /// @brief The number of vertices per row and per column.
+        QSize resolution{};
+        /// @brief All `resolution.width() * resolution.height()` vertices.
+        QVector<Vertex> vertices{};
+        /// @brief Two counter-clockwise triangles per cell of the grid.
+        QVector<quint16> indices{};
+
+        /// @return `true` if the mesh has not been generated.
+        bool isEmpty() const noexcept {
+            return vertices.isEmpty();
+        }
+    };
+
+    static_assert(std::is_trivially_copyable<DistortionMesh::Vertex>::value,
+                  "A distortion vertex must be trivially copyable.");
+    static_assert(sizeof(DistortionMesh::Vertex) == 32, "A distortion vertex must consist of eight floats.");
+
+    /// @return `true` if both meshes hold the same vertices and indices.
+    bool operator==(DistortionMesh const &left, DistortionMesh const &right) noexcept;
+
+    /// @return `true` if the meshes differ in any vertex or index.
+    inline bool operator!=(DistortionMesh const &left, DistortionMesh const &right) noexcept {
+        return !(left == right);
+    }
+
+    /// @ostream{distortion mesh}
+    QDataStream &operator<<(QDataStream &stream, DistortionMesh const &mesh);
+
+    /// @istream{distortion mesh}
+    QDataStream &operator>>(QDataStream &stream, DistortionMesh &mesh);
+}}}
+
+Q_DECLARE_METATYPE(CuteVR::Components::Output::DistortionMesh)
+
+#endif // CUTE_VR_COMPONENTS_OUTPUT_DISTORTION_MESH
@@ -9,10 +9,38 @@
 #include <CuteVR/Component.hpp>
 
 namespace CuteVR { namespace Components { namespace Output {
-    /// @brief This class is currently only a placeholder.
-    struct Haptic :
+    /// @brief A Haptic actuator that vibrates in short pulses, of which a sequence forms an amplitude envelope.
+    struct Haptic final :
             public CategorizedComponent<Component::Category::output, Component> {
+    Q_GADGET
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief The minimum time in seconds between the start of two pulses.
+        /// @details Each amplitude of an envelope is played for exactly this time.
+        Q_PROPERTY(qreal interval MEMBER interval FINAL)
+        /// @brief The maximum duration of a single pulse in seconds, which is reached at full amplitude.
+        Q_PROPERTY(qreal duration MEMBER duration FINAL)
+
+    public: // destructor
+        ~Haptic() override = default;
+
+    public: // methods
+        QSharedPointer<Cloneable> clone() const override;
+
+        bool equals(Component const &other) const noexcept override;
+
+        QDataStream &serialize(QDataStream &stream) const override;
+
+        QDataStream &deserialize(QDataStream &stream) override;
+
+    public: // variables
+        qreal interval{0.0};
+        qreal duration{0.0};
     };
 }}}
 
+Q_DECLARE_METATYPE(CuteVR::Components::Output::Haptic)
+
 #endif // CUTE_VR_COMPONENTS_OUTPUT_HAPTIC
@@ -0,0 +1,61 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_COMPONENTS_OUTPUT_HIDDEN_AREA_MESH
+#define CUTE_VR_COMPONENTS_OUTPUT_HIDDEN_AREA_MESH
+
+#include <QtCore/QDataStream>
+#include <QtCore/QVector>
+#include <QtGui/QVector2D>
+
+namespace CuteVR { namespace Components { namespace Output {
+    /// @brief The area of the display of an eye that cannot be seen through the lens, as compact vertex and index
+    /// buffers.
+    /// @details The driver delivers every triangle with its own three vertices, whereas this mesh shares equal
+    /// vertices between triangles. Rendering can be skipped for the covered pixels, e.g. by priming the depth buffer.
+    struct HiddenAreaMesh {
+        /// @brief Describes which area the mesh covers and how the indices are to be drawn.
+        enum class Type :
+                quint8 {
+            standard, ///< A triangle list that covers the hidden area.
+            inverse, ///< A triangle list that covers the visible area.
+            lineLoop, ///< A line loop along the border between the hidden and the visible area.
+        };
+
+        /// @brief The type of the mesh.
+        Type type{Type::standard};
+        /// @brief The distinct vertices on the display, where both coordinates are within `[0, 1]`.
+        QVector<QVector2D> vertices{};
+        /// @brief The triangles or the line loop, depending on the type.
+        QVector<quint16> indices{};
+
+        /// @return `true` if the head-mounted display has no hidden area or the mesh has not been queried.
+        bool isEmpty() const noexcept {
+            return indices.isEmpty();
+        }
+    };
+
+    /// @return `true` if both meshes are of the same type and hold the same vertices and indices.
+    inline bool operator==(HiddenAreaMesh const &left, HiddenAreaMesh const &right) noexcept {
+        return left.type == right.type && left.vertices == right.vertices && left.indices == right.indices;
+    }
+
+    /// @return `true` if the meshes differ in the type, any vertex or index.
+    inline bool operator!=(HiddenAreaMesh const &left, HiddenAreaMesh const &right) noexcept {
+        return !(left == right);
+    }
+
+    /// @ostream{hidden area mesh}
+    QDataStream &operator<<(QDataStream &stream, HiddenAreaMesh const &mesh);
+
+    /// @istream{hidden area mesh}
+    QDataStream &operator>>(QDataStream &stream, HiddenAreaMesh &mesh);
+}}}
+
+Q_DECLARE_METATYPE(CuteVR::Components::Output::HiddenAreaMesh)
+
+Q_DECLARE_METATYPE(CuteVR::Components::Output::HiddenAreaMesh::Type)
+
+#endif // CUTE_VR_COMPONENTS_OUTPUT_HIDDEN_AREA_MESH
@@ -30,6 +30,14 @@ namespace CuteVR { namespace Configurations {
             linearAcceleration, ///< Tracking information is enriched with data about the linear acceleration.
             angularVelocity, ///< Tracking information is enriched with data about the angular velocity.
             angularAcceleration, ///< Tracking information is enriched with data about the angular acceleration.
+            driverThread, ///< All driver calls are serialized on a single driver thread instead of being locked.
+            propertyCache, ///< Device properties are cached until the driver reports a change. Requires events.
+            changeSets, ///< Devices initialized while enabled emit one change set with all changes per poll cycle.
+            itemSignals, ///< Devices emit a signal for each changed component.
+            mapSignals, ///< Devices emit the whole map of components whenever one of them changes.
+            inputCapture, ///< Controllers record every input change with a timestamp on a sampler thread.
+            devicePool, ///< Deactivated devices are parked and revived as the same object when they reconnect.
+            nodeAggregation, ///< Remote nodes are aggregated as cells of their own with proxy devices. Requires cell.
             inhibitDeviceRegistration = ///< All devices of this module will no longer register automatically.
                     ConfigurationServer::deviceCore + 1,
             trackingReferenceGeneric, ///< Generic tracking reference implementation.
@@ -49,9 +57,26 @@ namespace CuteVR { namespace Configurations {
             driverLockWarn = ///< The time in milliseconds until the driver lock attempt generates a warning.
                     ConfigurationServer::generalCore + 1,
             driverLockAbort, ///< The time in milliseconds until the driver lock attempt throws a critical exception.
+            hotplugWindow, ///< The time in milliseconds in which device (de)activations are collected as one batch.
+            inputCaptureRate, ///< The number of controller samples per second of the input capture.
+            inputCaptureDepth, ///< The number of input records a controller buffers until they are dropped.
+            cycleBudget, ///< The time in microseconds after which a cycle defers the remaining handlers, `0` for none.
+            devicePoolDepth, ///< The number of deactivated devices that are parked until the oldest ones are dropped.
+            headMountedDisplayProfile, ///< The Device::ProviderProfile of head-mounted displays as underlying value.
+            controllerProfile, ///< The Device::ProviderProfile of controllers, by its underlying value.
+            trackerProfile, ///< The Device::ProviderProfile of trackers, by its underlying value.
+            trackingReferenceProfile, ///< The Device::ProviderProfile of tracking references, by its underlying value.
+            boundaryHeight, ///< The height in meters of the cell boundary that is derived from the play area.
+            boundaryNearDistance, ///< The distance in meters to the cell boundary below which a device is near to it.
+            equipmentWindow, ///< The number of frames over which controllers are compared to head-mounted displays.
+            equipmentHysteresis, ///< The margin in meters by which a controller must be nearer to another user.
+            equipmentPersistence, ///< The number of frames the margin must hold until a controller is reassigned.
+            nodePort, ///< The UDP port on which the aggregating system receives the frames of the nodes.
+            nodeTimeout, ///< The time in milliseconds after which a silent node is dropped together with its devices.
             zNear = ///< The minimum viewing distance of the eyes that is used in the projection matrix.
                     ConfigurationServer::renderCore + 1,
             zFar, ///< The maximum viewing distance of the eyes that is used in the projection matrix.
+            lensMeshDirectory, ///< The directory in which distortion meshes are stored, none if empty.
         };
 
         /// @ostream{core feature}
@@ -9,7 +9,9 @@
 #include <type_traits>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QPair>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QVector>
 
 #include <CuteVR/Components/Description.hpp>
 #include <CuteVR/Extension/Optional.hpp>
@@ -62,6 +64,54 @@ namespace CuteVR {
 
         Q_ENUM(Category)
 
+        /// @brief Selects the components a device provides, which saves initialization time, memory and handlers.
+        /// @details The profile is configured per category, see Configurations::Core::Parameter::controllerProfile and
+        /// its neighbors. Pose and availability are provided in every profile.
+        enum class ProviderProfile :
+                quint8 {
+            full, ///< All components are provided.
+            trackingOnly, ///< Only the pose and the availability are provided.
+            inputOnly, ///< Additionally to tracking, axes, buttons and hands of controllers are provided.
+        };
+
+        Q_ENUM(ProviderProfile)
+
+        /// @brief Summarizes the components of a device that changed within one poll cycle.
+        /// @details Change sets are only collected while Configurations::Core::Feature::changeSets is enabled, see
+        /// #changed.
+        struct ChangeSet {
+            /// @brief Marks the component members of a device that contain at least one change.
+            enum class Member :
+                    quint32 {
+                none = 0, ///< Nothing has changed.
+                descriptions = 1u << 0, ///< Device::descriptions has changed.
+                availability = 1u << 1, ///< Devices::TrackedDevice::availability has changed.
+                pose = 1u << 2, ///< Devices::TrackedDevice::pose has changed.
+                axes = 1u << 3, ///< Devices::Controller::Generic::axes has changed.
+                buttons = 1u << 4, ///< Devices::Controller::Generic::buttons has changed.
+                hands = 1u << 5, ///< Devices::Controller::Generic::hands has changed.
+                eyes = 1u << 6, ///< Devices::HeadMountedDisplay::Generic::eyes has changed.
+                displays = 1u << 7, ///< Devices::HeadMountedDisplay::Generic::displays has changed.
+                haptics = 1u << 8, ///< Devices::Controller::Generic::haptics has changed.
+                batteries = 1u << 9, ///< Devices::TrackedDevice::batteries has changed.
+                user = 1u << 16, ///< User-defined members start with this flag.
+            };
+
+            quint32 dirty{0}; ///< Bitwise combination of the members that have changed.
+            QVector<QPair<Component::Category, Identifier>> components{}; ///< Changed components, each listed once.
+
+            /// @return `true` if nothing has changed.
+            bool isEmpty() const noexcept {
+                return dirty == 0;
+            }
+
+            /// @param member The member to test on.
+            /// @return `true` if the given member has changed.
+            bool contains(Member const member) const noexcept {
+                return (dirty & static_cast<quint32>(member)) != 0;
+            }
+        };
+
     public: // constructor/destructor
         /// @brief Create a new device object which has the given identifier for its whole lifetime.
         /// @param identifier The identifier of the device.
@@ -77,6 +127,11 @@ namespace CuteVR {
         /// @return The identifier of a description that is of the given type or nothing.
         Extension::Optional<Identifier> description(Components::Description::Type type) const noexcept;
 
+        /// @brief Query the provider profile that is configured for the category of the device.
+        /// @details The profile is evaluated whenever the device is initialized.
+        /// @return The configured profile, or ProviderProfile::full if the category cannot be configured.
+        ProviderProfile providerProfile() const noexcept;
+
     public: // methods
         /// @brief Queries the category of the device.
         /// @return The category of the device or undefined.
@@ -106,6 +161,14 @@ namespace CuteVR {
         CuteVR::Identifier const identifier{};
         QMap<CuteVR::Identifier, CuteVR::Components::Description> descriptions{};
 
+    protected: // methods
+        /// @brief Records a changed component, which is published with the next change set.
+        /// @details Does nothing if Configurations::Core::Feature::changeSets is disabled. Thread-safe.
+        /// @param member The member of the device that contains the component.
+        /// @param category The category of the changed component.
+        /// @param component The identifier of the changed component.
+        void recordChange(ChangeSet::Member member, Component::Category category, Identifier component);
+
     private: // types
         class Private;
 
@@ -118,6 +181,13 @@ namespace CuteVR {
 
         /// @signal{individual description}
         void descriptionChanged(CuteVR::Identifier, CuteVR::Components::Description);
+
+        /// @brief Is emitted at most once per poll cycle of the DriverServer with all components that have changed
+        /// since the last emission.
+        /// @details Requires Configurations::Core::Feature::changeSets, which is enabled by default. The map and item
+        /// signals are disabled by default, they can be enabled independently with
+        /// Configurations::Core::Feature::mapSignals and Configurations::Core::Feature::itemSignals.
+        void changed(CuteVR::Device::ChangeSet);
     };
 
     /// @brief Adds a categorized hierarchy layer to a Device to enable polymorphism within a specific domain.
@@ -162,6 +232,8 @@ namespace CuteVR {
 
 Q_DECLARE_METATYPE(CuteVR::Device::Category)
 
+Q_DECLARE_METATYPE(CuteVR::Device::ChangeSet)
+
 Q_DECLARE_METATYPE(QSharedPointer<CuteVR::Device>)
 
 #endif // CUTE_VR_DEVICE
@@ -45,11 +45,30 @@ namespace CuteVR {
         static DeviceServer &instance() noexcept;
 
         /// @brief Create a new device with the given identifier.
+        /// @details The factories that are suitable for a hardware model are resolved once per device class,
+        /// manufacturer, tracking system, and hardware revision, repeated activations of the same model only try the
+        /// resolved factories. Registering a device discards all resolutions.
         /// @param identifier The identifier for the device.
         /// @return The newly created devices, or DeviceNotRegistered, DeviceNotSupported, or DeviceValidationFailed.
         static Extension::Either<QSharedPointer<Extension::CuteException>, QSharedPointer<Device>>
         create(Identifier identifier);
 
+        /// @brief Loads the properties that are needed to create the given devices and to set up their default
+        /// providers within a single DriverServer::Batch.
+        /// @details The properties end up in the property cache, so that a following #create and the initialization of
+        /// the devices hardly need to enter a synchronized scope anymore. Nothing happens if the cache is disabled,
+        /// see Configurations::Core::Feature::propertyCache.
+        /// @param identifiers The identifiers of the devices that are about to be created.
+        static void prefetch(QList<Identifier> const &identifiers);
+
+        /// @brief Reads the manifests of all device plugins in the given directory without loading them.
+        /// @details A plugin is loaded by #create as soon as a device appears whose specific or generic signature is
+        /// listed in the manifest of the plugin, see Interface::DevicePlugin. Thus, only hardware that is actually
+        /// present costs startup time and memory.
+        /// @param directory The directory that is searched for plugins, subdirectories are not searched.
+        /// @return The number of plugins that were found, plugins that were discovered before are not counted again.
+        static qint32 discover(QString const &directory);
+
         /// @brief Part of an automatic registration process which is mainly relevant to device class developers.
         /// @note [tl;dr] Some magic happens here, one does not really have to understand it. Only relevant to device
         /// class developers.
@@ -6,9 +6,12 @@
 #ifndef CUTE_VR_GENERIC_CONTROLLER
 #define CUTE_VR_GENERIC_CONTROLLER
 
+#include <QtCore/QVector>
+
 #include <CuteVR/Components/Input/Axis.hpp>
 #include <CuteVR/Components/Input/Button.hpp>
 #include <CuteVR/Components/Interaction/Hand.hpp>
+#include <CuteVR/Components/Output/Haptic.hpp>
 #include <CuteVR/Devices/TrackedDevice.hpp>
 
 namespace CuteVR { namespace Devices { namespace Controller {
@@ -34,6 +37,28 @@ namespace CuteVR { namespace Devices { namespace Controller {
         /// @details There is an additional signal which only emits the actually changed button.
         Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Input::Button>) buttons
                    MEMBER buttons NOTIFY buttonsChanged FINAL)
+        /// @brief A map of all the haptics that can vibrate this controller.
+        /// @details There is an additional signal which only emits the actually changed haptic. Use #vibrate to play
+        /// an amplitude envelope on a haptic.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Output::Haptic>) haptics
+                   MEMBER haptics NOTIFY hapticsChanged FINAL)
+
+    public: // types
+        /// @brief A compact, timestamped change of a single input, as recorded by the input capture stream.
+        struct InputRecord {
+            /// @brief Describes which kind of input has changed.
+            enum class Kind :
+                    quint8 {
+                axis, ///< The value is the new position of the axis.
+                press, ///< The value is `1` if the button has been pressed and `0` if it has been released.
+                touch, ///< The value is `1` if the button has been touched and `0` if it has been untouched.
+            };
+
+            qint64 timestamp{0}; ///< Time of the sample in nanoseconds of the monotonic steady clock.
+            float value{0.0f}; ///< The new value of the input, see #Kind.
+            quint16 identifier{0}; ///< The identifier of the axis or button, as used in #axes and #buttons.
+            Kind kind{Kind::axis}; ///< The kind of input that has changed.
+        };
 
     public: // constructor/destructor
         explicit Generic(Identifier identifier);
@@ -48,6 +73,9 @@ namespace CuteVR { namespace Devices { namespace Controller {
         /// @return The identifier of a hand that is of the given type or nothing.
         Extension::Optional<Identifier> hand(Components::Interaction::Hand::Type type) const noexcept;
 
+        /// @return The number of input records that have been dropped because the capture stream was full.
+        quint64 droppedInput() const noexcept;
+
     public: // methods
         void destroy() override;
 
@@ -61,10 +89,30 @@ namespace CuteVR { namespace Devices { namespace Controller {
 
         bool isCurrent() const noexcept override;
 
+        /// @brief Moves the captured input records into the given vector.
+        /// @details Records are only captured if Configurations::Core::Feature::inputCapture was enabled at the
+        /// initialization of this controller. The rate and the depth of the stream are taken from
+        /// Configurations::Core::Parameter::inputCaptureRate and Configurations::Core::Parameter::inputCaptureDepth.
+        /// Only one thread at a time may drain the stream.
+        /// @param records The vector to which the records are appended in chronological order.
+        /// @param maximum The maximum number of records to take, or all if negative.
+        /// @return The number of records taken.
+        qint32 drainInput(QVector<InputRecord> &records, qint32 maximum = -1);
+
+        /// @brief Plays an amplitude envelope on a haptic without blocking the caller.
+        /// @details All envelopes are played by one scheduler thread. Envelopes that overlap on the same haptic are
+        /// merged by playing the highest amplitude of each interval.
+        /// @param haptic The identifier of the haptic, as used in #haptics.
+        /// @param envelope The amplitudes between `0` and `1`, each played for one
+        /// Components::Output::Haptic::interval.
+        /// @return `false` if the haptic is unknown, the controller is not initialized or the request has been dropped.
+        bool vibrate(Identifier haptic, QVector<qreal> const &envelope);
+
     public: // variables
         QMap<CuteVR::Identifier, CuteVR::Components::Interaction::Hand> hands{};
         QMap<CuteVR::Identifier, CuteVR::Components::Input::Axis> axes{};
         QMap<CuteVR::Identifier, CuteVR::Components::Input::Button> buttons{};
+        QMap<CuteVR::Identifier, CuteVR::Components::Output::Haptic> haptics{};
 
     private: // types
         class Private;
@@ -90,6 +138,12 @@ namespace CuteVR { namespace Devices { namespace Controller {
 
         /// @signal{individual button}
         void buttonChanged(CuteVR::Identifier, CuteVR::Components::Input::Button);
+
+        /// @signal{map of haptics}
+        void hapticsChanged(QMap<CuteVR::Identifier, CuteVR::Components::Output::Haptic>);
+
+        /// @signal{individual haptic}
+        void hapticChanged(CuteVR::Identifier, CuteVR::Components::Output::Haptic);
     };
 }}}
 
@@ -7,7 +7,10 @@
 #define CUTE_VR_DEVICES_HEAD_MOUNTED_DISPLAY_GENERIC
 
 #include <CuteVR/Components/Interaction/Eye.hpp>
+#include <CuteVR/Components/Interaction/EyeMatrices.hpp>
+#include <CuteVR/Components/Output/DistortionMesh.hpp>
 #include <CuteVR/Components/Output/Display.hpp>
+#include <CuteVR/Components/Output/HiddenAreaMesh.hpp>
 #include <CuteVR/Devices/TrackedDevice.hpp>
 
 namespace CuteVR { namespace Devices { namespace HeadMountedDisplay {
@@ -25,6 +28,11 @@ namespace CuteVR { namespace Devices { namespace HeadMountedDisplay {
         /// use the #eye getter.
         Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Interaction::Eye>) eyes
                    MEMBER eyes NOTIFY eyesChanged FINAL)
+        /// @brief The view and projection matrices of each eye for the current pose, including their inverses.
+        /// @details The map uses the same identifiers as #eyes. The matrices are computed at most once per #update and
+        /// only if the pose or an eye has changed, so they change exactly if the pose or the eyes do.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Interaction::EyeMatrices>) eyeMatrices
+                   MEMBER eyeMatrices NOTIFY eyeMatricesChanged FINAL)
         /// @brief A map of all displays that constitute this controller.
         /// @details There is an additional signal which only emits the actually changed display.
         Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Output::Display>) displays
@@ -43,6 +51,29 @@ namespace CuteVR { namespace Devices { namespace HeadMountedDisplay {
         /// @return The identifier of an eye that is of the given type or nothing.
         Extension::Optional<Identifier> eye(Components::Interaction::Eye::Type type) const noexcept;
 
+        /// @brief Query the mesh that compensates the lens distortion of an eye.
+        /// @details The mesh is generated once per resolution and interpupillary distance and cached afterwards, also
+        /// on disk if Configurations::Core::Parameter::lensMeshDirectory is set.
+        /// @param type The type the eye must have.
+        /// @param resolution The number of vertices per row and column, which is bounded to `[2, 256]`.
+        /// @return The mesh, which is empty if there is no such eye or the driver cannot compute the distortion.
+        Components::Output::DistortionMesh
+        distortionMesh(Components::Interaction::Eye::Type type, QSize resolution) const;
+
+        /// @brief Query the distortion meshes of all eyes, whereby missing meshes are generated in parallel.
+        /// @param resolution The number of vertices per row and column, see #distortionMesh.
+        /// @return The meshes by the identifiers of the eyes, see #eyes.
+        QMap<Identifier, Components::Output::DistortionMesh> distortionMeshes(QSize resolution) const;
+
+        /// @brief Query the area of the display of an eye that cannot be seen through the lens.
+        /// @param type The type the eye must have.
+        /// @param meshType The type of the mesh.
+        /// @return The mesh, which is empty if there is no such eye or no hidden area.
+        Components::Output::HiddenAreaMesh
+        hiddenAreaMesh(Components::Interaction::Eye::Type type,
+                       Components::Output::HiddenAreaMesh::Type meshType =
+                       Components::Output::HiddenAreaMesh::Type::standard) const;
+
     public: // methods
         void destroy() override;
 
@@ -58,6 +89,7 @@ namespace CuteVR { namespace Devices { namespace HeadMountedDisplay {
 
     public: // variables
         QMap<CuteVR::Identifier, CuteVR::Components::Interaction::Eye> eyes;
+        QMap<CuteVR::Identifier, CuteVR::Components::Interaction::EyeMatrices> eyeMatrices;
         QMap<CuteVR::Identifier, CuteVR::Components::Output::Display> displays;
 
     private: // types
@@ -73,6 +105,9 @@ namespace CuteVR { namespace Devices { namespace HeadMountedDisplay {
         /// @signal{individual eye}
         void eyeChanged(CuteVR::Identifier, CuteVR::Components::Interaction::Eye);
 
+        /// @signal{map of eye matrices}
+        void eyeMatricesChanged(QMap<CuteVR::Identifier, CuteVR::Components::Interaction::EyeMatrices>);
+
         /// @signal{map of displays}
         void displaysChanged(QMap<CuteVR::Identifier, CuteVR::Components::Output::Display>);
 
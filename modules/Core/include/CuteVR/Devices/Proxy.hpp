@@ -0,0 +1,85 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_DEVICES_PROXY
+#define CUTE_VR_DEVICES_PROXY
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Components/Pose.hpp>
+#include <CuteVR/Device.hpp>
+
+namespace CuteVR { namespace Devices {
+    /// @brief A Proxy stands in for a device that is connected to a remote node.
+    /// @details The system creates proxies while Configurations::Core::Feature::nodeAggregation is enabled, one for
+    /// every device that a node publishes. A proxy is not backed by the local driver, it only mirrors the category and
+    /// the pose that the node reports, whereby the pose is given in the coordinate system of the cell of the node.
+    class Proxy final :
+            public Device {
+    Q_OBJECT
+        Q_CLASSINFO("author", "Marcus Meeßen")
+        Q_CLASSINFO("package", "CuteVR")
+        Q_CLASSINFO("module", "Core")
+        Q_CLASSINFO("revision", "a")
+        /// @brief The node to which the device is connected.
+        Q_PROPERTY(CuteVR::Identifier node MEMBER node CONSTANT FINAL)
+        /// @brief The identifier of the device on its node.
+        Q_PROPERTY(CuteVR::Identifier remote MEMBER remote CONSTANT FINAL)
+        /// @brief The pose that the node has reported last.
+        Q_PROPERTY(CuteVR::Components::Pose pose MEMBER pose NOTIFY poseChanged FINAL)
+        /// @brief The same pose as plain old data.
+        Q_PROPERTY(CuteVR::Components::CompactPose compactPose MEMBER compactPose FINAL)
+
+    public: // constructor/destructor
+        /// @param category The category of the remote device.
+        /// @param node The node to which the device is connected.
+        /// @param remote The identifier of the device on its node.
+        Proxy(Category category, Identifier node, Identifier remote);
+
+        ~Proxy() override;
+
+        Q_DISABLE_COPY(Proxy)
+
+    public: // methods
+        Category category() const noexcept override;
+
+        void destroy() override;
+
+        bool isDestroyed() const noexcept override;
+
+        void initialize() override;
+
+        bool isInitialized() const noexcept override;
+
+        /// @brief Hands over the pose that the node has reported last, which becomes visible with the next update.
+        /// Thread-safe.
+        void receive(Components::CompactPose const &pose);
+
+        void update() override;
+
+        bool isCurrent() const noexcept override;
+
+        /// @return The local identifier of a remote device, whereby every node owns a range of 2^16 identifiers.
+        static constexpr Identifier identifierOf(Identifier node, Identifier remote) noexcept {
+            return (node << 16u) | (remote & 0xffffu);
+        }
+
+    public: // variables
+        CuteVR::Identifier const node{};
+        CuteVR::Identifier const remote{};
+        CuteVR::Components::Pose pose;
+        CuteVR::Components::CompactPose compactPose{};
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+
+    signals:
+        void poseChanged(CuteVR::Components::Pose);
+    };
+}}
+
+#endif // CUTE_VR_DEVICES_PROXY
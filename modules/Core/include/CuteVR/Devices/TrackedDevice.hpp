@@ -6,7 +6,9 @@
 #ifndef CUTE_VR_DEVICES_TRACKED_DEVICE
 #define CUTE_VR_DEVICES_TRACKED_DEVICE
 
+#include <CuteVR/Components/Peripheral/Battery.hpp>
 #include <CuteVR/Components/Availability.hpp>
+#include <CuteVR/Components/CompactPose.hpp>
 #include <CuteVR/Components/Pose.hpp>
 #include <CuteVR/Device.hpp>
 
@@ -26,6 +28,14 @@ namespace CuteVR { namespace Devices {
         /// @details Information about angular and linear velocity and acceleration is only available if enabled in the
         /// configuration.
         Q_PROPERTY(CuteVR::Components::Pose pose MEMBER pose NOTIFY poseChanged FINAL)
+        /// @brief The same pose as plain old data without accelerations, which is cheap to copy and to interpolate.
+        /// @details It is updated together with the pose, so it changes whenever the pose does.
+        Q_PROPERTY(CuteVR::Components::CompactPose compactPose MEMBER compactPose FINAL)
+        /// @brief A map of all the batteries that power this tracked device.
+        /// @details The batteries are polled once per second. There is an additional signal which only emits the
+        /// actually changed battery.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::Peripheral::Battery>) batteries
+                   MEMBER batteries NOTIFY batteriesChanged FINAL)
 
     public: // constructor/destructor
         explicit TrackedDevice(Identifier identifier);
@@ -50,6 +60,8 @@ namespace CuteVR { namespace Devices {
     public: // variables
         CuteVR::Components::Availability availability;
         CuteVR::Components::Pose pose;
+        CuteVR::Components::CompactPose compactPose{};
+        QMap<CuteVR::Identifier, CuteVR::Components::Peripheral::Battery> batteries{};
 
     private: // types
         class Private;
@@ -63,6 +75,12 @@ namespace CuteVR { namespace Devices {
 
         /// @signal{pose}
         void poseChanged(CuteVR::Components::Pose);
+
+        /// @signal{map of batteries}
+        void batteriesChanged(QMap<CuteVR::Identifier, CuteVR::Components::Peripheral::Battery>);
+
+        /// @signal{individual battery}
+        void batteryChanged(CuteVR::Identifier, CuteVR::Components::Peripheral::Battery);
     };
 }}
 
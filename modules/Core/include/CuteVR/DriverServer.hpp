@@ -7,9 +7,13 @@
 #define CUTE_VR_DRIVER_SERVER
 
 #include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
 #include <QtCore/QList>
 #include <QtCore/QSet>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
 
 #include <CuteVR/Extension/CuteException.hpp>
 #include <CuteVR/Extension/Optional.hpp>
@@ -40,6 +44,81 @@ namespace CuteVR {
             quint32 const current{0x00080000}; ///< 1 byte "major", 1 byte "minor", 2 byte "patch"
         };
 
+        /// @brief A batch of driver calls that are executed together within a single synchronized scope.
+        /// @details Every #synchronized scope acquires the driver lock and checks the initialization state, which adds
+        /// up when e.g. dozens of properties are queried while a device is created. A batch pays this only once per
+        /// #execute. The calls are executed in submission order and must not submit further calls to the same batch.
+        class Batch final {
+        public: // constructor/destructor
+            Batch() = default;
+
+            ~Batch() = default;
+
+            Q_DISABLE_COPY(Batch)
+
+        public: // getter
+            /// @return `true` if no call has been submitted since the last execution.
+            bool isEmpty() const noexcept {
+                return calls.isEmpty();
+            }
+
+            /// @return The number of calls that have been submitted since the last execution.
+            int size() const noexcept {
+                return calls.size();
+            }
+
+        public: // methods
+            /// @brief Adds a call whose effects, e.g. values written to captured references, are available as soon as
+            /// the batch has been executed.
+            /// @param call The call to be executed.
+            void submit(std::function<void(void)> call) {
+                calls.append(std::move(call));
+            }
+
+            /// @brief Adds a call whose result is delivered with a future.
+            /// @param functor The call to be executed, it must be copyable.
+            /// @return A future that is ready after the execution and holds either the result or the exception of the
+            /// call. The promise is broken if the batch is destroyed without being executed.
+            template<class FunctorT>
+            std::future<typename std::result_of<FunctorT(void)>::type> request(FunctorT functor) {
+                using ResultT = typename std::result_of<FunctorT(void)>::type;
+                auto promise{std::make_shared<std::promise<ResultT>>()};
+                auto future{promise->get_future()};
+                calls.append([promise, functor] {
+                    try {
+                        Fulfil<ResultT>::with(*promise, functor);
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+                return future;
+            }
+
+        private: // types
+            template<class ResultT>
+            struct Fulfil {
+                template<class FunctorT>
+                static void with(std::promise<ResultT> &promise, FunctorT const &functor) {
+                    promise.set_value(functor());
+                }
+            };
+
+        private: // variables
+            friend class DriverServer;
+
+            QVector<std::function<void(void)>> calls{};
+        };
+
+        /// @brief Describes when a cyclic handler is due within #runCycle.
+        /// @details Handlers without a period are called on every cycle, the others at most once per period. All due
+        /// handlers of a cycle are called in the order of their priority. A value-initialized schedule, e.g.
+        /// `Schedule{}`, is called on every cycle with neutral priority.
+        struct Schedule {
+            quint32 period; ///< The time in milliseconds between two calls, or `0` to be called on every cycle.
+            quint32 phase; ///< The delay in milliseconds of the first call, e.g. to spread equal periods.
+            qint32 priority; ///< Handlers with a higher priority are called first and are the last to be deferred.
+        };
+
         /// @brief The driver instance cannot call the underlying driver due to the fact that access is locked.
         class CallLocked final :
                 public Extension::CuriousCuteException<CallLocked> {};
@@ -115,6 +194,8 @@ namespace CuteVR {
 
         /// @brief Functors that are executed with this method have a guarantee that the library will neither start up
         /// nor shut down the underlying driver.
+        /// @details If Configurations::Core::Feature::driverThread was enabled at initialization, the functor is
+        /// executed on the driver thread without locking and this method blocks until it has finished.
         /// @param functor The functor being executed.
         /// @param initialized `yes` and the driver must be initialized, `no` and it must be terminated, or `maybe` and
         /// it doesn't matter.
@@ -123,6 +204,16 @@ namespace CuteVR {
         static void synchronized(std::function<void(void)> const &functor,
                                  Extension::Trilean initialized = Extension::maybe);
 
+        /// @brief Executes all calls of the batch within a single synchronized scope, and clears the batch afterwards.
+        /// @details Exceptions of calls that were added with Batch::request are delivered with their futures, any other
+        /// exception aborts the execution and the remaining calls are dropped.
+        /// @param batch The batch being executed.
+        /// @param initialized `yes` and the driver must be initialized, `no` and it must be terminated, or `maybe` and
+        /// it doesn't matter.
+        /// @throw NotInitialized
+        /// @throw NotTerminated
+        static void execute(Batch &batch, Extension::Trilean initialized = Extension::maybe);
+
         /// @brief Adds a callback to the event handling loop of the #pollEvents method.
         /// @param eventHandler The event handler that will be called if a new event occurs.
         /// @param devices A list of device identifiers for which the handler wants to receive events. An empty list
@@ -146,6 +237,13 @@ namespace CuteVR {
         static void announce(QWeakPointer<Interface::TrackingHandler> trackingHandler,
                              QSet<Identifier> const &devices) noexcept;
 
+        /// @brief Adds a callback that receives the tracking information of all devices at once per #pollTracking.
+        /// @details Frame handlers are called after the handlers of the individual devices, so that they can process
+        /// the whole frame in a single pass.
+        /// @param trackingHandler The tracking handler that will be called once per frame.
+        /// @attention OpenVR implementation of %CuteVR sends an `Internal::TrackingFrame` structure.
+        static void announceFrame(QWeakPointer<Interface::TrackingHandler> trackingHandler) noexcept;
+
         /// @brief Polls new tracking information from the virtual reality system and delegates them.
         /// @details Calls the tracking handlers that were #announce%d. The concrete behavior depends manly on the
         /// state of Configuration::Core::Feature::trackingEnabled.
@@ -154,13 +252,17 @@ namespace CuteVR {
         static Extension::Optional<QSharedPointer<Extension::CuteException>> pollTracking();
 
         /// @brief Adds a callback to the cyclic loop of the #runCycle method.
-        /// @param cyclicHandler The cyclic handler that will be called on every cycle.
+        /// @param cyclicHandler The cyclic handler that will be called whenever it is due.
         /// @param dataProvider The data generated by this function is sent to the cyclic handler.
+        /// @param schedule The period, phase and priority of the cyclic handler, by default it is called on every
+        /// cycle.
         static void announce(QWeakPointer<Interface::CyclicHandler> cyclicHandler,
-                             std::function<void *(void)> dataProvider = {}) noexcept;
+                             std::function<void *(void)> dataProvider = {}, Schedule schedule = {}) noexcept;
 
-        /// @brief Runs through a new cycle in which all cyclic handlers are called.
-        /// @details Calls the cyclic handler that were #announce%d and sends the possibly generated data to them.
+        /// @brief Runs through a new cycle in which all due cyclic handlers are called.
+        /// @details Calls the cyclic handler that were #announce%d and are due according to their Schedule, and sends
+        /// the possibly generated data to them. Handlers that are still due after the time budget given by
+        /// Configurations::Core::Parameter::cycleBudget is spent are deferred to the next cycle.
         /// @return Nothing, or an exception.
         static Extension::Optional<QSharedPointer<Extension::CuteException>> runCycle();
 
@@ -208,6 +310,22 @@ namespace CuteVR {
 
     private: // variables
         QScopedPointer<Private> _private;
+
+    signals:
+        /// @brief Is emitted at the end of each #pollEvents, #pollTracking and #runCycle, e.g. to publish everything
+        /// that has been collected during the poll at once.
+        /// @note Connections should be direct, since the signal is emitted by the polling thread.
+        void polled();
+    };
+
+    /// @private
+    template<>
+    struct DriverServer::Batch::Fulfil<void> {
+        template<class FunctorT>
+        static void with(std::promise<void> &promise, FunctorT const &functor) {
+            functor();
+            promise.set_value();
+        }
     };
 }
 
@@ -21,11 +21,17 @@
 #define OPENVR_INTERFACE_INTERNAL
 #endif // OPENVR_INTERFACE_INTERNAL
 
+#include <atomic>
 #include <cassert>
 #include <cstring>
+#include <queue>
 #include <openvr.h>
 
 namespace CuteVR { namespace Emulator { namespace OpenVR {
+    // Prepared data with these values matches any device or property, e.g. to emulate many equal devices at once.
+    constexpr vr::TrackedDeviceIndex_t anyDevice{vr::k_unTrackedDeviceIndexInvalid};
+    constexpr vr::ETrackedDeviceProperty anyProperty{vr::Prop_Invalid};
+
     class VRSystem :
             public vr::IVRSystem {
     public:
@@ -289,7 +295,8 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
         } getTrackedDeviceClass_data{};
 
         vr::ETrackedDeviceClass GetTrackedDeviceClass(vr::TrackedDeviceIndex_t unDeviceIndex) override {
-            assert(getTrackedDeviceClass_data.unDeviceIndex == unDeviceIndex);
+            assert(getTrackedDeviceClass_data.unDeviceIndex == anyDevice ||
+                   getTrackedDeviceClass_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
             return getTrackedDeviceClass_data.returns;
         }
@@ -300,7 +307,8 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
         } isTrackedDeviceConnected_data{};
 
         bool IsTrackedDeviceConnected(vr::TrackedDeviceIndex_t unDeviceIndex) override {
-            assert(isTrackedDeviceConnected_data.unDeviceIndex == unDeviceIndex);
+            assert(isTrackedDeviceConnected_data.unDeviceIndex == anyDevice ||
+                   isTrackedDeviceConnected_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
             return isTrackedDeviceConnected_data.returns;
         }
@@ -314,9 +322,11 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
 
         bool GetBoolTrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop,
                                           vr::ETrackedPropertyError *pError) override {
-            assert(getBoolTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getBoolTrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getBoolTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getBoolTrackedDeviceProperty_data.prop == prop);
+            assert(getBoolTrackedDeviceProperty_data.prop == anyProperty ||
+                   getBoolTrackedDeviceProperty_data.prop == prop);
             (void) prop;
             if (pError) {
                 *pError = getBoolTrackedDeviceProperty_data.pError;
@@ -333,9 +343,11 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
 
         float GetFloatTrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop,
                                             vr::ETrackedPropertyError *pError) override {
-            assert(getFloatTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getFloatTrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getFloatTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getFloatTrackedDeviceProperty_data.prop == prop);
+            assert(getFloatTrackedDeviceProperty_data.prop == anyProperty ||
+                   getFloatTrackedDeviceProperty_data.prop == prop);
             (void) prop;
             if (pError) {
                 *pError = getFloatTrackedDeviceProperty_data.pError;
@@ -352,9 +364,11 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
 
         int32_t GetInt32TrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop,
                                               vr::ETrackedPropertyError *pError) override {
-            assert(getInt32TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getInt32TrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getInt32TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getInt32TrackedDeviceProperty_data.prop == prop);
+            assert(getInt32TrackedDeviceProperty_data.prop == anyProperty ||
+                   getInt32TrackedDeviceProperty_data.prop == prop);
             (void) prop;
             if (pError) {
                 *pError = getInt32TrackedDeviceProperty_data.pError;
@@ -371,9 +385,11 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
 
         uint64_t GetUint64TrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop,
                                                 vr::ETrackedPropertyError *pError) override {
-            assert(getUint64TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getUint64TrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getUint64TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getUint64TrackedDeviceProperty_data.prop == prop);
+            assert(getUint64TrackedDeviceProperty_data.prop == anyProperty ||
+                   getUint64TrackedDeviceProperty_data.prop == prop);
             (void) prop;
             if (pError) {
                 *pError = getUint64TrackedDeviceProperty_data.pError;
@@ -391,9 +407,11 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
         vr::HmdMatrix34_t GetMatrix34TrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex,
                                                            vr::ETrackedDeviceProperty prop,
                                                            vr::ETrackedPropertyError *pError) override {
-            assert(getMatrix34TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getMatrix34TrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getMatrix34TrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getMatrix34TrackedDeviceProperty_data.prop == prop);
+            assert(getMatrix34TrackedDeviceProperty_data.prop == anyProperty ||
+                   getMatrix34TrackedDeviceProperty_data.prop == prop);
             (void) prop;
             if (pError) {
                 *pError = getMatrix34TrackedDeviceProperty_data.pError;
@@ -443,17 +461,20 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
         uint32_t GetStringTrackedDeviceProperty(vr::TrackedDeviceIndex_t unDeviceIndex, vr::ETrackedDeviceProperty prop,
                                                 char *pchValue, uint32_t unBufferSize,
                                                 vr::ETrackedPropertyError *pError) override {
-            assert(getStringTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
+            assert(getStringTrackedDeviceProperty_data.unDeviceIndex == anyDevice ||
+                   getStringTrackedDeviceProperty_data.unDeviceIndex == unDeviceIndex);
             (void) unDeviceIndex;
-            assert(getStringTrackedDeviceProperty_data.prop == prop);
+            assert(getStringTrackedDeviceProperty_data.prop == anyProperty ||
+                   getStringTrackedDeviceProperty_data.prop == prop);
             (void) prop;
-            assert(getStringTrackedDeviceProperty_data.unBufferSize == unBufferSize || unBufferSize == 0);
+            assert(getStringTrackedDeviceProperty_data.unBufferSize <= unBufferSize || unBufferSize == 0);
             (void) unBufferSize;
             if (pError) {
                 *pError = getStringTrackedDeviceProperty_data.pError;
             }
             if (pchValue) {
-                std::memcpy(pchValue, getStringTrackedDeviceProperty_data.pchValue, unBufferSize);
+                std::memcpy(pchValue, getStringTrackedDeviceProperty_data.pchValue,
+                            getStringTrackedDeviceProperty_data.unBufferSize);
             }
             return getStringTrackedDeviceProperty_data.returns;
         }
@@ -472,11 +493,17 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
         struct PollNextEvent_data {
             vr::VREvent_t pEvent{};
             bool returns{};
+            std::queue<vr::VREvent_t> queued{}; // returned one by one before falling back to pEvent and returns
         } pollNextEvent_data{};
 
         bool PollNextEvent(vr::VREvent_t *pEvent, uint32_t uncbVREvent) override {
             assert(uncbVREvent == sizeof(vr::VREvent_t)); // sic!
             (void) uncbVREvent;
+            if (!pollNextEvent_data.queued.empty()) {
+                *pEvent = pollNextEvent_data.queued.front();
+                pollNextEvent_data.queued.pop();
+                return true;
+            }
             *pEvent = pollNextEvent_data.pEvent;
             return pollNextEvent_data.returns;
         }
@@ -569,6 +596,7 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
             vr::TrackedDeviceIndex_t unControllerDeviceIndex{};
             uint32_t unAxisId{};
             unsigned short usDurationMicroSec{};
+            std::atomic<uint32_t> calls{0};
         } triggerHapticPulse_data{};
 
         void TriggerHapticPulse(vr::TrackedDeviceIndex_t unControllerDeviceIndex, uint32_t unAxisId,
@@ -579,6 +607,7 @@ namespace CuteVR { namespace Emulator { namespace OpenVR {
             (void) unAxisId;
             assert(triggerHapticPulse_data.usDurationMicroSec == usDurationMicroSec);
             (void) usDurationMicroSec;
+            triggerHapticPulse_data.calls++;
         }
 
         struct GetButtonIdNameFromEnum_data {
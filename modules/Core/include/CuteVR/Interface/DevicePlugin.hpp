@@ -0,0 +1,51 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERFACE_DEVICE_PLUGIN
+#define CUTE_VR_INTERFACE_DEVICE_PLUGIN
+
+#include <QtCore/QtPlugin>
+
+/// @brief The interface identifier that device plugins have to state in their `Q_PLUGIN_METADATA`.
+#define CUTE_VR_DEVICE_PLUGIN_IID "org.maskor.CuteVR.DevicePlugin/1.0"
+
+namespace CuteVR { namespace Interface {
+    /// @interface DevicePlugin
+    /// @brief The derived class is the root object of a shared library that contains device classes.
+    /// @details Plugins are only loaded once a device appears whose signature is listed in the manifest of the
+    /// plugin, see DeviceServer::discover. The manifest is the JSON file of the plugin metadata, which must contain
+    /// the signatures as an array of strings, e.g. `{"signatures": ["Magic_Marker_1_1", "Magic_MarkerPro_1_2"]}`.
+    /// @code
+    /// class MagicPlugin :
+    ///         public QObject,
+    ///         public CuteVR::Interface::DevicePlugin {
+    /// Q_OBJECT
+    ///     Q_PLUGIN_METADATA(IID CUTE_VR_DEVICE_PLUGIN_IID FILE "MagicPlugin.json")
+    ///     Q_INTERFACES(CuteVR::Interface::DevicePlugin)
+    ///
+    /// public:
+    ///     void registerDevices() override {
+    ///         CuteVR::DeviceServer::registerDevice(
+    ///                 [](CuteVR::Identifier const identifier) {
+    ///                     return QSharedPointer<CuteVR::Device>{
+    ///                             new CuteVR::Devices::Tracker::Magic_Marker{identifier}};
+    ///                 }, QStringList{"Magic_Marker_1_1", "Magic_MarkerPro_1_2"});
+    ///     }
+    /// };
+    /// @endcode
+    class DevicePlugin {
+    public: // destructor
+        virtual ~DevicePlugin() = default;
+
+    public: // methods
+        /// @brief Registers the factories of all device classes of the plugin with DeviceServer::registerDevice.
+        /// @details Is called once, right after the plugin has been loaded.
+        virtual void registerDevices() = 0;
+    };
+}}
+
+Q_DECLARE_INTERFACE(CuteVR::Interface::DevicePlugin, CUTE_VR_DEVICE_PLUGIN_IID)
+
+#endif // CUTE_VR_INTERFACE_DEVICE_PLUGIN
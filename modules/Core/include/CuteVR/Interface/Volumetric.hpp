@@ -0,0 +1,41 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERFACE_VOLUMETRIC
+#define CUTE_VR_INTERFACE_VOLUMETRIC
+
+#include <QtCore/QPair>
+#include <QtGui/QVector3D>
+
+namespace CuteVR { namespace Interface {
+    /// @interface Volumetric
+    /// @brief The objects of the derived class enclose a solid volume that can be queried geometrically.
+    /// @details All points and rays are given in the coordinate system of the object.
+    class Volumetric {
+    public: // destructor
+        virtual ~Volumetric() = default;
+
+    public: // methods
+        /// @brief Computes the signed distance of a point to the surface of the volume.
+        /// @param point The point in the coordinate system of the volume.
+        /// @return The distance in meters, which is negative inside of the volume.
+        virtual qreal distance(QVector3D const &point) const noexcept = 0;
+
+        /// @return `true` if the point lies inside of the volume or on its surface.
+        virtual bool contains(QVector3D const &point) const noexcept = 0;
+
+        /// @brief Casts a ray against the volume.
+        /// @param origin The origin of the ray in the coordinate system of the volume.
+        /// @param direction The direction of the ray, which has to be normalized.
+        /// @return The distance in meters along the ray to the first point of the volume, which is zero if the origin
+        /// lies inside, or infinity if the ray misses the volume.
+        virtual qreal intersect(QVector3D const &origin, QVector3D const &direction) const noexcept = 0;
+
+        /// @return The lower and upper corner of the axis aligned box that encloses the volume.
+        virtual QPair<QVector3D, QVector3D> bounds() const noexcept = 0;
+    };
+}}
+
+#endif // CUTE_VR_INTERFACE_VOLUMETRIC
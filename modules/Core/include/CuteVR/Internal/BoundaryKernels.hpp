@@ -0,0 +1,54 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_BOUNDARY_KERNELS
+#define CUTE_VR_INTERNAL_BOUNDARY_KERNELS
+
+#include <QtGui/QMatrix4x4>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Internal/Simd.hpp>
+#include <CuteVR/Component.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @internal@brief Batched signed distances of many points to one boundary geometry.
+    /// @details The vectorized path handles four points per iteration and the remainder is done by the portable scalar
+    /// path. The results agree with the distance functions of the geometry components within single precision.
+    namespace BoundaryKernels {
+        using Simd::InstructionSet;
+
+        /// @internal@brief A boundary geometry reduced to the values the kernels evaluate.
+        struct Shape {
+            /// @internal@brief The supported geometries.
+            enum class Type :
+                    quint8 {
+                none, ///< The geometry is not supported, every point is inside.
+                box, ///< A Cube or Cuboid.
+                sphere ///< A Sphere.
+            };
+
+            Type type{Type::none};
+            QVector3D halfExtents{}; ///< Half edge lengths of a box.
+            float radius{0.0f}; ///< Radius of a sphere.
+        };
+
+        /// @internal@brief Reduces a geometry component to its shape.
+        /// @return The shape, whose type is Shape::Type::none if the geometry is missing or not supported.
+        Shape shape(CategorizedComponent<Component::Category::geometry> const *geometry);
+
+        /// @internal@brief Signed distances of points to the surface of a shape.
+        /// @param shape The shape the distances refer to.
+        /// @param toShape Rigid transform of the points into the coordinate system of the shape.
+        /// @param points The points being evaluated.
+        /// @param result Receives one distance per point in meters, which is negative inside of the shape. It is
+        /// negative infinity for Shape::Type::none.
+        /// @param count The number of points.
+        /// @param set The instruction set to use.
+        void distances(Shape const &shape, QMatrix4x4 const &toShape, QVector3D const *points, float *result,
+                       qint32 count, InstructionSet set = Simd::supported());
+    }
+}}
+
+#endif // CUTE_VR_INTERNAL_BOUNDARY_KERNELS
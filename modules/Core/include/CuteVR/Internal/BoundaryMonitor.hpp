@@ -0,0 +1,69 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_BOUNDARY_MONITOR
+#define CUTE_VR_INTERNAL_BOUNDARY_MONITOR
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Internal/BoundaryKernels.hpp>
+#include <CuteVR/System.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Evaluates the positions of all devices of one cell against its boundary and reports state transitions.
+    /// @details The distances of all positions are computed by one call of BoundaryKernels::distances. The monitor
+    /// remembers the last state of every device, so that only changes are reported.
+    class BoundaryMonitor {
+    public: // types
+        /// @brief A device whose state differs from the previous evaluation.
+        struct Transition {
+            Identifier device{invalidIdentifier}; ///< The device that changed its state.
+            System::BoundaryState state{System::BoundaryState::inside}; ///< The new state of the device.
+        };
+
+        /// @brief The outcome of one evaluation.
+        struct Evaluation {
+            QMap<Identifier, qreal> distances{}; ///< The signed distance of every evaluated device.
+            QList<Transition> transitions{}; ///< The devices that changed their state.
+        };
+
+    public: // constructor/destructor
+        BoundaryMonitor();
+
+        ~BoundaryMonitor();
+
+        Q_DISABLE_COPY(BoundaryMonitor)
+
+    public: // methods
+        /// @brief Evaluates the given positions against a boundary.
+        /// @details Devices that are no longer evaluated are forgotten without a transition, as are all devices if the
+        /// boundary has no supported geometry.
+        /// @param boundary The boundary of the cell.
+        /// @param positions The positions of the devices in cell coordinates.
+        /// @param nearDistance The distance to the boundary below which an inside device is near to it.
+        /// @param set The instruction set to use, see BoundaryKernels.
+        /// @return The distances and the transitions of the devices.
+        Evaluation evaluate(System::Cell::Boundary const &boundary, QMap<Identifier, QVector3D> const &positions,
+                            qreal nearDistance, BoundaryKernels::InstructionSet set = Simd::supported());
+
+        /// @brief Forgets the states of all devices.
+        void clear();
+
+        /// @brief Classifies a signed distance.
+        static System::BoundaryState classify(qreal distance, qreal nearDistance) noexcept;
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_BOUNDARY_MONITOR
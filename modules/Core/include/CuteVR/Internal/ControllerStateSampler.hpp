@@ -0,0 +1,48 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_CONTROLLER_STATE_SAMPLER
+#define CUTE_VR_INTERNAL_CONTROLLER_STATE_SAMPLER
+
+#include <QtCore/QList>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QWeakPointer>
+
+#include <CuteVR/Interface/CyclicHandler.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Reads the controller state of a device once per cycle and hands it to all consumers.
+    /// @details A state is only handed on if the driver reports a new packet number, so idle controllers do not cause
+    /// any further work. The consumers receive a pointer to the driver-specific controller state as cyclic data.
+    class ControllerStateSampler :
+            public Interface::CyclicHandler {
+    public: // constructor/destructor
+        ControllerStateSampler(Identifier device, QList<QWeakPointer<Interface::CyclicHandler>> consumers);
+
+        ~ControllerStateSampler() override;
+
+        Q_DISABLE_COPY(ControllerStateSampler)
+
+    public: // getter
+        /// @return The number of states that have been handed to the consumers.
+        quint64 samples() const noexcept;
+
+    public: // methods
+        /// @brief Reads the controller state and hands it to the consumers if it has changed.
+        /// @param data Ignored, the state is always read from the driver.
+        /// @return `true` if any consumer has processed the state.
+        bool handleCyclic(void const *data) override;
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_CONTROLLER_STATE_SAMPLER
@@ -13,6 +13,9 @@
 
 namespace CuteVR { namespace Internal {
     /// @private
+    /// @brief Reports the axes of the controller state that have moved since the last state.
+    /// @details Cyclic data is expected to be the controller state read by a ControllerStateSampler, without data the
+    /// state is read from the driver.
     class DefaultAxesProvider :
             public Interface::CyclicHandler {
     public: // constructor/destructor
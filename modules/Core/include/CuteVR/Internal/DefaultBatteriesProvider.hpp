@@ -0,0 +1,45 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_DEFAULT_BATTERIES_PROVIDER
+#define CUTE_VR_INTERNAL_DEFAULT_BATTERIES_PROVIDER
+
+#include <functional>
+
+#include <CuteVR/Components/Peripheral/Battery.hpp>
+#include <CuteVR/Interface/CyclicHandler.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Polls the battery of a device, which changes so slowly that it is announced with a period of #period.
+    class DefaultBatteriesProvider :
+            public Interface::CyclicHandler {
+    public: // constants
+        static constexpr quint32 period{1000}; ///< The time in milliseconds between two polls.
+
+    public: // constructor/destructor
+        DefaultBatteriesProvider(Identifier device,
+                                 std::function<void(Components::Peripheral::Battery const &)> callback);
+
+        ~DefaultBatteriesProvider() override;
+
+        Q_DISABLE_COPY(DefaultBatteriesProvider)
+
+    public: // getter
+        /// @return `true` if the device reports its battery status at all.
+        bool hasBattery() const noexcept;
+
+    public: // methods
+        bool handleCyclic(void const *data) override;
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_DEFAULT_BATTERIES_PROVIDER
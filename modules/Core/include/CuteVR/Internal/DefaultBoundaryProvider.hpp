@@ -0,0 +1,43 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_DEFAULT_BOUNDARY_PROVIDER
+#define CUTE_VR_INTERNAL_DEFAULT_BOUNDARY_PROVIDER
+
+#include <functional>
+
+#include <CuteVR/Interface/EventHandler.hpp>
+#include <CuteVR/System.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Provides the boundary of the default cell from the calibrated play area of the chaperone.
+    /// @details The play area is a rectangle on the floor around the origin of the standing universe, which becomes a
+    /// Cuboid of the height Configurations::Core::Parameter::boundaryHeight that stands on the floor. The boundary has
+    /// no geometry while the play area is not calibrated.
+    class DefaultBoundaryProvider :
+            public Interface::EventHandler {
+    public: // constructor/destructor
+        explicit DefaultBoundaryProvider(std::function<void(System::Cell::Boundary const &)> callback);
+
+        ~DefaultBoundaryProvider() override;
+
+        Q_DISABLE_COPY(DefaultBoundaryProvider)
+
+    public: // methods
+        bool handleEvent(void const *event, void const *tracking) override;
+
+        /// @brief Fetches the play area and passes its boundary to the callback.
+        void query();
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_DEFAULT_BOUNDARY_PROVIDER
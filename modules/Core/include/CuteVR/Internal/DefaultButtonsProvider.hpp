@@ -9,11 +9,16 @@
 #include <functional>
 
 #include <CuteVR/Components/Input/Button.hpp>
+#include <CuteVR/Interface/CyclicHandler.hpp>
 #include <CuteVR/Interface/EventHandler.hpp>
 
 namespace CuteVR { namespace Internal {
     /// @private
+    /// @brief Derives button transitions from the pressed and touched masks of the controller state.
+    /// @details Cyclic data is expected to be the controller state read by a ControllerStateSampler, without data the
+    /// state is read from the driver. Button events update the masks without asking the driver.
     class DefaultButtonsProvider :
+            public Interface::CyclicHandler,
             public Interface::EventHandler {
     public: // constructor/destructor
         DefaultButtonsProvider(Identifier device, std::function<void(Components::Input::Button const &)> callback);
@@ -23,6 +28,8 @@ namespace CuteVR { namespace Internal {
         Q_DISABLE_COPY(DefaultButtonsProvider)
 
     public: // methods
+        bool handleCyclic(void const *data) override;
+
         bool handleEvent(void const *event, void const *tracking) override;
 
     private: // types
@@ -0,0 +1,43 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_DEFAULT_HAPTICS_PROVIDER
+#define CUTE_VR_INTERNAL_DEFAULT_HAPTICS_PROVIDER
+
+#include <functional>
+#include <QtCore/QVector>
+
+#include <CuteVR/Components/Output/Haptic.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Describes the haptics of a device and hands their envelopes to the HapticScheduler.
+    class DefaultHapticsProvider {
+    public: // constructor/destructor
+        DefaultHapticsProvider(Identifier device,
+                               std::function<void(Components::Output::Haptic const &)> callback);
+
+        /// @brief Cancels all pulses of the device that have not been played yet.
+        ~DefaultHapticsProvider();
+
+        Q_DISABLE_COPY(DefaultHapticsProvider)
+
+    public: // methods
+        /// @brief Schedules an amplitude envelope without blocking the caller.
+        /// @param haptic The identifier of the haptic.
+        /// @param envelope The amplitudes between `0` and `1`, each played for one
+        /// Components::Output::Haptic::interval.
+        /// @return `false` if the haptic is unknown or the request has been dropped.
+        bool vibrate(Identifier haptic, QVector<qreal> const &envelope);
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_DEFAULT_HAPTICS_PROVIDER
@@ -8,15 +8,28 @@
 
 #include <functional>
 
-#include <CuteVR/Components/Pose.hpp>
+#include <CuteVR/Components/CompactPose.hpp>
 #include <CuteVR/Interface/TrackingHandler.hpp>
 
 namespace CuteVR { namespace Internal {
     /// @private
+    /// @brief Converts the tracking data of a device into a Components::Pose and a Components::CompactPose.
+    /// @details The provider is shared by all objects of a device, so the conversion and the derivation of the
+    /// accelerations from consecutive velocities happen once per device and tracking frame. The velocities of the
+    /// compact pose are always provided, its flags only announce them as far as the corresponding features are enabled.
     class DefaultPoseProvider :
             public Interface::TrackingHandler {
+    public: // types
+        /// @brief Both representations of one tracked pose.
+        struct Sample {
+            /// @brief The pose with the exact matrix of the driver and the derived accelerations.
+            Components::Pose pose{};
+            /// @brief The compact representation of the same pose.
+            Components::CompactPose compact{};
+        };
+
     public: // constructor/destructor
-        DefaultPoseProvider(Identifier device, std::function<void(Components::Pose const &)> callback);
+        DefaultPoseProvider(Identifier device, std::function<void(Sample const &)> callback);
 
         ~DefaultPoseProvider() override;
 
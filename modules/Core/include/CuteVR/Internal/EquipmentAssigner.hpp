@@ -0,0 +1,82 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_EQUIPMENT_ASSIGNER
+#define CUTE_VR_INTERNAL_EQUIPMENT_ASSIGNER
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Assigns every controller to the head-mounted display of the user that most likely holds it.
+    /// @details The cost of a pair is the mean distance between the controller and the head-mounted display over a
+    /// short window of frames, plus their mean relative speed weighted by a time constant, since a controller moves
+    /// along with the body of its user. The assigner is incremental: a controller is only re-evaluated if it is
+    /// ambiguous, i.e. if it could be nearer to another head-mounted display than to its own by the triangle
+    /// inequality. A reassignment happens only after another head-mounted display has been cheaper by the hysteresis
+    /// for a number of consecutive frames, which prevents flapping between nearby users.
+    class EquipmentAssigner {
+    public: // types
+        /// @brief The values that control the assignment.
+        struct Tuning {
+            qint32 window{45}; ///< The number of frames over which the costs are averaged.
+            qreal hysteresis{0.15}; ///< The margin in meters by which another cost must be lower.
+            qint32 persistence{20}; ///< The number of consecutive frames the margin must hold.
+            qreal motionWeight{0.25}; ///< The time constant in seconds that weights the relative speed.
+        };
+
+        /// @brief A controller that changes its head-mounted display.
+        struct Reassignment {
+            Identifier controller{invalidIdentifier}; ///< The reassigned controller.
+            Identifier previous{invalidIdentifier}; ///< The previous head-mounted display, invalid if there was none.
+            Identifier headMountedDisplay{invalidIdentifier}; ///< The new head-mounted display.
+        };
+
+    public: // constructor/destructor
+        EquipmentAssigner();
+
+        ~EquipmentAssigner();
+
+        Q_DISABLE_COPY(EquipmentAssigner)
+
+    public: // getter
+        /// @param controller The controller to look up.
+        /// @return The head-mounted display of the controller, invalid if it is not assigned.
+        Identifier assignment(Identifier controller) const noexcept;
+
+    public: // methods
+        /// @brief Records the poses of one frame and reassigns the controllers where necessary.
+        /// @details Unassigned controllers are assigned immediately to the cheapest head-mounted display. Devices
+        /// without a valid pose are skipped for this frame but keep their history and assignment. The window and the
+        /// persistence count tracking frames, hence poses of a frame that is not newer than the last one are ignored.
+        /// @param frame The number of the tracking frame the poses belong to, see GlobalPoseStage::Snapshot::frame.
+        /// @param headMountedDisplays The poses of the head-mounted displays in cell coordinates.
+        /// @param controllers The poses of the controllers in cell coordinates.
+        /// @param tuning The values that control the assignment.
+        /// @return The controllers that changed their head-mounted display.
+        QList<Reassignment> assign(quint64 frame, QMap<Identifier, Components::CompactPose> const &headMountedDisplays,
+                                   QMap<Identifier, Components::CompactPose> const &controllers,
+                                   Tuning const &tuning);
+
+        /// @brief Forgets a device, so that the controllers of a removed head-mounted display become unassigned.
+        void remove(Identifier device);
+
+        /// @brief Forgets all devices.
+        void clear();
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_EQUIPMENT_ASSIGNER
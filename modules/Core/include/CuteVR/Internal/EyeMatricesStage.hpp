@@ -0,0 +1,51 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_EYE_MATRICES_STAGE
+#define CUTE_VR_INTERNAL_EYE_MATRICES_STAGE
+
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+
+#include <CuteVR/Components/Interaction/Eye.hpp>
+#include <CuteVR/Components/Interaction/EyeMatrices.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Computes the render matrices of all eyes of a head-mounted display once per tracking frame.
+    /// @details The projections, their inverses and the inverse head transforms are kept until an eye changes, which
+    /// only happens if the interpupillary distance or the clipping planes change. The views depend on the head pose
+    /// and are recomputed as soon as it moves, using the cheap inverse of a rigid transform. Not thread-safe.
+    class EyeMatricesStage {
+    public: // constructor/destructor
+        EyeMatricesStage();
+
+        ~EyeMatricesStage();
+
+        Q_DISABLE_COPY(EyeMatricesStage)
+
+    public: // getter
+        /// @return The matrices of each eye as of the last #update, by the identifier of the eye.
+        QMap<Identifier, Components::Interaction::EyeMatrices> const &matrices() const noexcept;
+
+    public: // methods
+        /// @brief Replaces the eyes, whereby only the eyes that actually changed are processed again.
+        /// @param eyes The current eyes of the head-mounted display.
+        void setEyes(QMap<Identifier, Components::Interaction::Eye> const &eyes);
+
+        /// @brief Recomputes the matrices for the given head pose, unless neither the pose nor any eye changed.
+        /// @param poseTransform The rigid transform from head into world coordinates.
+        /// @return `true` if the matrices have been recomputed.
+        bool update(QMatrix4x4 const &poseTransform);
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_EYE_MATRICES_STAGE
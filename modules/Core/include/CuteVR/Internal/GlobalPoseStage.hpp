@@ -0,0 +1,89 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_GLOBAL_POSE_STAGE
+#define CUTE_VR_INTERNAL_GLOBAL_POSE_STAGE
+
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+#include <QtGui/QMatrix4x4>
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Internal/TransformKernels.hpp>
+#include <CuteVR/Interface/EventHandler.hpp>
+#include <CuteVR/Interface/TrackingHandler.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Transforms the poses of all tracked devices into cell and global coordinates once per tracking frame.
+    /// @details The stage is announced as frame handler, see DriverServer::announceFrame, and transforms the whole
+    /// frame in one pass with the TransformKernels. Cell coordinates are those of the standing tracking universe, the
+    /// poses are converted into it from whatever universe the driver reports them in. Global coordinates additionally
+    /// apply the global transform of the cell that surrounds a device. The transforms between the universes are cached
+    /// until the driver announces a change of the chaperone or of a zero pose.
+    class GlobalPoseStage :
+            public Interface::EventHandler,
+            public Interface::TrackingHandler {
+    public: // types
+        /// @brief The transformed poses of the connected devices of one frame.
+        struct Snapshot {
+            QMap<Identifier, Components::CompactPose> cellPoses{}; ///< Poses in the standing universe.
+            QMap<Identifier, Components::CompactPose> globalPoses{}; ///< Poses in the global coordinate system.
+            quint64 frame{0}; ///< Counts the frames transformed by the stage, `0` if there has been none yet.
+        };
+
+    public: // constructor/destructor
+        GlobalPoseStage();
+
+        ~GlobalPoseStage() override;
+
+        Q_DISABLE_COPY(GlobalPoseStage)
+
+    public: // getter
+        /// @return The poses of the most recent frame. Thread-safe.
+        Snapshot snapshot() const;
+
+        /// @brief Queries the transform from one tracking universe into another, which is fetched on a miss.
+        /// @param from The driver-specific tracking universe to transform from.
+        /// @param to The driver-specific tracking universe to transform into.
+        /// @return The rigid transform between both universes. Thread-safe.
+        QMatrix4x4 universeTransform(qint32 from, qint32 to) const;
+
+    public: // setter
+        /// @brief Sets the global transforms of the cells that surround the devices.
+        /// @param transforms The global transform of the surrounding cell by device, which must be rigid. Devices that
+        /// are not listed are not transformed at all. Thread-safe.
+        void setCellTransforms(QHash<Identifier, QMatrix4x4> const &transforms);
+
+    public: // methods
+        bool handleEvent(void const *event, void const *tracking) override;
+
+        bool handleTracking(void const *tracking) override;
+
+        /// @brief Applies each rigid transform to the pose at the same index, including the velocities.
+        /// @param transforms The transforms, one per pose.
+        /// @param poses The poses being transformed.
+        /// @param result Receives the transformed poses, which keep the flags of the original ones. It may be the same
+        /// array as the poses.
+        /// @param count The number of poses.
+        /// @param set The instruction set to use, see TransformKernels.
+        static void apply(TransformKernels::Rigid const *transforms, Components::CompactPose const *poses,
+                          Components::CompactPose *result, qint32 count,
+                          TransformKernels::InstructionSet set = Simd::supported());
+
+        /// @brief Splits a rigid transform into its rotation and translation.
+        static TransformKernels::Rigid rigid(QMatrix4x4 const &transform);
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_GLOBAL_POSE_STAGE
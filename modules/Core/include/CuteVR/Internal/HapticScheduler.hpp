@@ -0,0 +1,72 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_HAPTIC_SCHEDULER
+#define CUTE_VR_INTERNAL_HAPTIC_SCHEDULER
+
+#include <QtCore/QScopedPointer>
+#include <QtCore/QVector>
+
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Plays the haptic pulses of all devices on a single scheduler thread.
+    /// @details Requests are handed over through an MpscQueue, so submitting never waits for the scheduler, except for
+    /// waking it up once it has run out of pulses and sleeps. Every #interval the scheduler plays at most one pulse per
+    /// device and haptic, as the driver ignores pulses that follow each other more closely. Envelopes that overlap on
+    /// the same haptic are merged by playing the highest amplitude of each interval.
+    class HapticScheduler {
+    public: // constants
+        static constexpr quint32 interval{5000}; ///< The time in microseconds between two pulses of a haptic.
+        static constexpr quint32 maximumPulse{3999}; ///< The duration in microseconds of a pulse at full amplitude.
+        static constexpr qint32 depth{1024}; ///< The number of pending requests until requests are dropped.
+
+    public: // constructor/destructor
+        /// @brief Stops the scheduler thread if it is still running.
+        ~HapticScheduler();
+
+        Q_DISABLE_COPY(HapticScheduler)
+
+    public: // getter
+        /// @return The number of pulses that have been sent to the driver.
+        static quint64 pulses() noexcept;
+
+        /// @return The number of pulses that have been merged into an already scheduled pulse.
+        static quint64 merged() noexcept;
+
+        /// @return The number of requests that have been dropped because too many were pending.
+        static quint64 dropped() noexcept;
+
+    public: // methods
+        /// @brief Schedules an amplitude envelope, starting with the next interval.
+        /// @details The scheduler thread is started with the first request.
+        /// @param device The device index number, below vr::k_unMaxTrackedDeviceCount.
+        /// @param haptic The driver-specific identifier of the haptic.
+        /// @param envelope The amplitudes between `0` and `1`, each played for one #interval.
+        /// @return `false` if the request has been dropped.
+        static bool submit(Identifier device, Identifier haptic, QVector<qreal> const &envelope);
+
+        /// @brief Drops all scheduled pulses of the given device, starting with the next interval.
+        /// @details Cancellations bypass the request queue, so they take effect even while requests are dropped.
+        static void cancel(Identifier device);
+
+        /// @brief Sets the pulse counters back to zero.
+        static void resetStatistics() noexcept;
+
+    private: // types
+        class Private;
+
+    private: // constructor
+        HapticScheduler();
+
+        static HapticScheduler &instance() noexcept;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_HAPTIC_SCHEDULER
@@ -0,0 +1,61 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_INPUT_CAPTURE
+#define CUTE_VR_INTERNAL_INPUT_CAPTURE
+
+#include <QtCore/QScopedPointer>
+#include <QtCore/QVector>
+
+#include <CuteVR/Devices/Controller/Generic.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Samples the controller state of a device on its own thread and records every input change.
+    /// @details The records are written into a SpscRing, so the sampler thread never waits for the consumer.
+    class InputCapture {
+    public: // types
+        using Record = Devices::Controller::Generic::InputRecord;
+
+    public: // constructor/destructor
+        /// @param device The device index number.
+        /// @param rate The number of samples per second.
+        /// @param depth The minimum number of records the ring buffer can hold.
+        InputCapture(Identifier device, quint32 rate, quint32 depth);
+
+        /// @brief Stops the sampler thread if it is still running.
+        ~InputCapture();
+
+        Q_DISABLE_COPY(InputCapture)
+
+    public: // getter
+        /// @return `true` if the sampler thread is running.
+        bool isRunning() const noexcept;
+
+        /// @return The number of records that have been dropped because the ring buffer was full.
+        quint64 dropped() const noexcept;
+
+    public: // methods
+        /// @brief Starts the sampler thread.
+        void start();
+
+        /// @brief Stops the sampler thread and waits until it has finished.
+        void stop();
+
+        /// @brief Moves the oldest records into the given vector, may only be called by one thread at a time.
+        /// @param records The vector to which the records are appended in chronological order.
+        /// @param maximum The maximum number of records to take, or all if negative.
+        /// @return The number of records taken.
+        qint32 drain(QVector<Record> &records, qint32 maximum = -1);
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_INPUT_CAPTURE
@@ -0,0 +1,109 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_INTERSECTION
+#define CUTE_VR_INTERNAL_INTERSECTION
+
+#include <cmath>
+#include <limits>
+#include <QtCore/QtGlobal>
+#include <QtGui/QVector3D>
+
+namespace CuteVR { namespace Internal {
+    /// @internal@brief Ray casting against solids by clipping the range of ray parameters.
+    /// @details A ray is the set of points origin + t * direction. Every solid is the intersection of half-spaces,
+    /// slabs and quadrics, so that the parameters inside of it are found by clipping one interval after another.
+    /// The signed distances that the solids share live here as well.
+    namespace Intersection {
+        /// @internal@brief The infinite distance of a ray that misses.
+        constexpr qreal miss{std::numeric_limits<qreal>::infinity()};
+
+        /// @internal@return The value multiplied by itself.
+        constexpr qreal square(qreal const value) noexcept {
+            return value * value;
+        }
+
+        /// @internal@brief The signed distance of a point to an axis aligned box around the origin.
+        /// @return The distance, which is negative inside of the box.
+        inline qreal boxDistance(QVector3D const &point, qreal const halfX, qreal const halfY,
+                                 qreal const halfZ) noexcept {
+            auto const x{qAbs(static_cast<qreal>(point.x())) - halfX};
+            auto const y{qAbs(static_cast<qreal>(point.y())) - halfY};
+            auto const z{qAbs(static_cast<qreal>(point.z())) - halfZ};
+            // the outer part is the distance to the nearest corner, edge or face, the inner part to the nearest face
+            auto const outside{std::sqrt(square(qMax(x, qreal{0})) + square(qMax(y, qreal{0})) +
+                                         square(qMax(z, qreal{0})))};
+            return outside + qMin(qMax(x, qMax(y, z)), qreal{0});
+        }
+
+        /// @internal@brief A closed range of ray parameters, which is empty if the lower bound exceeds the upper.
+        struct Interval {
+            qreal lower{-miss};
+            qreal upper{miss};
+
+            bool isEmpty() const noexcept {
+                return !(lower <= upper);
+            }
+        };
+
+        /// @internal@return The parameters that lie in both intervals.
+        inline Interval clip(Interval const &left, Interval const &right) noexcept {
+            return {qMax(left.lower, right.lower), qMin(left.upper, right.upper)};
+        }
+
+        /// @internal@brief The parameters where the linear function value + t * slope is not positive.
+        inline Interval halfSpace(qreal const value, qreal const slope) noexcept {
+            if (slope == qreal{0}) {
+                return value <= qreal{0} ? Interval{} : Interval{miss, -miss};
+            }
+            auto const root{-value / slope};
+            return slope > qreal{0} ? Interval{-miss, root} : Interval{root, miss};
+        }
+
+        /// @internal@brief The parameters where one coordinate of the ray lies between lower and upper.
+        inline Interval slab(qreal const origin, qreal const direction, qreal const lower, qreal const upper) noexcept {
+            return clip(halfSpace(lower - origin, -direction), halfSpace(origin - upper, direction));
+        }
+
+        /// @internal@brief The parameters where the ray lies inside of an axis aligned box.
+        inline Interval box(QVector3D const &origin, QVector3D const &direction, QVector3D const &lower,
+                            QVector3D const &upper) noexcept {
+            auto interval{slab(origin.x(), direction.x(), lower.x(), upper.x())};
+            interval = clip(interval, slab(origin.y(), direction.y(), lower.y(), upper.y()));
+            return clip(interval, slab(origin.z(), direction.z(), lower.z(), upper.z()));
+        }
+
+        /// @internal@return The first parameter of the interval that is not behind the origin, or miss.
+        inline qreal entry(Interval const &interval) noexcept {
+            return interval.isEmpty() || interval.upper < qreal{0} ? miss : qMax(interval.lower, qreal{0});
+        }
+
+        /// @internal@brief The first parameter of an interval where the quadric a * t^2 + b * t + c is not positive.
+        /// @return The parameter, which is not behind the origin, or miss.
+        inline qreal quadric(qreal const a, qreal const b, qreal const c, Interval const &interval) noexcept {
+            if (qFuzzyIsNull(a)) {
+                return entry(clip(interval, halfSpace(c, b)));
+            }
+            auto const discriminant{b * b - 4 * a * c};
+            if (discriminant < qreal{0}) {
+                return a > qreal{0} ? miss : entry(interval);
+            }
+            // the numerically stable form avoids the cancellation of b and the root of the discriminant
+            auto const q{-(b + std::copysign(std::sqrt(discriminant), b)) / 2};
+            auto const first{q / a};
+            auto const second{q == qreal{0} ? first : c / q};
+            auto const lower{qMin(first, second)};
+            auto const upper{qMax(first, second)};
+            if (a > qreal{0}) {
+                return entry(clip(interval, {lower, upper}));
+            }
+            // a negative quadric is not positive outside of its roots
+            auto const before{entry(clip(interval, {-miss, lower}))};
+            return before < miss ? before : entry(clip(interval, {upper, miss}));
+        }
+    }
+}}
+
+#endif // CUTE_VR_INTERNAL_INTERSECTION
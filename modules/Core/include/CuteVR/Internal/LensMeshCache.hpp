@@ -0,0 +1,103 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_LENS_MESH_CACHE
+#define CUTE_VR_INTERNAL_LENS_MESH_CACHE
+
+#include <functional>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+
+#include <CuteVR/Components/Output/DistortionMesh.hpp>
+#include <CuteVR/Components/Output/HiddenAreaMesh.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Generates and caches the distortion and hidden area meshes of head-mounted displays.
+    /// @details Meshes are kept in memory by the serial number of the head-mounted display, its interpupillary distance
+    /// and the requested eye and resolution. Distortion meshes are additionally stored on disk if
+    /// Configurations::Core::Parameter::lensMeshDirectory names a directory, so that they survive restarts of the
+    /// application. The memory is dropped whenever the interpupillary distance changes. Thread-safe.
+    class LensMeshCache {
+    public: // constants
+        static constexpr qint32 minimumResolution{2}; ///< The lowest number of vertices per row and column.
+        static constexpr qint32 maximumResolution{256}; ///< The highest number of vertices per row and column.
+
+    public: // constructor/destructor
+        ~LensMeshCache();
+
+        Q_DISABLE_COPY(LensMeshCache)
+
+    public: // methods
+        /// @brief Queries the distortion mesh of an eye, which is generated on a miss.
+        /// @details All vertices of a mesh are computed within a single synchronized scope of the DriverServer.
+        /// @param device The device index number of the head-mounted display.
+        /// @param eye The driver-specific identifier of the eye.
+        /// @param resolution The number of vertices per row and column, bounded by #minimumResolution and
+        /// #maximumResolution.
+        /// @return The mesh, which is empty if the driver cannot compute the distortion.
+        static Components::Output::DistortionMesh distortion(Identifier device, Identifier eye, QSize resolution);
+
+        /// @brief Queries the distortion meshes of several eyes at once, whereby the misses are generated in parallel.
+        /// @param device The device index number of the head-mounted display.
+        /// @param eyes The driver-specific identifiers of the eyes.
+        /// @param resolution The number of vertices per row and column, see #distortion.
+        /// @return The meshes by the identifier of their eye.
+        static QMap<Identifier, Components::Output::DistortionMesh>
+        distortions(Identifier device, QList<Identifier> const &eyes, QSize resolution);
+
+        /// @brief Queries the hidden area mesh of an eye, which is fetched from the driver on a miss.
+        /// @param device The device index number of the head-mounted display.
+        /// @param eye The driver-specific identifier of the eye.
+        /// @param type The type of the mesh.
+        /// @return The compacted mesh, which is empty if the display has no hidden area.
+        static Components::Output::HiddenAreaMesh
+        hiddenArea(Identifier device, Identifier eye, Components::Output::HiddenAreaMesh::Type type);
+
+        /// @brief Samples a distortion mesh on a regular grid.
+        /// @param resolution The number of vertices per row and column, see #distortion.
+        /// @param sample Fills the texture coordinates of a vertex at the given position, or returns `false` if the
+        /// distortion is unknown.
+        /// @return The mesh, which is empty if any sample failed.
+        static Components::Output::DistortionMesh
+        build(QSize resolution,
+              std::function<bool(QVector2D const &, Components::Output::DistortionMesh::Vertex &)> const &sample);
+
+        /// @brief Checks a distortion mesh that was read from disk against the layout of #build.
+        /// @param mesh The mesh to check.
+        /// @param resolution The number of vertices per row and column that was requested.
+        /// @return `true` if the mesh has the requested resolution and each cell of the grid consists of two triangles
+        /// whose indices reference existing vertices.
+        static bool isConsistent(Components::Output::DistortionMesh const &mesh, QSize resolution) noexcept;
+
+        /// @brief Joins equal vertices of the mesh as it is delivered by the driver.
+        /// @param vertices Three vertices per triangle, or the vertices of the line loop.
+        /// @param type The type of the mesh.
+        /// @return The mesh with distinct vertices and the indices that reference them.
+        static Components::Output::HiddenAreaMesh
+        compact(QVector<QVector2D> const &vertices, Components::Output::HiddenAreaMesh::Type type);
+
+        /// @brief Evaluates a driver event before it is delegated to any event handler, see PropertyCache::observe.
+        /// @param event Virtual reality system event, whose type depends on the underlying driver.
+        static void observe(void const *event);
+
+        /// @brief Drops all meshes that are held in memory, the files on disk are kept.
+        static void clear();
+
+    private: // types
+        class Private;
+
+    private: // constructor
+        LensMeshCache();
+
+        static LensMeshCache &instance() noexcept;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_LENS_MESH_CACHE
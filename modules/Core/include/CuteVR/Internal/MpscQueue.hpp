@@ -0,0 +1,108 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_MPSC_QUEUE
+#define CUTE_VR_INTERNAL_MPSC_QUEUE
+
+#include <utility>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QScopedArrayPointer>
+#include <QtCore/QtGlobal>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief A lock-free queue for any number of producer threads and exactly one consumer thread.
+    /// @details The values are kept in a ring of slots that is allocated once, producers claim a slot by advancing the
+    /// enqueue position and publish it with the sequence number of the slot. Hence pushing neither allocates nor waits
+    /// for another thread. Values pushed while all slots are taken are dropped.
+    /// @tparam ValueT A copyable type.
+    template<class ValueT>
+    class MpscQueue final {
+    public: // constructor/destructor
+        explicit MpscQueue(qint32 const depth) :
+                _depth{static_cast<quint64>(qMax(depth, 1))},
+                _slots{new Slot[_depth]} {
+            for (quint64 index = 0; index < _depth; index++) {
+                slotAt(index).sequence.store(index);
+            }
+        }
+
+        ~MpscQueue() = default;
+
+        Q_DISABLE_COPY(MpscQueue)
+
+    public: // getter
+        /// @return The number of values that have been dropped because the queue was full.
+        quint64 dropped() const noexcept {
+            return _dropped.load();
+        }
+
+        /// @return `true` if there is no value available, may only be called by the consumer thread.
+        bool isEmpty() const noexcept {
+            return slotAt(_dequeue).sequence.loadAcquire() != _dequeue + 1;
+        }
+
+    public: // methods
+        /// @brief Appends a value, may be called by any thread.
+        /// @return `false` if the queue was full and the value has been dropped.
+        bool push(ValueT const &value) {
+            auto position{_enqueue.load()};
+            while (true) {
+                auto &slot{slotAt(position)};
+                auto const difference{static_cast<qint64>(slot.sequence.loadAcquire() - position)};
+                if (difference == 0) {
+                    // another producer may have claimed the slot meanwhile, which updates the position to retry with
+                    if (_enqueue.testAndSetRelaxed(position, position + 1, position)) {
+                        slot.value = value;
+                        slot.sequence.storeRelease(position + 1);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    // the slot still holds the value of the previous round, which the consumer has not taken yet
+                    _dropped.fetchAndAddRelaxed(1);
+                    return false;
+                } else {
+                    position = _enqueue.load();
+                }
+            }
+        }
+
+        /// @brief Takes the oldest value, may only be called by the consumer thread.
+        /// @details A value whose producer has not finished writing it yet is reported as missing and will be taken
+        /// by one of the next calls.
+        /// @return `false` if there is no value available.
+        bool pop(ValueT &value) {
+            auto &slot{slotAt(_dequeue)};
+            if (slot.sequence.loadAcquire() != _dequeue + 1) {
+                return false;
+            }
+            value = std::move(slot.value);
+            // hands the slot over to the producer of the next round
+            slot.sequence.storeRelease(_dequeue + _depth);
+            _dequeue++;
+            return true;
+        }
+
+    private: // types
+        struct Slot {
+            QAtomicInteger<quint64> sequence{0};
+            ValueT value{};
+        };
+
+    private: // methods
+        Slot &slotAt(quint64 const position) const noexcept {
+            return _slots.data()[position % _depth];
+        }
+
+    private: // variables
+        quint64 const _depth;
+        QScopedArrayPointer<Slot> _slots;
+        QAtomicInteger<quint64> _enqueue{0};
+        quint64 _dequeue{0};
+        QAtomicInteger<quint64> _dropped{0};
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_MPSC_QUEUE
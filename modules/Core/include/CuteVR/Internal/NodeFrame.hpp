@@ -0,0 +1,52 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_NODE_FRAME
+#define CUTE_VR_INTERNAL_NODE_FRAME
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Extension/Optional.hpp>
+#include <CuteVR/Device.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief All devices and poses that a node publishes for one frame, batched into a single datagram.
+    /// @details Every frame repeats the whole device list, so that a receiver never depends on an earlier frame and
+    /// lost datagrams need no retransmission. The sequence number increases with every frame of a node and wraps
+    /// around, which is why frames are only compared by NodeFrame::isNewer.
+    struct NodeFrame {
+        /// @brief A device of the node together with its pose in the coordinate system of the cell of the node.
+        struct Entry {
+            Identifier device{invalidIdentifier}; ///< The identifier of the device on the node.
+            Device::Category category{Device::Category::undefined}; ///< The category of the device.
+            Components::CompactPose pose{}; ///< The pose of the device in cell coordinates.
+        };
+
+        static constexpr quint32 magic{0x4356524e}; ///< Marks a datagram as node frame, "CVRN".
+        static constexpr quint8 version{1}; ///< The version of the encoding.
+
+        Identifier node{invalidIdentifier}; ///< The node that published the frame.
+        quint32 sequence{0}; ///< The sequence number of the frame.
+        QVector<Entry> entries{}; ///< The devices of the node.
+
+        /// @return The frame encoded as datagram.
+        QByteArray encode() const;
+
+        /// @param datagram A datagram that has been received.
+        /// @return The decoded frame, or nothing if the datagram is no valid frame.
+        static Extension::Optional<NodeFrame> decode(QByteArray const &datagram);
+
+        /// @return `true` if the sequence number follows the other one, considering wrap-arounds.
+        static constexpr bool isNewer(quint32 sequence, quint32 other) noexcept {
+            return static_cast<qint32>(sequence - other) > 0;
+        }
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_NODE_FRAME
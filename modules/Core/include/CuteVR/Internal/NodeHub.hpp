@@ -0,0 +1,67 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_NODE_HUB
+#define CUTE_VR_INTERNAL_NODE_HUB
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+
+#include <CuteVR/Internal/NodeFrame.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Receives the frames of remote nodes and keeps the newest one of each node.
+    /// @details The hub never waits for a node. It drains whatever datagrams are pending and drops every frame that is
+    /// not newer than the one it already holds for the same node, so that delayed or reordered datagrams of a slow
+    /// node cannot roll its devices back. Nodes that have been silent for too long are expired altogether. Valid nodes
+    /// are numbered from 1 to 65535.
+    /// @note The hub must be used by a single thread.
+    class NodeHub {
+    public: // constructor/destructor
+        /// @param port The UDP port to listen on for all addresses, `0` to pick a free one.
+        explicit NodeHub(quint16 port);
+
+        ~NodeHub();
+
+        Q_DISABLE_COPY(NodeHub)
+
+    public: // getter
+        /// @return The UDP port that the hub listens on, `0` if it could not be bound.
+        quint16 port() const noexcept;
+
+        /// @return The newest frame of every node that has not expired.
+        QMap<Identifier, NodeFrame> frames() const;
+
+        /// @return The number of datagrams that have been dropped, because they were malformed or outdated.
+        quint64 dropped() const noexcept;
+
+    public: // methods
+        /// @brief Accepts all datagrams that are pending on the socket without blocking.
+        /// @param now The current time in milliseconds.
+        void receive(qint64 now);
+
+        /// @brief Accepts a single datagram.
+        /// @param datagram The datagram that has been received.
+        /// @param now The current time in milliseconds.
+        /// @return `true` if the datagram holds the newest frame of its node.
+        bool accept(QByteArray const &datagram, qint64 now);
+
+        /// @brief Forgets the nodes whose newest frame has been received before a timeout.
+        /// @param now The current time in milliseconds.
+        /// @param timeout The time in milliseconds after which a silent node expires.
+        /// @return The nodes that have expired.
+        QList<Identifier> expire(qint64 now, qint64 timeout);
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_NODE_HUB
@@ -0,0 +1,78 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_POSE_BATCH
+#define CUTE_VR_INTERNAL_POSE_BATCH
+
+#if defined(CUTE_VR_OPEN_VR) || defined(DOXYRUN)
+
+#include <algorithm>
+#include <openvr.h>
+#include <QtGui/QMatrix4x4>
+#include <QtGui/QQuaternion>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Internal/Simd.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @internal@brief Batch conversion of the poses of all tracked devices of one frame.
+    /// @details The kernels convert the whole pose array of the driver in one pass into packed outputs, instead of
+    /// building one Qt object per device. Every path produces bit-identical results to the scalar conversions of
+    /// Matrix4x4 and Vector3, the vectorized paths merely move the values with fewer instructions.
+    namespace PoseBatch {
+        using Simd::InstructionSet;
+        using Simd::supported;
+
+        /// @internal@brief Position, orientation and velocities of one pose, packed without any padding.
+        struct Packed {
+            float position[3];
+            float orientation[4]; ///< Scalar part first, like the constructor of QQuaternion.
+            float linearVelocity[3];
+            float angularVelocity[3];
+        };
+
+        /// @internal@brief Number of floats of a packed 4x4 matrix.
+        constexpr qint32 matrixSize{16};
+
+        /// @internal@brief Converts the device to absolute tracking matrices of the given poses.
+        /// @param poses The poses as reported by the driver.
+        /// @param count The number of poses.
+        /// @param matrices Receives PoseBatch::matrixSize floats per pose in column-major order, which is the layout
+        /// of QMatrix4x4::data.
+        /// @param set The instruction set to use, it falls back to the next weaker set if it is not supported. The
+        /// SSE2 path converts one pose and the AVX2 path two poses per iteration.
+        void toMatrices(vr::TrackedDevicePose_t const *poses, qint32 count, float *matrices,
+                        InstructionSet set = supported()) noexcept;
+
+        /// @internal@brief Extracts position, orientation and velocities of the given poses.
+        /// @details The orientation is derived by Quaternion::from, so that it equals the scalar conversion exactly.
+        /// @param poses The poses as reported by the driver.
+        /// @param count The number of poses.
+        /// @param packed Receives one entry per pose.
+        void toPacked(vr::TrackedDevicePose_t const *poses, qint32 count, Packed *packed);
+
+        /// @internal@brief Creates a Qt matrix from one packed matrix of PoseBatch::toMatrices.
+        inline QMatrix4x4 matrix(float const *matrix) {
+            QMatrix4x4 result{Qt::Uninitialized};
+            std::copy(matrix, matrix + matrixSize, result.data());
+            return result;
+        }
+
+        /// @internal@brief Creates a Qt vector from the position of a packed pose.
+        inline QVector3D position(Packed const &packed) {
+            return {packed.position[0], packed.position[1], packed.position[2]};
+        }
+
+        /// @internal@brief Creates a Qt quaternion from the orientation of a packed pose.
+        inline QQuaternion orientation(Packed const &packed) {
+            return QQuaternion{packed.orientation[0], packed.orientation[1], packed.orientation[2],
+                               packed.orientation[3]};
+        }
+    }
+}}
+
+#endif // CUTE_VR_OPEN_VR
+
+#endif // CUTE_VR_INTERNAL_POSE_BATCH
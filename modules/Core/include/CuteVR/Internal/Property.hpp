@@ -13,101 +13,147 @@
 
 #include <CuteVR/Internal/Matrix3x4.hpp>
 #include <CuteVR/Internal/Matrix4x4.hpp>
+#include <CuteVR/Internal/PropertyCache.hpp>
 #include <CuteVR/DriverServer.hpp>
 #include <CuteVR/Identifier.hpp>
 
 namespace CuteVR { namespace Internal {
     /// @internal@brief Query properties provided by OpenVR and, if necessary, convert them to appropriate Qt formats.
     namespace Property {
-        /// @internal@brief Query a property from the OpenVR system.
-        /// @tparam PropertyTypeT The return type expected from this property query.
+        /// @internal@brief Fetch a property from the OpenVR system without any synchronization.
+        /// @tparam PropertyTypeT The return type expected from this property fetch.
         /// @pre PropertyTypeT can be `bool`, `float`, `qint32`, `quint64`, `QMatrix4x3`, `QMatrix4x4`, or `QString`.
+        /// @pre Must be called within a synchronized scope, e.g. in DriverServer::synchronized or in a
+        /// DriverServer::Batch.
         /// @param identifier The device index number.
-        /// @param property The property to be queried.
+        /// @param property The property to be fetched.
         /// @param error If an error occurs, it is to be returned in this parameter.
-        /// @return The queried property or a default value in case of an error.
+        /// @return The fetched property or a default value in case of an error.
         template<class PropertyTypeT>
-        inline PropertyTypeT query(Identifier identifier, vr::ETrackedDeviceProperty property,
+        inline PropertyTypeT fetch(Identifier identifier, vr::ETrackedDeviceProperty property,
                                    vr::ETrackedPropertyError *error = nullptr);
 
         /// @internal@overload
         template<>
-        inline bool query<bool>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline bool fetch<bool>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                 vr::ETrackedPropertyError *error) {
-            bool value{};
-            DriverServer::synchronized([&] {
-                value = vr::VRSystem()->GetBoolTrackedDeviceProperty(identifier, property, error);
-            }, Extension::Trilean::yes);
-            return value;
+            return vr::VRSystem()->GetBoolTrackedDeviceProperty(identifier, property, error);
         }
 
         /// @internal@overload
         template<>
-        inline float query<float>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline float fetch<float>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                   vr::ETrackedPropertyError *error) {
-            float value{};
-            DriverServer::synchronized([&] {
-                value = vr::VRSystem()->GetFloatTrackedDeviceProperty(identifier, property, error);
-            }, Extension::Trilean::yes);
-            return value;
+            return vr::VRSystem()->GetFloatTrackedDeviceProperty(identifier, property, error);
         }
 
         /// @internal@overload
         template<>
-        inline qint32 query<qint32>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline qint32 fetch<qint32>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                     vr::ETrackedPropertyError *error) {
-            qint32 value{};
-            DriverServer::synchronized([&] {
-                value = vr::VRSystem()->GetInt32TrackedDeviceProperty(identifier, property, error);
-            }, Extension::Trilean::yes);
-            return value;
+            return vr::VRSystem()->GetInt32TrackedDeviceProperty(identifier, property, error);
         }
 
         /// @internal@overload
         template<>
-        inline quint64 query<quint64>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline quint64 fetch<quint64>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                       vr::ETrackedPropertyError *error) {
-            quint64 value{};
-            DriverServer::synchronized([&] {
-                value = vr::VRSystem()->GetUint64TrackedDeviceProperty(identifier, property, error);
-            }, Extension::Trilean::yes);
-            return value;
+            return vr::VRSystem()->GetUint64TrackedDeviceProperty(identifier, property, error);
         }
 
         /// @internal@overload
         template<>
-        inline QMatrix4x3 query<QMatrix4x3>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline QMatrix4x3 fetch<QMatrix4x3>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                             vr::ETrackedPropertyError *error) {
-            QMatrix4x3 value{};
-            DriverServer::synchronized([&] {
-                value = Matrix3x4::from(vr::VRSystem()->GetMatrix34TrackedDeviceProperty(identifier, property, error));
-            }, Extension::Trilean::yes);
-            return value;
+            return Matrix3x4::from(vr::VRSystem()->GetMatrix34TrackedDeviceProperty(identifier, property, error));
         }
 
         /// @internal@overload
         template<>
-        inline QMatrix4x4 query<QMatrix4x4>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline QMatrix4x4 fetch<QMatrix4x4>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                             vr::ETrackedPropertyError *error) {
-            QMatrix4x4 value{};
-            DriverServer::synchronized([&] {
-                value = Matrix4x4::from(vr::VRSystem()->GetMatrix34TrackedDeviceProperty(identifier, property, error));
-            }, Extension::Trilean::yes);
-            return value;
+            return Matrix4x4::from(vr::VRSystem()->GetMatrix34TrackedDeviceProperty(identifier, property, error));
         }
 
         /// @internal@overload
         template<>
-        inline QString query<QString>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+        inline QString fetch<QString>(Identifier const identifier, vr::ETrackedDeviceProperty const property,
                                       vr::ETrackedPropertyError *error) {
-            QByteArray bytes{};
+            // most strings fit into a small buffer on the stack, so there is only a second call for longer ones
+            char buffer[256]{};
+            vr::ETrackedPropertyError status{vr::TrackedProp_Success};
+            auto const size{vr::VRSystem()->GetStringTrackedDeviceProperty(identifier, property, buffer,
+                                                                           sizeof(buffer), &status)};
+            if (status == vr::TrackedProp_BufferTooSmall && size > sizeof(buffer)) {
+                QByteArray bytes{static_cast<qint32>(size), '\0'};
+                vr::VRSystem()->GetStringTrackedDeviceProperty(identifier, property, bytes.data(), size, error);
+                return QString::fromUtf8(bytes);
+            }
+            if (error) {
+                *error = status;
+            }
+            return QString::fromUtf8(buffer, static_cast<qint32>(qstrnlen(buffer, sizeof(buffer))));
+        }
+
+        /// @internal@brief Fetch a property from the PropertyCache, or from the OpenVR system on a miss.
+        /// @tparam PropertyTypeT The return type expected from this property fetch.
+        /// @pre PropertyTypeT can be `bool`, `float`, `qint32`, `quint64`, `QMatrix4x3`, `QMatrix4x4`, or `QString`.
+        /// @pre Must be called within a synchronized scope, e.g. in DriverServer::synchronized or in a
+        /// DriverServer::Batch.
+        /// @param identifier The device index number.
+        /// @param property The property to be fetched.
+        /// @param error If an error occurs, it is to be returned in this parameter.
+        /// @return The fetched property or a default value in case of an error.
+        template<class PropertyTypeT>
+        inline PropertyTypeT load(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+                                  vr::ETrackedPropertyError *error = nullptr) {
+            PropertyTypeT value{};
+            vr::ETrackedPropertyError status{vr::TrackedProp_Success};
+            if (!PropertyCache::lookup(identifier, property, value)) {
+                auto const generation{PropertyCache::generation(identifier, property)};
+                value = fetch<PropertyTypeT>(identifier, property, &status);
+                if (status == vr::TrackedProp_Success) {
+                    PropertyCache::store(identifier, property, value, generation);
+                }
+            }
+            if (error) {
+                *error = status;
+            }
+            return value;
+        }
+
+        /// @internal@brief Query a property from the PropertyCache, or from the OpenVR system on a miss.
+        /// @details Each miss enters its own synchronized scope, use #load within a DriverServer::Batch to query
+        /// several properties at once.
+        /// @tparam PropertyTypeT The return type expected from this property query.
+        /// @pre PropertyTypeT can be `bool`, `float`, `qint32`, `quint64`, `QMatrix4x3`, `QMatrix4x4`, or `QString`.
+        /// @param identifier The device index number.
+        /// @param property The property to be queried.
+        /// @param error If an error occurs, it is to be returned in this parameter.
+        /// @return The queried property or a default value in case of an error.
+        template<class PropertyTypeT>
+        inline PropertyTypeT query(Identifier const identifier, vr::ETrackedDeviceProperty const property,
+                                   vr::ETrackedPropertyError *error = nullptr) {
+            PropertyTypeT value{};
+            if (PropertyCache::lookup(identifier, property, value)) {
+                if (error) {
+                    *error = vr::TrackedProp_Success;
+                }
+                return value;
+            }
+            vr::ETrackedPropertyError status{vr::TrackedProp_Success};
+            // an invalidation may still arrive during the fetch, which the generation then rejects the value for
+            auto const generation{PropertyCache::generation(identifier, property)};
             DriverServer::synchronized([&] {
-                bytes = QByteArray{static_cast<qint32>(vr::VRSystem()
-                        ->GetStringTrackedDeviceProperty(identifier, property, nullptr, 0)), '\0'};
-                vr::VRSystem()->GetStringTrackedDeviceProperty(identifier, property, bytes.data(),
-                                                               static_cast<quint32>(bytes.size()), error);
-            });
-            return {bytes};
+                value = fetch<PropertyTypeT>(identifier, property, &status);
+            }, Extension::Trilean::yes);
+            if (status == vr::TrackedProp_Success) {
+                PropertyCache::store(identifier, property, value, generation);
+            }
+            if (error) {
+                *error = status;
+            }
+            return value;
         }
     }
 }}
@@ -0,0 +1,93 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_PROPERTY_CACHE
+#define CUTE_VR_INTERNAL_PROPERTY_CACHE
+
+#include <QtCore/QScopedPointer>
+
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Caches device properties with typed slots per device and property.
+    /// @details Entries are invalidated precisely by the property change events of the driver and cleared as soon as
+    /// the device is (de)activated. Since the invalidation relies on DriverServer::pollEvents, cached values are only
+    /// served while Configurations::Core::Feature::propertyCache and Configurations::Core::Feature::events are both
+    /// enabled.
+    ///
+    /// Invalidations may happen while a property is being fetched, since driver scopes are shared. Every entry has a
+    /// generation that moves on with each invalidation, thus a fetch reads the generation first and stores its value
+    /// only if the generation is still the same afterwards.
+    class PropertyCache {
+    public: // constructor/destructor
+        ~PropertyCache();
+
+        Q_DISABLE_COPY(PropertyCache)
+
+    public: // getter
+        /// @return `true` if cached values are served.
+        static bool isEnabled() noexcept;
+
+        /// @return The number of lookups that were answered by the cache.
+        static quint64 hits() noexcept;
+
+        /// @return The number of lookups that had to ask the driver.
+        static quint64 misses() noexcept;
+
+        /// @brief Queries the generation of a property, which is to be read before it is fetched.
+        /// @param device The device index number.
+        /// @param property The driver-specific property enumerator.
+        /// @return The generation, which changes whenever the property is invalidated.
+        static quint64 generation(Identifier device, qint32 property);
+
+    public: // methods
+        /// @brief Looks up a cached property.
+        /// @tparam ValueT The type of the property, the same types as for Property::query are allowed.
+        /// @param device The device index number.
+        /// @param property The driver-specific property enumerator.
+        /// @param value The cached value, which is only written on a hit.
+        /// @return `true` on a hit.
+        template<class ValueT>
+        static bool lookup(Identifier device, qint32 property, ValueT &value);
+
+        /// @brief Stores a property that has been fetched without errors, unless it has been invalidated meanwhile.
+        /// @tparam ValueT The type of the property, the same types as for Property::query are allowed.
+        /// @param device The device index number.
+        /// @param property The driver-specific property enumerator.
+        /// @param value The value being cached.
+        /// @param generation The #generation of the property from before it was fetched.
+        /// @return `true` if the value has been cached.
+        template<class ValueT>
+        static bool store(Identifier device, qint32 property, ValueT const &value, quint64 generation);
+
+        /// @brief Evaluates a driver event before it is delegated to any event handler, so that no handler can get
+        /// a stale value while it handles the event.
+        /// @param event Virtual reality system event, whose type depends on the underlying driver.
+        static void observe(void const *event);
+
+        /// @brief Drops all cached properties of the given device.
+        static void clear(Identifier device);
+
+        /// @brief Drops all cached properties.
+        static void clear();
+
+        /// @brief Sets the hit and miss counters back to zero.
+        static void resetStatistics() noexcept;
+
+    private: // types
+        class Private;
+
+    private: // constructor
+        PropertyCache();
+
+        static PropertyCache &instance() noexcept;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_PROPERTY_CACHE
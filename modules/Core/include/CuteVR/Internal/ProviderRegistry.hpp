@@ -0,0 +1,175 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_PROVIDER_REGISTRY
+#define CUTE_VR_INTERNAL_PROVIDER_REGISTRY
+
+#include <functional>
+#include <typeinfo>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QPair>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSharedPointer>
+
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief Hands out providers that are shared by all device objects of the same physical device.
+    /// @details There is at most one provider per device identifier and provider type. Every subscriber holds a
+    /// Subscription, the provider is destroyed together with the last one, which also ends its announcement at the
+    /// DriverServer. The provider computes each value once and fans it out to all subscribers, the last value is
+    /// replayed to subscribers that join later.
+    class ProviderRegistry {
+    public: // types
+        /// @brief Keeps a shared provider alive and the callback of its subscriber connected.
+        class Subscription {
+        public: // destructor
+            virtual ~Subscription() = default;
+        };
+
+    private: // types
+        /// @brief Type-erased part of a shared provider.
+        class Hub {
+        public: // destructor
+            virtual ~Hub() = default;
+        };
+
+        /// @brief The shared provider together with its subscribers.
+        template<class ProviderT, class ValueT>
+        class TypedHub final :
+                public Hub {
+        public: // methods
+            void publish(ValueT const &value) {
+                QList<QSharedPointer<std::function<void(ValueT const &)>>> callbacks{};
+                {
+                    QMutexLocker locker{&lock};
+                    last.reset(new ValueT{value});
+                    for (auto const &subscriber : subscribers) {
+                        callbacks.append(subscriber.second);
+                    }
+                }
+                for (auto const &callback : callbacks) {
+                    (*callback)(value);
+                }
+            }
+
+            quint64 subscribe(std::function<void(ValueT const &)> callback) {
+                QSharedPointer<std::function<void(ValueT const &)>> shared{
+                        new std::function<void(ValueT const &)>{std::move(callback)}};
+                QSharedPointer<ValueT> replay{};
+                quint64 key{};
+                {
+                    QMutexLocker locker{&lock};
+                    key = ++keys;
+                    subscribers.append(qMakePair(key, shared));
+                    replay = last;
+                }
+                if (replay) {
+                    (*shared)(*replay);
+                }
+                return key;
+            }
+
+            void unsubscribe(quint64 const key) {
+                QMutexLocker locker{&lock};
+                for (auto index = 0; index < subscribers.size(); index++) {
+                    if (subscribers.at(index).first == key) {
+                        subscribers.removeAt(index);
+                        break;
+                    }
+                }
+            }
+
+        public: // variables
+            QSharedPointer<ProviderT> provider{};
+
+        private: // variables
+            QMutex lock{};
+            quint64 keys{0};
+            QList<QPair<quint64, QSharedPointer<std::function<void(ValueT const &)>>>> subscribers{};
+            QSharedPointer<ValueT> last{};
+        };
+
+        /// @brief Unsubscribes from its hub as soon as it is destroyed.
+        template<class ProviderT, class ValueT>
+        class TypedSubscription final :
+                public Subscription {
+        public: // constructor/destructor
+            TypedSubscription(QSharedPointer<TypedHub<ProviderT, ValueT>> hub, quint64 const key) :
+                    hub{std::move(hub)},
+                    key{key} {}
+
+            ~TypedSubscription() override {
+                hub->unsubscribe(key);
+            }
+
+        private: // variables
+            QSharedPointer<TypedHub<ProviderT, ValueT>> hub;
+            quint64 key;
+        };
+
+    public: // constructor/destructor
+        ~ProviderRegistry();
+
+        Q_DISABLE_COPY(ProviderRegistry)
+
+    public: // getter
+        /// @return The number of shared providers that are currently alive.
+        static qint32 providers() noexcept;
+
+    public: // methods
+        /// @brief Subscribes to the provider of the given type for the given device, which is created if necessary.
+        /// @tparam ProviderT The type of the provider, which is constructed with the device identifier and a callback.
+        /// @tparam ValueT The type of the values that are published by the provider.
+        /// @param device The device index number.
+        /// @param callback Is called with every value the provider publishes.
+        /// @param announce Announces a newly created provider at the DriverServer.
+        /// @return The subscription, which has to be kept as long as values are wanted.
+        template<class ProviderT, class ValueT>
+        static QSharedPointer<Subscription> subscribe(Identifier const device,
+                                                      std::function<void(ValueT const &)> callback,
+                                                      std::function<void(QSharedPointer<ProviderT> const &)> announce) {
+            using HubT = TypedHub<ProviderT, ValueT>;
+            auto const hub{acquire(device, typeid(ProviderT).name(), [device, &announce] {
+                QSharedPointer<HubT> created{new HubT};
+                QWeakPointer<HubT> const weak{created};
+                // the provider must not keep its own hub alive
+                created->provider.reset(new ProviderT{device, [weak](ValueT const &value) {
+                    if (auto const strong = weak.toStrongRef()) {
+                        strong->publish(value);
+                    }
+                }});
+                if (announce) {
+                    announce(created->provider);
+                }
+                return created.template staticCast<Hub>();
+            }).template staticCast<HubT>()};
+            auto const key{hub->subscribe(std::move(callback))};
+            return QSharedPointer<Subscription>{new TypedSubscription<ProviderT, ValueT>{hub, key}};
+        }
+
+    private: // types
+        class Private;
+
+    private: // constructor
+        ProviderRegistry();
+
+        static ProviderRegistry &instance() noexcept;
+
+        /// @brief Returns the hub of the given device and provider type, or creates it.
+        /// @details The hub is created without holding the lock of the registry, so a provider may subscribe to other
+        /// providers while being constructed. If two threads create the same hub, the first one inserted wins.
+        static QSharedPointer<Hub> acquire(Identifier device, QByteArray const &type,
+                                           std::function<QSharedPointer<Hub>()> const &create);
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_PROVIDER_REGISTRY
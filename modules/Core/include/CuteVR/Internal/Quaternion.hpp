@@ -19,6 +19,14 @@ namespace CuteVR { namespace Internal {
             return QQuaternion{o.w, o.x, o.y, o.z};
         }
 
+        /// @internal@brief Extracts the rotation of an OpenVR 3x4 matrix as unit quaternion in Qt format.
+        inline QQuaternion from(vr::HmdMatrix34_t const &o) {
+            float const rotation[]{o.m[0][0], o.m[0][1], o.m[0][2],
+                                   o.m[1][0], o.m[1][1], o.m[1][2],
+                                   o.m[2][0], o.m[2][1], o.m[2][2]};
+            return QQuaternion::fromRotationMatrix(QMatrix3x3{rotation});
+        }
+
         /// @internal@brief Converts a quaternion from Qt to OpenVR format.
         inline vr::HmdQuaternionf_t from(QQuaternion const &o) {
             return {o.scalar(), o.x(), o.y(), o.z()};
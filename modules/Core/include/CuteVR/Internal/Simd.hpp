@@ -0,0 +1,49 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_SIMD
+#define CUTE_VR_INTERNAL_SIMD
+
+#include <QtCore/QtGlobal>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CUTE_VR_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 code is compiled per function and only taken after asking the processor, except for compilers that are unable
+// to do so, where it requires the whole build to target AVX2
+#if defined(CUTE_VR_AVX2) && defined(CUTE_VR_SIMD_SSE2)
+#if defined(__GNUC__) || defined(__clang__)
+#define CUTE_VR_SIMD_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define CUTE_VR_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+namespace CuteVR { namespace Internal {
+    /// @internal@brief Selection of the instruction sets that are used by the batch kernels.
+    namespace Simd {
+        /// @internal@brief Instruction sets the kernels are able to use, ordered from weakest to strongest.
+        enum class InstructionSet : quint8 {
+            scalar, ///< Portable fallback that runs everywhere.
+            sse2, ///< 128 bit registers.
+            avx2 ///< 256 bit registers.
+        };
+
+        /// @internal@return The best instruction set that is supported by both the build and the processor.
+        InstructionSet supported() noexcept;
+
+        /// @internal@return The requested instruction set, or the next weaker one if it is not supported.
+        inline InstructionSet select(InstructionSet const requested) noexcept {
+            auto const available{supported()};
+            return requested < available ? requested : available;
+        }
+    }
+}}
+
+#endif // CUTE_VR_INTERNAL_SIMD
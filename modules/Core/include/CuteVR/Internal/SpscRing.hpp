@@ -0,0 +1,90 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_SPSC_RING
+#define CUTE_VR_INTERNAL_SPSC_RING
+
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QVector>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief A lock-free ring buffer for exactly one producer and one consumer thread.
+    /// @details The capacity is rounded up to the next power of two. If the ring is full, new values are dropped
+    /// instead of overwriting old ones, because the producer must never touch a slot the consumer might be reading.
+    /// @tparam ValueT A trivially copyable type.
+    template<class ValueT>
+    class SpscRing final {
+    public: // constructor/destructor
+        explicit SpscRing(quint32 const depth) :
+                _slots(static_cast<qint32>(roundUp(depth))),
+                _mask{roundUp(depth) - 1} {}
+
+        ~SpscRing() = default;
+
+        Q_DISABLE_COPY(SpscRing)
+
+    public: // getter
+        /// @return The number of values the ring can hold.
+        quint32 capacity() const noexcept {
+            return _mask + 1;
+        }
+
+        /// @return The number of values that have been dropped because the ring was full.
+        quint64 dropped() const noexcept {
+            return _dropped.load();
+        }
+
+    public: // methods
+        /// @brief Appends a value, may only be called by the producer thread.
+        /// @return `false` if the ring was full and the value has been dropped.
+        bool push(ValueT const &value) noexcept {
+            auto const tail{_tail.load()};
+            if (tail - _head.loadAcquire() > _mask) {
+                _dropped.fetchAndAddRelaxed(1);
+                return false;
+            }
+            _slots[static_cast<qint32>(tail & _mask)] = value;
+            _tail.storeRelease(tail + 1);
+            return true;
+        }
+
+        /// @brief Moves the oldest values into the given vector, may only be called by the consumer thread.
+        /// @param values The vector to which the values are appended in the order they were pushed.
+        /// @param maximum The maximum number of values to take, or all if negative.
+        /// @return The number of values taken.
+        qint32 drain(QVector<ValueT> &values, qint32 const maximum = -1) {
+            auto const head{_head.load()};
+            auto count{_tail.loadAcquire() - head};
+            if (maximum >= 0 && count > static_cast<quint32>(maximum)) {
+                count = static_cast<quint32>(maximum);
+            }
+            values.reserve(values.size() + static_cast<qint32>(count));
+            for (quint32 index = 0; index < count; index++) {
+                values.append(_slots.at(static_cast<qint32>((head + index) & _mask)));
+            }
+            _head.storeRelease(head + count);
+            return static_cast<qint32>(count);
+        }
+
+    private: // methods
+        static quint32 roundUp(quint32 const depth) noexcept {
+            quint32 capacity{1};
+            while (capacity < depth && capacity < (1u << 30)) {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+    private: // variables
+        QVector<ValueT> _slots;
+        quint32 const _mask;
+        QAtomicInteger<quint32> _head{0};
+        QAtomicInteger<quint32> _tail{0};
+        QAtomicInteger<quint64> _dropped{0};
+    };
+}}
+
+#endif // CUTE_VR_INTERNAL_SPSC_RING
@@ -24,6 +24,8 @@ namespace CuteVR { namespace Internal {
         ~TestDevice() override = default;
 
     public: // methods
+        using BaseT::recordChange;
+
         Device::Category category() const noexcept override {
             return dummyCategory;
         }
@@ -0,0 +1,25 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_TRACKING_FRAME
+#define CUTE_VR_INTERNAL_TRACKING_FRAME
+
+#if defined(CUTE_VR_OPEN_VR) || defined(DOXYRUN)
+
+#include <openvr.h>
+
+namespace CuteVR { namespace Internal {
+    /// @private
+    /// @brief The tracking information that frame handlers receive, see DriverServer::announceFrame.
+    struct TrackingFrame {
+        vr::TrackedDevicePose_t const *poses{nullptr}; ///< The poses of all devices, indexed by device.
+        quint32 count{0}; ///< The number of poses, which is vr::k_unMaxTrackedDeviceCount.
+        vr::ETrackingUniverseOrigin universe{vr::TrackingUniverseRawAndUncalibrated}; ///< The origin of the poses.
+    };
+}}
+
+#endif // CUTE_VR_OPEN_VR
+
+#endif // CUTE_VR_INTERNAL_TRACKING_FRAME
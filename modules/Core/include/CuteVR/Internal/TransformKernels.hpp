@@ -0,0 +1,65 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_INTERNAL_TRANSFORM_KERNELS
+#define CUTE_VR_INTERNAL_TRANSFORM_KERNELS
+
+#include <QtGui/QQuaternion>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Internal/Simd.hpp>
+
+namespace CuteVR { namespace Internal {
+    /// @internal@brief Batched quaternion and vector math over packed arrays.
+    /// @details Every kernel processes `count` elements at once, the vectorized path handles four elements per
+    /// iteration and the remainder is done by the portable scalar path. The results agree with the scalar functions of
+    /// QQuaternion within single precision rounding, but are not bit-identical since the operations are ordered
+    /// differently. The output may be the same array as any input.
+    namespace TransformKernels {
+        using Simd::InstructionSet;
+
+        /// @internal@brief Rigid transform that first rotates and then translates.
+        struct alignas(16) Rigid {
+            QQuaternion rotation{};
+            alignas(16) QVector3D translation{};
+        };
+
+        /// @internal@brief Normalized linear interpolation along the shortest path, like QQuaternion::nlerp.
+        /// @param from The quaternions at weight zero.
+        /// @param to The quaternions at weight one.
+        /// @param weights The interpolation weight of each element.
+        void nlerp(QQuaternion const *from, QQuaternion const *to, float const *weights, QQuaternion *result,
+                   qint32 count, InstructionSet set = Simd::supported());
+
+        /// @internal@brief Spherical linear interpolation along the shortest path, like QQuaternion::slerp.
+        /// @param from The quaternions at weight zero.
+        /// @param to The quaternions at weight one.
+        /// @param weights The interpolation weight of each element.
+        void slerp(QQuaternion const *from, QQuaternion const *to, float const *weights, QQuaternion *result,
+                   qint32 count, InstructionSet set = Simd::supported());
+
+        /// @internal@brief Hamilton product of each pair of quaternions, like `left * right`.
+        void multiply(QQuaternion const *left, QQuaternion const *right, QQuaternion *result, qint32 count,
+                      InstructionSet set = Simd::supported());
+
+        /// @internal@brief Rotates each vector by a unit quaternion, like QQuaternion::rotatedVector.
+        void rotate(QQuaternion const *rotations, QVector3D const *vectors, QVector3D *result, qint32 count,
+                    InstructionSet set = Simd::supported());
+
+        /// @internal@brief Extracts the rotation of 4x4 matrices, like QQuaternion::fromRotationMatrix.
+        /// @param matrices 16 floats per matrix in column-major order, as written by PoseBatch::toMatrices.
+        void fromMatrices(float const *matrices, QQuaternion *result, qint32 count,
+                          InstructionSet set = Simd::supported());
+
+        /// @internal@brief Composes each pair of rigid transforms, so that the result applies `right` first.
+        void compose(Rigid const *left, Rigid const *right, Rigid *result, qint32 count,
+                     InstructionSet set = Simd::supported());
+
+        /// @internal@brief Inverts rigid transforms with unit rotations.
+        void invert(Rigid const *rigids, Rigid *result, qint32 count, InstructionSet set = Simd::supported());
+    }
+}}
+
+#endif // CUTE_VR_INTERNAL_TRANSFORM_KERNELS
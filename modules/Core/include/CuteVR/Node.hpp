@@ -0,0 +1,70 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_NODE
+#define CUTE_VR_NODE
+
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Device.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR {
+    class System;
+
+    /// @brief This class publishes the devices of a local system to an aggregating system on another computer.
+    /// @details Setups with several tracking computers run a node on each of them, while a single system aggregates
+    /// all nodes, see Configurations::Core::Feature::nodeAggregation. There, every node becomes a cell of its own and
+    /// its devices appear as Devices::Proxy.
+    ///
+    /// Each publication sends all devices together with their cell poses as a single UDP datagram, which is tagged
+    /// with an increasing sequence number. Sending never blocks, and a lost datagram is simply superseded by the next
+    /// one, hence a node usually publishes once per frame right after the update of its system.
+    class Node {
+    public: // constructor/destructor
+        /// @param identifier The identifier of this node from 1 to 65535, which is the cell of its devices on the hub.
+        /// @param hub The address of the computer that runs the aggregating system.
+        /// @param port The UDP port of the aggregating system, `0` for Configurations::Core::Parameter::nodePort.
+        Node(Identifier identifier, QString const &hub, quint16 port = 0);
+
+        ~Node();
+
+        Q_DISABLE_COPY(Node)
+
+    public: // getter
+        /// @return The sequence number of the last published frame, `0` if none has been published yet.
+        quint32 sequence() const noexcept;
+
+    public: // methods
+        /// @brief Publishes devices together with their poses as one frame.
+        /// @param devices The devices to publish, whereby proxies of other nodes are left out.
+        /// @param poses The poses of the devices in cell coordinates, devices without one are published with a pose of
+        /// unknown validity.
+        /// @return `true` if the frame has been handed over to the network.
+        bool publish(QMap<Identifier, QSharedPointer<Device>> const &devices,
+                     QMap<Identifier, Components::CompactPose> const &poses);
+
+        /// @brief Publishes the devices and cell poses of an updated system as one frame.
+        /// @details If Configurations::Core::Feature::cell is disabled, the system has no cell poses, hence the poses
+        /// of the tracked devices themselves are published, as of their last update.
+        /// @return `true` if the frame has been handed over to the network.
+        bool publish(System const &system);
+
+    public: // variables
+        CuteVR::Identifier const identifier{};
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}
+
+#endif // CUTE_VR_NODE
@@ -0,0 +1,118 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#ifndef CUTE_VR_SPATIAL_INDEX
+#define CUTE_VR_SPATIAL_INDEX
+
+#include <limits>
+#include <QtCore/QList>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
+#include <QtGui/QMatrix4x4>
+#include <QtGui/QVector3D>
+
+#include <CuteVR/Components/CompactPose.hpp>
+#include <CuteVR/Interface/Updatable.hpp>
+#include <CuteVR/Component.hpp>
+#include <CuteVR/Identifier.hpp>
+
+namespace CuteVR {
+    /// @brief This class answers spatial queries against many static zones at once.
+    /// @details A zone is a geometry component that is placed by a rigid transform, e.g. an interaction zone in the
+    /// coordinate system of a cell. The zones are organized in a bounding volume hierarchy, so that a query visits only
+    /// the few zones near to it. Every query takes a whole batch, typically one entry per controller pose of a frame.
+    ///
+    /// Changes of the zones become visible to the queries with the next update. Zones that have only been moved cause
+    /// a refit of the hierarchy, which is cheap, whereas inserted or removed zones cause a rebuild. A rebuild happens
+    /// as well if the refits have degraded the hierarchy too much.
+    /// @note Supported are all geometries that implement Interface::Volumetric.
+    class SpatialIndex :
+            public Interface::Updatable {
+    public: // types
+        /// @brief The geometry of a zone.
+        using Geometry = QSharedPointer<CategorizedComponent<Component::Category::geometry>>;
+
+        /// @brief A ray that starts at an origin and runs along a normalized direction.
+        struct Ray {
+            QVector3D origin{}; ///< The origin of the ray.
+            QVector3D direction{0.0f, 0.0f, -1.0f}; ///< The normalized direction of the ray.
+        };
+
+        /// @brief The zone that answers a query for one entry of a batch.
+        struct Hit {
+            Identifier zone{invalidIdentifier}; ///< The zone, which is invalid if no zone answers the query.
+            qreal distance{std::numeric_limits<qreal>::infinity()}; ///< The distance to the zone in meters.
+        };
+
+    public: // constructor/destructor
+        SpatialIndex();
+
+        ~SpatialIndex() override;
+
+        Q_DISABLE_COPY(SpatialIndex)
+
+    public: // getter
+        /// @return The number of zones that are visible to the queries. Thread-safe.
+        qint32 size() const;
+
+    public: // setter
+        /// @brief Inserts a zone or replaces the one with the same identifier.
+        /// @param zone The identifier of the zone.
+        /// @param geometry The geometry of the zone, which must not be modified while it is indexed.
+        /// @param transform The rigid transform from the coordinate system of the geometry into that of the index.
+        /// @return `true` if the geometry is supported. Thread-safe.
+        bool insert(Identifier zone, Geometry const &geometry, QMatrix4x4 const &transform);
+
+        /// @brief Moves an already inserted zone.
+        /// @param zone The identifier of the zone.
+        /// @param transform The new rigid transform from the coordinate system of the geometry into that of the index.
+        /// @return `true` if the zone is known. Thread-safe.
+        bool move(Identifier zone, QMatrix4x4 const &transform);
+
+        /// @brief Removes a zone.
+        /// @param zone The identifier of the zone.
+        /// @return `true` if the zone was known. Thread-safe.
+        bool remove(Identifier zone);
+
+    public: // methods
+        /// @brief Casts rays against the zones.
+        /// @param rays The rays in the coordinate system of the index.
+        /// @param maximumDistance Zones that are farther away along a ray are not hit.
+        /// @return The nearest zone along each ray together with the distance to it, which is zero if the origin lies
+        /// inside of the zone. Thread-safe.
+        QVector<Hit> rayCast(QVector<Ray> const &rays,
+                             qreal maximumDistance = std::numeric_limits<qreal>::infinity()) const;
+
+        /// @brief Searches the nearest zone of points.
+        /// @param points The points in the coordinate system of the index.
+        /// @param maximumDistance Zones that are farther away from a point are not found.
+        /// @return The zone with the smallest signed distance to each point together with that distance, which is
+        /// negative inside of the zone. Thread-safe.
+        QVector<Hit> nearest(QVector<QVector3D> const &points,
+                             qreal maximumDistance = std::numeric_limits<qreal>::infinity()) const;
+
+        /// @brief Searches the zones that overlap with spheres around points.
+        /// @param points The points in the coordinate system of the index.
+        /// @param radius The radius of the spheres, which is zero to search the zones that contain the points.
+        /// @return The ascending identifiers of all overlapping zones for each point. Thread-safe.
+        QVector<QList<Identifier>> overlap(QVector<QVector3D> const &points, qreal radius = 0.0) const;
+
+        /// @brief Derives the pointing ray of a pose, which runs along its negative z-axis like the controllers do.
+        static Ray ray(Components::CompactPose const &pose) noexcept;
+
+        void update() override;
+
+        bool isCurrent() const noexcept override;
+
+    private: // types
+        class Private;
+
+    private: // variables
+        QScopedPointer<Private> _private;
+    };
+}
+
+#endif // CUTE_VR_SPATIAL_INDEX
@@ -9,8 +9,10 @@
 #include <QtCore/QList>
 #include <QtCore/QMap>
 #include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
 #include <QtGui/QMatrix4x4>
 
+#include <CuteVR/Components/CompactPose.hpp>
 #include <CuteVR/Interface/Initializable.hpp>
 #include <CuteVR/Interface/Destroyable.hpp>
 #include <CuteVR/Interface/Updatable.hpp>
@@ -51,9 +53,47 @@ namespace CuteVR {
         /// Configurations::Core::Feature::cell and Configurations::Core::Feature::multiCell.
         Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::System::Cell>) cells
                    MEMBER cells NOTIFY cellsChanged FINAL)
+        /// @brief The poses of all connected devices in cell coordinates, which are those of the standing universe.
+        /// @details All poses of a frame are transformed at once, in whatever universe the driver reports them. Unlike
+        /// the poses of the devices themselves, they are only refreshed by #update. Functionality depends on
+        /// Configurations::Core::Feature::cell.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::CompactPose>) cellPoses
+                   MEMBER cellPoses FINAL)
+        /// @brief The poses of all connected devices in global coordinates.
+        /// @details The poses in cell coordinates transformed by the Cell::globalTransform of the surrounding cell. A
+        /// device without a surrounding cell keeps its pose in cell coordinates.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, CuteVR::Components::CompactPose>) globalPoses
+                   MEMBER globalPoses FINAL)
+        /// @brief The signed distances in meters of all tracked devices to the boundary of their cell.
+        /// @details The distances are negative inside of the boundary. Tracking references and devices without a valid
+        /// pose are not evaluated, just like devices in cells without a boundary geometry. Like the poses, they are
+        /// refreshed by #update, which also emits #boundaryStateChanged.
+        Q_PROPERTY(ARG(QMap<CuteVR::Identifier, qreal>) boundaryDistances
+                   MEMBER boundaryDistances FINAL)
 
     public: // types
+        /// @brief The coordinate systems in which the driver reports tracking information.
+        enum class TrackingUniverse :
+                quint8 {
+            seated = 0, ///< Relative to the seated zero pose, which the user can reset.
+            standing = 1, ///< Relative to the calibrated standing zero pose, which is used for cell coordinates.
+            raw = 2 ///< The uncalibrated coordinates of the tracking hardware.
+        };
+        Q_ENUM(TrackingUniverse)
+
+        /// @brief The position of a device relative to the boundary of its cell.
+        enum class BoundaryState :
+                quint8 {
+            inside, ///< Farther inside than Configurations::Core::Parameter::boundaryNearDistance.
+            near, ///< Inside, but closer to the boundary than Configurations::Core::Parameter::boundaryNearDistance.
+            outside ///< Outside of the boundary.
+        };
+        Q_ENUM(BoundaryState)
+
         /// @brief An equipment that belongs to one user or player.
+        /// @details With Configurations::Core::Feature::multiEquipment every head-mounted display forms an equipment
+        /// of its own, and each controller moves to the equipment of the user that holds it, judged by the distance
+        /// and the common motion over the last frames. Such a move is signaled as a change of both equipments.
         struct Equipment {
             Identifier identifier{invalidIdentifier}; ///< An identifier to to distinguish this equipment from others.
             QSet<Identifier> headMountedDisplays{}; ///< Assigned head-mounted display(s).
@@ -79,16 +119,33 @@ namespace CuteVR {
         ///      ●─────────●
         ///          a/x
         /// @endcode
+        ///
+        /// The local devices are in cell `0`. With Configurations::Core::Feature::nodeAggregation every remote Node
+        /// becomes the cell with its identifier, whose devices are Devices::Proxy and whose head-mounted displays,
+        /// audio setups and controllers form a single equipment. Each node tracks in a standing universe of its own,
+        /// which is registered to the others by the global transform of its cell, see #setGlobalTransform.
         struct Cell {
+            /// @brief The rigid transform of a geometry into cell coordinates together with the geometry.
+            /// @details The geometry is shared, so that it keeps its concrete type, and is null if there is none.
+            using Boundary = QPair<QMatrix4x4, QSharedPointer<CategorizedComponent<Component::Category::geometry>>>;
+
             Identifier identifier{invalidIdentifier}; ///< An identifier to to distinguish this cell from others.
             QSet<Identifier> trackingReferences{}; ///< Tracking references for the cell.
             QSet<Identifier> trackers{}; ///< Trackers in the cell.
             QSet<Identifier> equipments{}; ///< Equipments that is currently in this cell.
-            QPair<QMatrix4x4, CategorizedComponent<Component::Category::geometry>>
-                    boundary{}; ///< The boundary of the cell, units are meters.
+            Boundary boundary{}; ///< The boundary of the cell, units are meters.
             QMatrix4x4 globalTransform{}; ///< Transformation of this cell into a global coordinate system.
         };
 
+        /// @brief Devices that were added to or removed from the system within a single transaction.
+        /// @details A device that was reactivated is listed in both. While Configurations::Core::Feature::devicePool is
+        /// enabled, a reactivated device with the same serial number in the same slot is the very same object as
+        /// before, so that shared pointers of consumers stay valid across reconnects.
+        struct Delta {
+            QList<Identifier> added{}; ///< Devices that are new to the system.
+            QList<Identifier> removed{}; ///< Devices that are no longer part of the system.
+        };
+
     public: // constructor/destructor
         System();
 
@@ -119,6 +176,27 @@ namespace CuteVR {
         /// @return The cell which surrounds the device, or nothing.
         Extension::Optional<Identifier> cell(Identifier device) const noexcept;
 
+        /// @brief Query the transform between two tracking universes.
+        /// @details The transforms are cached until the driver announces a change of the chaperone or a reset of the
+        /// seated zero pose.
+        /// @param from The universe to transform from.
+        /// @param to The universe to transform into.
+        /// @return The rigid transform, or the identity if the system is not initialized.
+        QMatrix4x4 universeTransform(TrackingUniverse from, TrackingUniverse to) const;
+
+        /// @brief Query the UDP port on which the system aggregates nodes.
+        /// @see Configurations::Core::Parameter::nodePort
+        /// @return The port, or `0` if the system does not listen for nodes or the port could not be bound.
+        quint16 nodePort() const noexcept;
+
+    public: // setter
+        /// @brief Sets the transformation of a cell into the global coordinate system, see Cell::globalTransform.
+        /// @details The transform is kept for cells that do not exist yet and is taken over once they are created. It
+        /// applies to the #globalPoses from the next tracking frame after the next #update on.
+        /// @param cell The cell to be transformed.
+        /// @param transform The rigid transform of the cell.
+        void setGlobalTransform(Identifier cell, QMatrix4x4 const &transform);
+
     public: // methods
         void destroy() override;
 
@@ -136,6 +214,9 @@ namespace CuteVR {
         QMap<CuteVR::Identifier, QSharedPointer<CuteVR::Device>> devices{};
         QMap<CuteVR::Identifier, CuteVR::System::Equipment> equipments{};
         QMap<CuteVR::Identifier, CuteVR::System::Cell> cells{};
+        QMap<CuteVR::Identifier, CuteVR::Components::CompactPose> cellPoses{};
+        QMap<CuteVR::Identifier, CuteVR::Components::CompactPose> globalPoses{};
+        QMap<CuteVR::Identifier, qreal> boundaryDistances{};
 
     private: // types
         class Private;
@@ -161,6 +242,15 @@ namespace CuteVR {
 
         /// @signal{individual cell}
         void cellChanged(CuteVR::Identifier, CuteVR::System::Cell);
+
+        /// @brief Is emitted once per transaction in which devices were (de)activated.
+        /// @details (De)activations are collected for Configurations::Core::Parameter::hotplugWindow milliseconds and
+        /// applied at once, the map and item signals are then emitted only once per transaction as well.
+        void devicesHotplugged(CuteVR::System::Delta);
+
+        /// @brief Is emitted by #update with cell, device and new state whenever a device changes its BoundaryState.
+        /// @details A device that is evaluated for the first time is considered to have been inside before.
+        void boundaryStateChanged(CuteVR::Identifier, CuteVR::Identifier, CuteVR::System::BoundaryState);
     };
 
     /// @equality{equipments};
@@ -180,4 +270,6 @@ Q_DECLARE_METATYPE(CuteVR::System::Equipment)
 
 Q_DECLARE_METATYPE(CuteVR::System::Cell)
 
+Q_DECLARE_METATYPE(CuteVR::System::Delta)
+
 #endif // CUTE_VR_SYSTEM
@@ -0,0 +1,97 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Cone.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cone;
+using Interface::Cloneable;
+using Internal::Intersection::square;
+
+namespace Intersection = Internal::Intersection;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<Cone>();
+        }
+    } registerMetaTypes; // NOLINT
+
+    /// distance of the point (x, y) to the segment from (ax, ay) to (bx, by) in a plane
+    inline qreal segment(qreal const x, qreal const y, qreal const ax, qreal const ay, qreal const bx,
+                         qreal const by) noexcept {
+        auto const dx{bx - ax};
+        auto const dy{by - ay};
+        auto const length{square(dx) + square(dy)};
+        auto t{qreal{0}};
+        if (length > qreal{0}) {
+            t = qBound(qreal{0}, ((x - ax) * dx + (y - ay) * dy) / length, qreal{1});
+        }
+        return std::sqrt(square(x - ax - t * dx) + square(y - ay - t * dy));
+    }
+}
+
+QSharedPointer<Cloneable> Cone::clone() const {
+    return QSharedPointer<Cloneable>{new Cone{*this}};
+}
+
+bool Cone::equals(Component const &other) const noexcept {
+    if (auto another = dynamic_cast<Cone const *>(&other)) {
+        return another && CategorizedComponent::equals(other) &&
+               (r == another->r) &&
+               (h == another->h);
+    }
+    return false;
+}
+
+QDataStream &Cone::serialize(QDataStream &stream) const {
+    return CategorizedComponent::serialize(stream) << r << h;
+}
+
+QDataStream &Cone::deserialize(QDataStream &stream) {
+    return CategorizedComponent::deserialize(stream) >> r >> h;
+}
+
+qreal Cone::distance(QVector3D const &point) const noexcept {
+    // the cone is a right triangle in the plane of the radial distance and the height, rotated about the y-axis, so
+    // that its surface consists of the base and the slant side of the triangle
+    auto const radial{std::sqrt(square(point.x()) + square(point.z()))};
+    auto const y{static_cast<qreal>(point.y())};
+    auto const base{-h / 4};
+    auto const apex{h * 3 / 4};
+    auto const nearest{qMin(segment(radial, y, 0, base, r, base), segment(radial, y, r, base, 0, apex))};
+    return y >= base && radial * h <= r * (apex - y) ? -nearest : nearest;
+}
+
+bool Cone::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Cone::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    if (h <= qreal{0}) {
+        return Intersection::miss;
+    }
+    // the double cone h^2 * (x^2 + z^2) <= r^2 * (apex - y)^2 is reduced to its lower half by the slab of the height
+    auto const base{-h / 4};
+    auto const apex{h * 3 / 4};
+    auto const w{apex - origin.y()};
+    auto const radial{qreal{origin.x()} * direction.x() + qreal{origin.z()} * direction.z()};
+    return Intersection::quadric(square(h) * (square(direction.x()) + square(direction.z())) -
+                                 square(r) * square(direction.y()),
+                                 2 * (square(h) * radial + square(r) * w * direction.y()),
+                                 square(h) * (square(origin.x()) + square(origin.z())) - square(r) * square(w),
+                                 Intersection::slab(origin.y(), direction.y(), base, apex));
+}
+
+QPair<QVector3D, QVector3D> Cone::bounds() const noexcept {
+    auto const radius{static_cast<float>(r)};
+    return {QVector3D{-radius, static_cast<float>(-h / 4), -radius},
+            QVector3D{radius, static_cast<float>(h * 3 / 4), radius}};
+}
+
+#include "../../../include/CuteVR/Components/Geometry/moc_Cone.cpp" // LEGACY: CMake 3.8 ignores include paths
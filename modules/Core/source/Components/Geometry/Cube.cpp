@@ -4,11 +4,14 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <CuteVR/Components/Geometry/Cube.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
 
 using namespace CuteVR;
 using Components::Geometry::Cube;
 using Interface::Cloneable;
 
+namespace Intersection = Internal::Intersection;
+
 namespace {
     struct RegisterMetaTypes {
         RegisterMetaTypes() {
@@ -37,4 +40,22 @@ QDataStream &Cube::deserialize(QDataStream &stream) {
     return CategorizedComponent::deserialize(stream) >> a;
 }
 
+qreal Cube::distance(QVector3D const &point) const noexcept {
+    return Intersection::boxDistance(point, a / 2, a / 2, a / 2);
+}
+
+bool Cube::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Cube::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    auto const upper{bounds().second};
+    return Intersection::entry(Intersection::box(origin, direction, -upper, upper));
+}
+
+QPair<QVector3D, QVector3D> Cube::bounds() const noexcept {
+    auto const half{static_cast<float>(a / 2)};
+    return {QVector3D{-half, -half, -half}, QVector3D{half, half, half}};
+}
+
 #include "../../../include/CuteVR/Components/Geometry/moc_Cube.cpp" // LEGACY: CMake 3.8 ignores include paths
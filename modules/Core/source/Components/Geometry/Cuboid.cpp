@@ -4,11 +4,14 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
 
 using namespace CuteVR;
 using Components::Geometry::Cuboid;
 using Interface::Cloneable;
 
+namespace Intersection = Internal::Intersection;
+
 namespace {
     struct RegisterMetaTypes {
         RegisterMetaTypes() {
@@ -39,4 +42,22 @@ QDataStream &Cuboid::deserialize(QDataStream &stream) {
     return CategorizedComponent::deserialize(stream) >> a >> b >> c;
 }
 
+qreal Cuboid::distance(QVector3D const &point) const noexcept {
+    return Intersection::boxDistance(point, a / 2, b / 2, c / 2);
+}
+
+bool Cuboid::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Cuboid::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    auto const upper{bounds().second};
+    return Intersection::entry(Intersection::box(origin, direction, -upper, upper));
+}
+
+QPair<QVector3D, QVector3D> Cuboid::bounds() const noexcept {
+    QVector3D const half{static_cast<float>(a / 2), static_cast<float>(b / 2), static_cast<float>(c / 2)};
+    return {-half, half};
+}
+
 #include "../../../include/CuteVR/Components/Geometry/moc_Cuboid.cpp" // LEGACY: CMake 3.8 ignores include paths
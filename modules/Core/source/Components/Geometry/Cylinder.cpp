@@ -0,0 +1,71 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Cylinder.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cylinder;
+using Interface::Cloneable;
+using Internal::Intersection::square;
+
+namespace Intersection = Internal::Intersection;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<Cylinder>();
+        }
+    } registerMetaTypes; // NOLINT
+}
+
+QSharedPointer<Cloneable> Cylinder::clone() const {
+    return QSharedPointer<Cloneable>{new Cylinder{*this}};
+}
+
+bool Cylinder::equals(Component const &other) const noexcept {
+    if (auto another = dynamic_cast<Cylinder const *>(&other)) {
+        return another && CategorizedComponent::equals(other) &&
+               (r == another->r) &&
+               (h == another->h);
+    }
+    return false;
+}
+
+QDataStream &Cylinder::serialize(QDataStream &stream) const {
+    return CategorizedComponent::serialize(stream) << r << h;
+}
+
+QDataStream &Cylinder::deserialize(QDataStream &stream) {
+    return CategorizedComponent::deserialize(stream) >> r >> h;
+}
+
+qreal Cylinder::distance(QVector3D const &point) const noexcept {
+    // the cylinder is a rectangle in the plane of the radial distance and the height, rotated about the y-axis
+    auto const radial{std::sqrt(square(point.x()) + square(point.z())) - r};
+    auto const axial{qAbs(static_cast<qreal>(point.y())) - h / 2};
+    auto const outside{std::sqrt(square(qMax(radial, qreal{0})) + square(qMax(axial, qreal{0})))};
+    return outside + qMin(qMax(radial, axial), qreal{0});
+}
+
+bool Cylinder::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Cylinder::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    return Intersection::quadric(square(direction.x()) + square(direction.z()),
+                                 2 * (qreal{origin.x()} * direction.x() + qreal{origin.z()} * direction.z()),
+                                 square(origin.x()) + square(origin.z()) - square(r),
+                                 Intersection::slab(origin.y(), direction.y(), -h / 2, h / 2));
+}
+
+QPair<QVector3D, QVector3D> Cylinder::bounds() const noexcept {
+    QVector3D const half{static_cast<float>(r), static_cast<float>(h / 2), static_cast<float>(r)};
+    return {-half, half};
+}
+
+#include "../../../include/CuteVR/Components/Geometry/moc_Cylinder.cpp" // LEGACY: CMake 3.8 ignores include paths
@@ -0,0 +1,92 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Ellipsoid.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Ellipsoid;
+using Interface::Cloneable;
+using Internal::Intersection::square;
+
+namespace Intersection = Internal::Intersection;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<Ellipsoid>();
+        }
+    } registerMetaTypes; // NOLINT
+}
+
+QSharedPointer<Cloneable> Ellipsoid::clone() const {
+    return QSharedPointer<Cloneable>{new Ellipsoid{*this}};
+}
+
+bool Ellipsoid::equals(Component const &other) const noexcept {
+    if (auto another = dynamic_cast<Ellipsoid const *>(&other)) {
+        return another && CategorizedComponent::equals(other) &&
+               (a == another->a) &&
+               (b == another->b) &&
+               (c == another->c);
+    }
+    return false;
+}
+
+QDataStream &Ellipsoid::serialize(QDataStream &stream) const {
+    return CategorizedComponent::serialize(stream) << a << b << c;
+}
+
+QDataStream &Ellipsoid::deserialize(QDataStream &stream) {
+    return CategorizedComponent::deserialize(stream) >> a >> b >> c;
+}
+
+qreal Ellipsoid::distance(QVector3D const &point) const noexcept {
+    if (a <= qreal{0} || b <= qreal{0} || c <= qreal{0}) {
+        return Intersection::miss;
+    }
+    // the point is scaled once onto the unit sphere and once more, the ratio of both corrects the first guess
+    auto const scaled{std::sqrt(square(point.x() / a) + square(point.y() / b) + square(point.z() / c))};
+    auto const gradient{std::sqrt(square(point.x() / (a * a)) + square(point.y() / (b * b)) +
+                                  square(point.z() / (c * c)))};
+    if (gradient <= qreal{0}) {
+        return -qMin(a, qMin(b, c));
+    }
+    auto const approximation{scaled * (scaled - 1) / gradient};
+    if (approximation <= qreal{0}) {
+        return approximation;
+    }
+    // outside, the approximation falls short of the distance to the enclosing box for elongated ellipsoids
+    auto const box{std::sqrt(square(qMax(qAbs(static_cast<qreal>(point.x())) - a, qreal{0})) +
+                             square(qMax(qAbs(static_cast<qreal>(point.y())) - b, qreal{0})) +
+                             square(qMax(qAbs(static_cast<qreal>(point.z())) - c, qreal{0})))};
+    return qMax(approximation, box);
+}
+
+bool Ellipsoid::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Ellipsoid::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    if (a <= qreal{0} || b <= qreal{0} || c <= qreal{0}) {
+        return Intersection::miss;
+    }
+    // scaling the axes maps the ellipsoid onto the unit sphere without changing the parameters along the ray
+    QVector3D const scale{static_cast<float>(1 / a), static_cast<float>(1 / b), static_cast<float>(1 / c)};
+    auto const scaledOrigin{origin * scale};
+    auto const scaledDirection{direction * scale};
+    return Intersection::quadric(QVector3D::dotProduct(scaledDirection, scaledDirection),
+                                 2 * QVector3D::dotProduct(scaledOrigin, scaledDirection),
+                                 QVector3D::dotProduct(scaledOrigin, scaledOrigin) - 1, {});
+}
+
+QPair<QVector3D, QVector3D> Ellipsoid::bounds() const noexcept {
+    QVector3D const half{static_cast<float>(a), static_cast<float>(b), static_cast<float>(c)};
+    return {-half, half};
+}
+
+#include "../../../include/CuteVR/Components/Geometry/moc_Ellipsoid.cpp" // LEGACY: CMake 3.8 ignores include paths
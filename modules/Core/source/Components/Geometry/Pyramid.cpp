@@ -0,0 +1,142 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Pyramid.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Pyramid;
+using Interface::Cloneable;
+using Internal::Intersection::square;
+
+namespace Intersection = Internal::Intersection;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<Pyramid>();
+        }
+    } registerMetaTypes; // NOLINT
+
+    /// closest point of the triangle (a, b, c) to p, found by the voronoi region of p
+    inline QVector3D closest(QVector3D const &p, QVector3D const &a, QVector3D const &b, QVector3D const &c) noexcept {
+        auto const ab{b - a};
+        auto const ac{c - a};
+        auto const d1{QVector3D::dotProduct(ab, p - a)};
+        auto const d2{QVector3D::dotProduct(ac, p - a)};
+        if (d1 <= 0.0f && d2 <= 0.0f) {
+            return a;
+        }
+        auto const d3{QVector3D::dotProduct(ab, p - b)};
+        auto const d4{QVector3D::dotProduct(ac, p - b)};
+        if (d3 >= 0.0f && d4 <= d3) {
+            return b;
+        }
+        auto const vc{d1 * d4 - d3 * d2};
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            return a + ab * (d1 / (d1 - d3));
+        }
+        auto const d5{QVector3D::dotProduct(ab, p - c)};
+        auto const d6{QVector3D::dotProduct(ac, p - c)};
+        if (d6 >= 0.0f && d5 <= d6) {
+            return c;
+        }
+        auto const vb{d5 * d2 - d1 * d6};
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            return a + ac * (d2 / (d2 - d6));
+        }
+        auto const va{d3 * d6 - d5 * d4};
+        if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+        auto const denominator{va + vb + vc};
+        return a + ab * (vb / denominator) + ac * (vc / denominator);
+    }
+}
+
+QSharedPointer<Cloneable> Pyramid::clone() const {
+    return QSharedPointer<Cloneable>{new Pyramid{*this}};
+}
+
+bool Pyramid::equals(Component const &other) const noexcept {
+    if (auto another = dynamic_cast<Pyramid const *>(&other)) {
+        return another && CategorizedComponent::equals(other) &&
+               (a == another->a) &&
+               (b == another->b) &&
+               (c == another->c);
+    }
+    return false;
+}
+
+QDataStream &Pyramid::serialize(QDataStream &stream) const {
+    return CategorizedComponent::serialize(stream) << a << b << c;
+}
+
+QDataStream &Pyramid::deserialize(QDataStream &stream) {
+    return CategorizedComponent::deserialize(stream) >> a >> b >> c;
+}
+
+qreal Pyramid::distance(QVector3D const &point) const noexcept {
+    if (a <= qreal{0} || b <= qreal{0} || c <= qreal{0}) {
+        return Intersection::miss;
+    }
+    auto const base{-b / 4};
+    auto const apex{b * 3 / 4};
+    // the pyramid is symmetric, so the point is mirrored to the side of the positive x- and z-axis
+    auto const x{qAbs(static_cast<qreal>(point.x()))};
+    auto const y{static_cast<qreal>(point.y())};
+    auto const z{qAbs(static_cast<qreal>(point.z()))};
+    auto const sideX{(b * x + a / 2 * (y - apex)) / std::sqrt(square(b) + square(a / 2))};
+    auto const sideZ{(b * z + c / 2 * (y - apex)) / std::sqrt(square(b) + square(c / 2))};
+    auto const inside{qMax(base - y, qMax(sideX, sideZ))};
+    if (inside <= qreal{0}) {
+        // inside of a convex volume the nearest face is the one whose plane is nearest
+        return inside;
+    }
+    QVector3D const mirrored{static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+    QVector3D const top{0.0f, static_cast<float>(apex), 0.0f};
+    QVector3D const corner{static_cast<float>(a / 2), static_cast<float>(base), static_cast<float>(c / 2)};
+    QVector3D const cornerX{corner.x(), corner.y(), -corner.z()};
+    QVector3D const cornerZ{-corner.x(), corner.y(), corner.z()};
+    auto const toBase{std::sqrt(square(qMax(x - a / 2, qreal{0})) + square(y - base) +
+                                square(qMax(z - c / 2, qreal{0})))};
+    auto const toSideX{(mirrored - closest(mirrored, top, cornerX, corner)).length()};
+    auto const toSideZ{(mirrored - closest(mirrored, top, corner, cornerZ)).length()};
+    return qMin(toBase, static_cast<qreal>(qMin(toSideX, toSideZ)));
+}
+
+bool Pyramid::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Pyramid::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    if (a <= qreal{0} || b <= qreal{0} || c <= qreal{0}) {
+        return Intersection::miss;
+    }
+    // the pyramid is the intersection of the half-spaces above its base and below its four sides
+    auto const base{-b / 4};
+    auto const apex{b * 3 / 4};
+    auto const liftX{a / 2 * (origin.y() - apex)};
+    auto const liftZ{c / 2 * (origin.y() - apex)};
+    auto const climbX{a / 2 * direction.y()};
+    auto const climbZ{c / 2 * direction.y()};
+    auto interval{Intersection::halfSpace(base - origin.y(), -direction.y())};
+    for (auto const sign : {qreal{1}, qreal{-1}}) {
+        interval = Intersection::clip(interval, Intersection::halfSpace(sign * b * origin.x() + liftX,
+                                                                        sign * b * direction.x() + climbX));
+        interval = Intersection::clip(interval, Intersection::halfSpace(sign * b * origin.z() + liftZ,
+                                                                        sign * b * direction.z() + climbZ));
+    }
+    return Intersection::entry(interval);
+}
+
+QPair<QVector3D, QVector3D> Pyramid::bounds() const noexcept {
+    return {QVector3D{static_cast<float>(-a / 2), static_cast<float>(-b / 4), static_cast<float>(-c / 2)},
+            QVector3D{static_cast<float>(a / 2), static_cast<float>(b * 3 / 4), static_cast<float>(c / 2)}};
+}
+
+#include "../../../include/CuteVR/Components/Geometry/moc_Pyramid.cpp" // LEGACY: CMake 3.8 ignores include paths
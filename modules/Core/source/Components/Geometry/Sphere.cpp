@@ -3,11 +3,17 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <cmath>
+
 #include <CuteVR/Components/Geometry/Sphere.hpp>
+#include <CuteVR/Internal/Intersection.hpp>
 
 using namespace CuteVR;
 using Components::Geometry::Sphere;
 using Interface::Cloneable;
+using Internal::Intersection::square;
+
+namespace Intersection = Internal::Intersection;
 
 namespace {
     struct RegisterMetaTypes {
@@ -37,4 +43,23 @@ QDataStream &Sphere::deserialize(QDataStream &stream) {
     return CategorizedComponent::deserialize(stream) >> r;
 }
 
+qreal Sphere::distance(QVector3D const &point) const noexcept {
+    return std::sqrt(square(point.x()) + square(point.y()) + square(point.z())) - r;
+}
+
+bool Sphere::contains(QVector3D const &point) const noexcept {
+    return distance(point) <= qreal{0};
+}
+
+qreal Sphere::intersect(QVector3D const &origin, QVector3D const &direction) const noexcept {
+    return Intersection::quadric(QVector3D::dotProduct(direction, direction),
+                                 2 * QVector3D::dotProduct(origin, direction),
+                                 QVector3D::dotProduct(origin, origin) - square(r), {});
+}
+
+QPair<QVector3D, QVector3D> Sphere::bounds() const noexcept {
+    auto const radius{static_cast<float>(r)};
+    return {QVector3D{-radius, -radius, -radius}, QVector3D{radius, radius, radius}};
+}
+
 #include "../../../include/CuteVR/Components/Geometry/moc_Sphere.cpp" // LEGACY: CMake 3.8 ignores include paths
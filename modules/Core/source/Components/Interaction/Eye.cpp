@@ -4,9 +4,11 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <CuteVR/Components/Interaction/Eye.hpp>
+#include <CuteVR/Components/Interaction/EyeMatrices.hpp>
 
 using namespace CuteVR;
 using Components::Interaction::Eye;
+using Components::Interaction::EyeMatrices;
 using Interface::Cloneable;
 
 namespace {
@@ -14,6 +16,7 @@ namespace {
         RegisterMetaTypes() {
             qRegisterMetaType<Eye>();
             qRegisterMetaType<Eye::Type>();
+            qRegisterMetaType<EyeMatrices>();
         }
     } registerMetaTypes; // NOLINT
 }
@@ -0,0 +1,64 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Components/Output/DistortionMesh.hpp>
+
+using namespace CuteVR;
+using Components::Output::DistortionMesh;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<DistortionMesh>();
+        }
+    } registerMetaTypes; // NOLINT
+}
+
+namespace CuteVR { namespace Components { namespace Output {
+    bool operator==(DistortionMesh const &left, DistortionMesh const &right) noexcept {
+        if (left.resolution != right.resolution || left.vertices.size() != right.vertices.size() ||
+            left.indices != right.indices) {
+            return false;
+        }
+        for (auto index = 0; index < left.vertices.size(); index++) {
+            auto const &one{left.vertices.at(index)};
+            auto const &another{right.vertices.at(index)};
+            if (one.position != another.position || one.red != another.red || one.green != another.green ||
+                one.blue != another.blue) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    QDataStream &operator<<(QDataStream &stream, DistortionMesh const &mesh) {
+        stream << mesh.resolution << static_cast<quint32>(mesh.vertices.size());
+        for (auto const &vertex : mesh.vertices) {
+            stream << vertex.position << vertex.red << vertex.green << vertex.blue;
+        }
+        return stream << mesh.indices;
+    }
+
+    QDataStream &operator>>(QDataStream &stream, DistortionMesh &mesh) {
+        quint32 size{0};
+        stream >> mesh.resolution >> size;
+        // the sizes are not trusted, so that a corrupted stream cannot allocate arbitrary memory upfront
+        mesh.vertices.clear();
+        for (quint32 index = 0; index < size && stream.status() == QDataStream::Ok; index++) {
+            DistortionMesh::Vertex vertex{};
+            stream >> vertex.position >> vertex.red >> vertex.green >> vertex.blue;
+            mesh.vertices.append(vertex);
+        }
+        // same layout as a streamed QVector, which would resize to the stored size before reading any index
+        stream >> size;
+        mesh.indices.clear();
+        for (quint32 index = 0; index < size && stream.status() == QDataStream::Ok; index++) {
+            quint16 vertex{0};
+            stream >> vertex;
+            mesh.indices.append(vertex);
+        }
+        return stream;
+    }
+}}}
@@ -0,0 +1,41 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Components/Output/Haptic.hpp>
+
+using namespace CuteVR;
+using Components::Output::Haptic;
+using Interface::Cloneable;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<Haptic>();
+        }
+    } registerMetaTypes; // NOLINT
+}
+
+QSharedPointer<Cloneable> Haptic::clone() const {
+    return QSharedPointer<Cloneable>{new Haptic{*this}};
+}
+
+bool Haptic::equals(Component const &other) const noexcept {
+    if (auto another = dynamic_cast<Haptic const *>(&other)) {
+        return another && CategorizedComponent::equals(other) &&
+               (interval == another->interval) &&
+               (duration == another->duration);
+    }
+    return false;
+}
+
+QDataStream &Haptic::serialize(QDataStream &stream) const {
+    return CategorizedComponent::serialize(stream) << interval << duration;
+}
+
+QDataStream &Haptic::deserialize(QDataStream &stream) {
+    return CategorizedComponent::deserialize(stream) >> interval >> duration;
+}
+
+#include "../../../include/CuteVR/Components/Output/moc_Haptic.cpp" // LEGACY: CMake 3.8 ignores include paths
@@ -0,0 +1,28 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Components/Output/HiddenAreaMesh.hpp>
+
+using namespace CuteVR;
+using Components::Output::HiddenAreaMesh;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<HiddenAreaMesh>();
+            qRegisterMetaType<HiddenAreaMesh::Type>();
+        }
+    } registerMetaTypes; // NOLINT
+}
+
+namespace CuteVR { namespace Components { namespace Output {
+    QDataStream &operator<<(QDataStream &stream, HiddenAreaMesh const &mesh) {
+        return stream << static_cast<quint8>(mesh.type) << mesh.vertices << mesh.indices;
+    }
+
+    QDataStream &operator>>(QDataStream &stream, HiddenAreaMesh &mesh) {
+        return stream >> reinterpret_cast<quint8 &>(mesh.type) >> mesh.vertices >> mesh.indices;
+    }
+}}}
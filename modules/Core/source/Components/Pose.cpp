@@ -3,9 +3,11 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <CuteVR/Components/CompactPose.hpp>
 #include <CuteVR/Components/Pose.hpp>
 
 using namespace CuteVR;
+using Components::CompactPose;
 using Components::Pose;
 using Interface::Cloneable;
 
@@ -13,6 +15,7 @@ namespace {
     struct RegisterMetaTypes {
         RegisterMetaTypes() {
             qRegisterMetaType<Pose>();
+            qRegisterMetaType<CompactPose>();
             qRegisterMetaType<Extension::Optional<QVector3D>>();
         }
     } registerMetaTypes; // NOLINT
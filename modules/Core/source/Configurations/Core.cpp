@@ -4,12 +4,17 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 
 using namespace CuteVR;
 using Configurations::Core::Feature;
 using Configurations::Core::Parameter;
 using Configurations::feature;
 using Configurations::parameter;
+using Extension::CuteException;
+using Extension::Optional;
+
+namespace Profile = Configurations::Core::Profile;
 
 namespace {
     struct RegisterMetaTypes {
@@ -19,23 +24,55 @@ namespace {
         }
     } registerMetaTypes; // NOLINT
 
+    // registers a feature while respecting its compile-time binding, the state of bound features never changes
+    void registerBoundFeature(Feature const coreFeature, bool const enabledByDefault, bool const supported,
+                              bool const supportedNative) {
+        auto const bound{Profile::binding(coreFeature)};
+        if (bound == Profile::Binding::dynamic) {
+            ConfigurationServer::registerFeature(feature(coreFeature), enabledByDefault, supported, supportedNative);
+            return;
+        }
+        auto const enabled{bound == Profile::Binding::enabled};
+        ConfigurationServer::registerFeature(
+                feature(coreFeature), enabled, enabled, enabled && supportedNative,
+                [enabled](bool const state) -> Optional<QSharedPointer<CuteException>> {
+                    if (state != enabled) {
+                        return Optional<QSharedPointer<CuteException>>{
+                                ConfigurationServer::FeatureValidationFailed::create(
+                                        CuteException::Severity::warning, 0,
+                                        QString{"Feature is bound by the compile-time profile '%1'."}
+                                                .arg(Profile::name))};
+                    }
+                    return {};
+                });
+    }
+
     struct RegisterCoreConfiguration {
         RegisterCoreConfiguration() {
             // TODO: add validators
             // general features
-            ConfigurationServer::registerFeature(feature(Feature::tracking), true, true, true);
-            ConfigurationServer::registerFeature(feature(Feature::events), true, true, true);
-            ConfigurationServer::registerFeature(feature(Feature::eventTracking), false, true, true);
-            ConfigurationServer::registerFeature(feature(Feature::cell), true, true, false);
+            registerBoundFeature(Feature::tracking, true, true, true);
+            registerBoundFeature(Feature::events, true, true, true);
+            registerBoundFeature(Feature::eventTracking, false, true, true);
+            registerBoundFeature(Feature::cell, true, true, false);
             ConfigurationServer::registerFeature(feature(Feature::multiCell), false, false, false);
-            ConfigurationServer::registerFeature(feature(Feature::equipment), true, true, false);
-            ConfigurationServer::registerFeature(feature(Feature::multiEquipment), false, false, false);
+            registerBoundFeature(Feature::equipment, true, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::multiEquipment), false, true, false);
             ConfigurationServer::registerFeature(feature(Feature::smartFocus), false, false, false);
             ConfigurationServer::registerFeature(feature(Feature::forcedFocus), false, false, false);
-            ConfigurationServer::registerFeature(feature(Feature::linearVelocity), false, true, true);
-            ConfigurationServer::registerFeature(feature(Feature::linearAcceleration), false, true, false);
-            ConfigurationServer::registerFeature(feature(Feature::angularVelocity), false, true, true);
-            ConfigurationServer::registerFeature(feature(Feature::angularAcceleration), false, true, false);
+            registerBoundFeature(Feature::linearVelocity, false, true, true);
+            registerBoundFeature(Feature::linearAcceleration, false, true, false);
+            registerBoundFeature(Feature::angularVelocity, false, true, true);
+            registerBoundFeature(Feature::angularAcceleration, false, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::driverThread), false, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::propertyCache), true, true, false);
+            // one change set per cycle replaces the flood of item and map signals, which are opt-in
+            registerBoundFeature(Feature::changeSets, true, true, false);
+            registerBoundFeature(Feature::itemSignals, false, true, false);
+            registerBoundFeature(Feature::mapSignals, false, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::inputCapture), false, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::devicePool), false, true, false);
+            ConfigurationServer::registerFeature(feature(Feature::nodeAggregation), false, true, false);
             // device features
             ConfigurationServer::registerFeature(feature(Feature::inhibitDeviceRegistration), false, true, false);
             ConfigurationServer::registerFeature(feature(Feature::trackingReferenceGeneric), true, true, true);
@@ -44,13 +81,33 @@ namespace {
             ConfigurationServer::registerFeature(feature(Feature::controllerGeneric), true, true, true);
             ConfigurationServer::registerFeature(feature(Feature::trackerGeneric), true, true, true);
             // render features
-            ConfigurationServer::registerFeature(feature(Feature::drawing), false, true, true);
+            registerBoundFeature(Feature::drawing, false, true, true);
             // general parameters
             ConfigurationServer::registerParameter(parameter(Parameter::driverLockWarn), {5000}, QVariant::UInt);
             ConfigurationServer::registerParameter(parameter(Parameter::driverLockAbort), {5000}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::hotplugWindow), {50}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::inputCaptureRate), {1000}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::inputCaptureDepth), {4096}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::cycleBudget), {0}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::devicePoolDepth), {16}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::headMountedDisplayProfile), {0},
+                                                   QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::controllerProfile), {0}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::trackerProfile), {0}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::trackingReferenceProfile), {0},
+                                                   QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::boundaryHeight), {2.5}, QVariant::Double);
+            ConfigurationServer::registerParameter(parameter(Parameter::boundaryNearDistance), {0.4}, QVariant::Double);
+            ConfigurationServer::registerParameter(parameter(Parameter::equipmentWindow), {45}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::equipmentHysteresis), {0.15}, QVariant::Double);
+            ConfigurationServer::registerParameter(parameter(Parameter::equipmentPersistence), {20}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::nodePort), {47600}, QVariant::UInt);
+            ConfigurationServer::registerParameter(parameter(Parameter::nodeTimeout), {500}, QVariant::UInt);
             // render parameters
             ConfigurationServer::registerParameter(parameter(Parameter::zNear), {0.01}, QVariant::Double);
             ConfigurationServer::registerParameter(parameter(Parameter::zFar), {1000.0}, QVariant::Double);
+            ConfigurationServer::registerParameter(parameter(Parameter::lensMeshDirectory), {QString{}},
+                                                   QVariant::String);
         }
     } registerCoreConfiguration; // NOLINT
 }
@@ -4,22 +4,32 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <cassert>
+#include <QtCore/QMutex>
 #include <QtCore/QReadWriteLock>
 #include <openvr.h>
 
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Internal/DefaultDescriptionsProvider.hpp>
 #include <CuteVR/Device.hpp>
 #include <CuteVR/DriverServer.hpp>
 
 using namespace CuteVR;
 using Components::Description;
+using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
+using Configurations::parameter;
 using Extension::Optional;
 using Internal::DefaultDescriptionsProvider;
 
+namespace Profile = Configurations::Core::Profile;
+
 namespace {
     struct RegisterMetaTypes {
         RegisterMetaTypes() {
             qRegisterMetaType<Device::Category>();
+            qRegisterMetaType<Device::ChangeSet>();
+            qRegisterMetaType<Device::ProviderProfile>();
             qRegisterMetaType<QMap<Identifier, Description>>();
         }
     } registerMetaTypes; // NOLINT
@@ -52,6 +62,9 @@ public: // variables
     bool current{true};
     QMap<Identifier, Description> descriptionsCurrent{};
     QMap<Description::Type, Identifier> descriptionsByType{};
+    QMutex changeLock{};
+    ChangeSet changes{};
+    QMetaObject::Connection polledConnection{};
 };
 
 Device::Device(Identifier const identifier) :
@@ -67,6 +80,32 @@ Optional<Identifier> Device::description(Description::Type const type) const noe
            : Extension::Optional<Identifier>{};
 }
 
+Device::ProviderProfile Device::providerProfile() const noexcept {
+    Parameter configured{Parameter::undefined};
+    switch (category()) {
+        case Category::headMountedDisplay: {
+            configured = Parameter::headMountedDisplayProfile;
+            break;
+        }
+        case Category::controller: {
+            configured = Parameter::controllerProfile;
+            break;
+        }
+        case Category::tracker: {
+            configured = Parameter::trackerProfile;
+            break;
+        }
+        case Category::trackingReference: {
+            configured = Parameter::trackingReferenceProfile;
+            break;
+        }
+        default: return ProviderProfile::full;
+    }
+    auto const value{ConfigurationServer::value(parameter(configured)).right(QVariant{0}).toUInt()};
+    return value <= static_cast<quint32>(ProviderProfile::inputOnly) ? static_cast<ProviderProfile>(value)
+                                                                     : ProviderProfile::full;
+}
+
 Device::Category Device::category() const noexcept {
     return Category::undefined;
 }
@@ -75,6 +114,11 @@ void Device::destroy() {
     QWriteLocker{&_private->initializeLock};
     if (_private->initialized) {
         _private->descriptionsProvider.clear();
+        QObject::disconnect(_private->polledConnection);
+        {
+            QMutexLocker locker{&_private->changeLock};
+            _private->changes = {};
+        }
         _private->initialized = false;
     }
 }
@@ -99,20 +143,43 @@ void Device::initialize() {
                 _private->descriptionsByType.insert(description.type, description.identifier);
             }
         }
-        _private->descriptionsProvider
-                .reset(new DefaultDescriptionsProvider{identifier, [&](Description const &description) {
-                    QWriteLocker{&_private->updateLock};
-                    if (!_private->descriptionsCurrent.contains(description.identifier) ||
-                        _private->descriptionsCurrent.value(description.identifier) != description) {
-                        _private->descriptionsCurrent.insert(description.identifier, description);
-                        _private->current = false;
-                        emit descriptionsChanged(_private->descriptionsCurrent);
-                        emit descriptionChanged(description.identifier, description);
-                    }
-                }});
-        DriverServer::announce(_private->descriptionsProvider.toWeakRef(), {identifier}, {
-                vr::VREvent_PropertyChanged,
-        });
+        // descriptions are only queried for the full profile, all others are meant to be lightweight
+        if (providerProfile() == ProviderProfile::full) {
+            _private->descriptionsProvider
+                    .reset(new DefaultDescriptionsProvider{identifier, [&](Description const &description) {
+                        QWriteLocker{&_private->updateLock};
+                        if (!_private->descriptionsCurrent.contains(description.identifier) ||
+                            _private->descriptionsCurrent.value(description.identifier) != description) {
+                            _private->descriptionsCurrent.insert(description.identifier, description);
+                            _private->current = false;
+                            if (Profile::isEnabled<Feature::mapSignals>()) {
+                                emit descriptionsChanged(_private->descriptionsCurrent);
+                            }
+                            if (Profile::isEnabled<Feature::itemSignals>()) {
+                                emit descriptionChanged(description.identifier, description);
+                            }
+                            recordChange(ChangeSet::Member::descriptions, description.category(),
+                                         description.identifier);
+                        }
+                    }});
+            DriverServer::announce(_private->descriptionsProvider.toWeakRef(), {identifier}, {
+                    vr::VREvent_PropertyChanged,
+            });
+        }
+        // publish the collected changes once at the end of each poll cycle, the opt-in costs nothing while it is off
+        if (Profile::isEnabled<Feature::changeSets>()) {
+            _private->polledConnection = QObject::connect(&DriverServer::instance(), &DriverServer::polled, this,
+                                                          [this] {
+                ChangeSet changes{};
+                {
+                    QMutexLocker locker{&_private->changeLock};
+                    std::swap(changes, _private->changes);
+                }
+                if (!changes.isEmpty()) {
+                    emit changed(changes);
+                }
+            }, Qt::DirectConnection);
+        }
         _private->initialized = true;
     }
 }
@@ -137,6 +204,19 @@ QDataStream &Device::deserialize(QDataStream &stream) {
     return stream;
 }
 
+void Device::recordChange(ChangeSet::Member const member, Component::Category const category,
+                          Identifier const component) {
+    if (!Profile::isEnabled<Feature::changeSets>()) {
+        return;
+    }
+    QMutexLocker locker{&_private->changeLock};
+    _private->changes.dirty |= static_cast<quint32>(member);
+    auto const entry{qMakePair(category, component)};
+    if (!_private->changes.components.contains(entry)) {
+        _private->changes.components.append(entry);
+    }
+}
+
 void Device::update() {
     QWriteLocker{&_private->updateLock};
     if (!_private->current) {
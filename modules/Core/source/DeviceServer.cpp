@@ -3,26 +3,198 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QLibrary>
+#include <QtCore/QMutex>
+#include <QtCore/QPluginLoader>
 #include <QtCore/QReadWriteLock>
+#include <QtCore/QSet>
+#include <QtCore/QVector>
 
 #include <CuteVR/Internal/Property.hpp>
+#include <CuteVR/Internal/PropertyCache.hpp>
+#include <CuteVR/Interface/DevicePlugin.hpp>
 #include <CuteVR/DeviceServer.hpp>
 
 using namespace CuteVR;
 using Extension::CuteException;
 using Extension::Either;
 using Extension::Optional;
-using Internal::Property::query;
+using Internal::Property::load;
+using Internal::PropertyCache;
+
+namespace {
+    // properties queried by the factory lookup and by the default providers, grouped by the device classes using them
+    QList<vr::ETrackedDeviceProperty> const prefetchedStrings{ // NOLINT
+            vr::Prop_ManufacturerName_String,
+            vr::Prop_TrackingSystemName_String,
+            vr::Prop_HardwareRevision_String,
+            vr::Prop_ModelNumber_String,
+            vr::Prop_SerialNumber_String,
+    };
+    QList<vr::ETrackedDeviceProperty> const prefetchedHeadMountedDisplayFloats{ // NOLINT
+            vr::Prop_DisplayFrequency_Float,
+            vr::Prop_UserHeadToEyeDepthMeters_Float,
+    };
+    QList<vr::ETrackedDeviceProperty> const prefetchedControllerInt32s{ // NOLINT
+            vr::Prop_Axis0Type_Int32,
+            vr::Prop_Axis1Type_Int32,
+            vr::Prop_Axis2Type_Int32,
+            vr::Prop_Axis3Type_Int32,
+            vr::Prop_Axis4Type_Int32,
+            vr::Prop_ControllerRoleHint_Int32,
+    };
+    QList<vr::ETrackedDeviceProperty> const prefetchedControllerUInt64s{ // NOLINT
+            vr::Prop_SupportedButtons_Uint64,
+    };
+
+    // everything the choice of a factory depends on
+    struct ResolutionKey {
+        vr::ETrackedDeviceClass deviceClass;
+        QString manufacturerName;
+        QString trackingSystemName;
+        QString hardwareRevision;
+    };
+
+    bool operator==(ResolutionKey const &left, ResolutionKey const &right) {
+        return (left.deviceClass == right.deviceClass) &&
+               (left.manufacturerName == right.manufacturerName) &&
+               (left.trackingSystemName == right.trackingSystemName) &&
+               (left.hardwareRevision == right.hardwareRevision);
+    }
+
+    uint qHash(ResolutionKey const &key, uint const seed = 0) noexcept {
+        auto hash{::qHash(key.manufacturerName, seed)};
+        hash = 31 * hash + ::qHash(key.trackingSystemName, seed);
+        hash = 31 * hash + ::qHash(key.hardwareRevision, seed);
+        return 31 * hash + static_cast<uint>(key.deviceClass);
+    }
+}
 
 class DeviceServer::Private {
+public: // types
+    using Factory = std::function<QSharedPointer<Device>(Identifier)>;
+
+    /// @brief How specific a factory is for the hardware it was resolved for.
+    enum class Level :
+            quint8 {
+        specific,
+        generic,
+        majorGeneric,
+    };
+
+    /// @brief A factory together with the level of the signature it was found by.
+    struct Candidate {
+        Factory factory;
+        Level level;
+    };
+
+    /// @brief The signatures that are used if there is no factory for the hardware itself.
+    struct GenericSignatures {
+        QString generic;
+        QString majorGeneric;
+    };
+
 public: // constructor
     explicit Private(DeviceServer *that) :
             that{that} {}
 
+public: // methods
+    static GenericSignatures const &genericSignatures(vr::ETrackedDeviceClass const deviceClass) {
+        static GenericSignatures const headMountedDisplay{"HeadMountedDisplay_Generic_1_0_0",
+                                                          "HeadMountedDisplay_Generic_1_x"};
+        static GenericSignatures const controller{"Controller_Generic_1_0_0", "Controller_Generic_1_x"};
+        static GenericSignatures const trackingReference{"TrackingReference_Generic_1_0_0",
+                                                         "TrackingReference_Generic_1_x"};
+        static GenericSignatures const tracker{"Tracker_Generic_1_0_0", "Tracker_Generic_1_x"};
+        static GenericSignatures const other{"Other_Generic_1_0_0", "Other_Generic_1_x"};
+        switch (deviceClass) {
+            case vr::TrackedDeviceClass_HMD: return headMountedDisplay;
+            case vr::TrackedDeviceClass_Controller: return controller;
+            case vr::TrackedDeviceClass_TrackingReference: return trackingReference;
+            case vr::TrackedDeviceClass_GenericTracker: return tracker;
+            default: return other;
+        }
+    }
+
+    static QString nameOf(ResolutionKey const &key) {
+        return QString{key.manufacturerName.isEmpty() ? "unknownManufacturer" : key.manufacturerName} + "_" +
+               QString{key.trackingSystemName.isEmpty() ? "unknownTrackingSystem" : key.trackingSystemName} + "_" +
+               QString{key.hardwareRevision.isEmpty() ? "unknownHardwareRevision" : key.hardwareRevision};
+    }
+
+    /// @pre The register lock is held.
+    QVector<Candidate> resolve(ResolutionKey const &key, QString const &name) const {
+        auto const &generic{genericSignatures(key.deviceClass)};
+        QVector<Candidate> candidates{};
+        QVector<qint32> seen{};
+        auto const append{[&](QString const &signature, Level const level) {
+            for (auto const index : signatures.value(signature)) {
+                // factories registered with several signatures are only tried once, at their most specific level
+                if (!seen.contains(index)) {
+                    seen.append(index);
+                    candidates.append({factories.at(index), level});
+                }
+            }
+        }};
+        append(name, Level::specific);
+        append(generic.generic, Level::generic);
+        append(generic.majorGeneric, Level::majorGeneric);
+        return candidates;
+    }
+
+    /// @brief Loads the plugins that announced one of the given signatures and lets them register their devices.
+    void loadPlugins(QStringList const &signatures) {
+        QMutexLocker locker{&pluginLock};
+        for (auto const &signature : signatures) {
+            auto const loader{plugins.value(signature)};
+            if (!loader) {
+                continue;
+            }
+            // a plugin is loaded at most once, no matter how many signatures it announced
+            auto iterator{plugins.begin()};
+            while (iterator != plugins.end()) {
+                if (iterator.value() == loader) {
+                    iterator = plugins.erase(iterator);
+                } else {
+                    ++iterator;
+                }
+            }
+            auto *const plugin{qobject_cast<Interface::DevicePlugin *>(loader->instance())};
+            if (!plugin) {
+                qWarning("Device plugin '%s' could not be loaded: %s", qPrintable(loader->fileName()),
+                         qPrintable(loader->errorString()));
+                continue;
+            }
+            plugin->registerDevices();
+            loaded.append(loader);
+        }
+    }
+
+    static QSharedPointer<Device> instantiate(QVector<Candidate> const &candidates, Identifier const identifier,
+                                              Level &level) {
+        for (auto const &candidate : candidates) {
+            if (auto device = candidate.factory(identifier)) {
+                level = candidate.level;
+                return device;
+            }
+        }
+        return {};
+    }
+
 public: // variables
     DeviceServer *that{nullptr};
     QReadWriteLock registerLock{};
-    QMultiHash<QString, std::function<QSharedPointer<Device>(Identifier)>> factories;
+    QVector<Factory> factories{};
+    QHash<QString, QVector<qint32>> signatures{};
+    QHash<ResolutionKey, QVector<Candidate>> resolutions{};
+    QMutex pluginLock{};
+    QSet<QString> discovered{};
+    QHash<QString, QSharedPointer<QPluginLoader>> plugins{};
+    QList<QSharedPointer<QPluginLoader>> loaded{};
 };
 
 DeviceServer &DeviceServer::instance() noexcept {
@@ -34,85 +206,131 @@ DeviceServer::~DeviceServer() = default;
 
 Either<QSharedPointer<CuteException>, QSharedPointer<Device>>
 DeviceServer::create(Identifier identifier) {
-    // create generic names for the new device
-    QString genericName;
-    QString moreGenericName;
-    vr::ETrackedDeviceClass deviceClass;
-    DriverServer::synchronized([&] {
-        deviceClass = vr::VRSystem()->GetTrackedDeviceClass(identifier);
+    // query everything that is needed to find a factory within a single synchronized scope
+    ResolutionKey key{vr::TrackedDeviceClass_Invalid, {}, {}, {}};
+    DriverServer::Batch batch{};
+    batch.submit([&] {
+        key.deviceClass = vr::VRSystem()->GetTrackedDeviceClass(identifier);
     });
-
-    switch (deviceClass) {
-        case vr::TrackedDeviceClass_HMD: {
-            genericName = "HeadMountedDisplay_Generic_1_0_0";
-            moreGenericName = "HeadMountedDisplay_Generic_1_x";
-            break;
-        }
-        case vr::TrackedDeviceClass_Controller: {
-            genericName = "Controller_Generic_1_0_0";
-            moreGenericName = "Controller_Generic_1_x";
-            break;
-        }
-        case vr::TrackedDeviceClass_TrackingReference: {
-            genericName = "TrackingReference_Generic_1_0_0";
-            moreGenericName = "TrackingReference_Generic_1_x";
-            break;
-        }
-        case vr::TrackedDeviceClass_GenericTracker: {
-            genericName = "Tracker_Generic_1_0_0";
-            moreGenericName = "Tracker_Generic_1_x";
-            break;
-        }
-        default: {
-            genericName = "Other_Generic_1_0_0";
-            moreGenericName = "Other_Generic_1_x";
-            break;
-        }
-    }
+    // TODO: GetPropErrorNameFromEnum
+    batch.submit([&] {
+        key.manufacturerName = load<QString>(identifier, vr::Prop_ManufacturerName_String);
+    });
+    batch.submit([&] {
+        key.trackingSystemName = load<QString>(identifier, vr::Prop_TrackingSystemName_String);
+    });
+    batch.submit([&] {
+        key.hardwareRevision = load<QString>(identifier, vr::Prop_HardwareRevision_String);
+    });
+    DriverServer::execute(batch, Extension::yes);
 
     auto &_private{instance()._private};
-    QReadLocker{&_private->registerLock};
-
-    // create specific hardware name from vendor, device name, and revision
-    // TODO: GetPropErrorNameFromEnum
-    auto manufacturerName{query<QString>(identifier, vr::Prop_ManufacturerName_String)};
-    auto trackingSystemName{query<QString>(identifier, vr::Prop_TrackingSystemName_String)};
-    auto hardwareRevision{query<QString>(identifier, vr::Prop_HardwareRevision_String)};
-    QString name{QString{manufacturerName.isEmpty() ? "unknownManufacturer" : manufacturerName} + "_" +
-                 QString{trackingSystemName.isEmpty() ? "unknownTrackingSystem" : trackingSystemName} + "_" +
-                 QString{hardwareRevision.isEmpty() ? "unknownHardwareRevision" : hardwareRevision}};
-
-    // search for factories that can handle the hardware, generic is fallback
+    auto level{Private::Level::specific};
     QSharedPointer<Device> device;
-    for (auto const &factory : _private->factories.values(name)) {
-        if ((device = factory(identifier))) {
-            break;
+
+    // repeated activations of the same hardware model reuse the factories that were resolved for it
+    QVector<Private::Candidate> candidates{};
+    auto resolved{false};
+    {
+        QReadLocker locker{&_private->registerLock};
+        auto const iterator{_private->resolutions.constFind(key)};
+        if (iterator != _private->resolutions.constEnd()) {
+            candidates = iterator.value();
+            resolved = true;
         }
     }
-    if (!device) {
-        for (auto const &factory : _private->factories.values(genericName)) {
-            if ((device = factory(identifier))) {
-                qInfo("Only generic factory available for tracked device class '%s'.", qPrintable(name));
-                break;
-            }
-        }
+    if (resolved) {
+        device = Private::instantiate(candidates, identifier, level);
+        return device ? Either<QSharedPointer<CuteException>, QSharedPointer<Device>>{device}
+                      : Either<QSharedPointer<CuteException>, QSharedPointer<Device>>{DeviceNotSupported::create()};
     }
-    if (!device) {
-        for (auto const &factory : _private->factories.values(moreGenericName)) {
-            if ((device = factory(identifier))) {
-                qInfo("Only major generic factory available for tracked device class '%s'.", qPrintable(name));
-                break;
-            }
-        }
+
+    // create specific hardware name from vendor, device name, and revision, generic names are the fallback
+    auto const name{Private::nameOf(key)};
+    auto const &generic{Private::genericSignatures(key.deviceClass)};
+    _private->loadPlugins({name, generic.generic, generic.majorGeneric});
+    {
+        QWriteLocker locker{&_private->registerLock};
+        candidates = _private->resolve(key, name);
+        _private->resolutions.insert(key, candidates);
     }
+    device = Private::instantiate(candidates, identifier, level);
     if (!device) {
         qInfo("There is no factory available for tracked device class '%s'.", qPrintable(name));
+    } else if (level == Private::Level::generic) {
+        qInfo("Only generic factory available for tracked device class '%s'.", qPrintable(name));
+    } else if (level == Private::Level::majorGeneric) {
+        qInfo("Only major generic factory available for tracked device class '%s'.", qPrintable(name));
     }
 
     return device ? Either<QSharedPointer<CuteException>, QSharedPointer<Device>>{device}
                   : Either<QSharedPointer<CuteException>, QSharedPointer<Device>>{DeviceNotSupported::create()};
 }
 
+void DeviceServer::prefetch(QList<Identifier> const &identifiers) {
+    if (!PropertyCache::isEnabled() || identifiers.empty()) {
+        return;
+    }
+    DriverServer::Batch batch{};
+    for (auto const identifier : identifiers) {
+        batch.submit([identifier] {
+            for (auto const property : prefetchedStrings) {
+                load<QString>(identifier, property);
+            }
+            switch (vr::VRSystem()->GetTrackedDeviceClass(identifier)) {
+                case vr::TrackedDeviceClass_HMD: {
+                    for (auto const property : prefetchedHeadMountedDisplayFloats) {
+                        load<float>(identifier, property);
+                    }
+                    break;
+                }
+                case vr::TrackedDeviceClass_Controller: {
+                    for (auto const property : prefetchedControllerInt32s) {
+                        load<qint32>(identifier, property);
+                    }
+                    for (auto const property : prefetchedControllerUInt64s) {
+                        load<quint64>(identifier, property);
+                    }
+                    break;
+                }
+                default: break;
+            }
+        });
+    }
+    DriverServer::execute(batch, Extension::yes);
+}
+
+qint32 DeviceServer::discover(QString const &directory) {
+    auto &_private{instance()._private};
+    auto found{0};
+    QDir const dir{directory};
+    for (auto const &entry : dir.entryInfoList(QDir::Files)) {
+        if (!QLibrary::isLibrary(entry.fileName())) {
+            continue;
+        }
+        // the metadata is read from the file, the library itself is not loaded yet
+        QSharedPointer<QPluginLoader> loader{new QPluginLoader{entry.absoluteFilePath()}};
+        auto const metaData{loader->metaData()};
+        if (metaData.value("IID").toString() != CUTE_VR_DEVICE_PLUGIN_IID) {
+            continue;
+        }
+        auto const signatures{metaData.value("MetaData").toObject().value("signatures").toArray()};
+        QMutexLocker locker{&_private->pluginLock};
+        if (_private->discovered.contains(loader->fileName())) {
+            continue;
+        }
+        _private->discovered.insert(loader->fileName());
+        for (auto const &signature : signatures) {
+            _private->plugins.insert(signature.toString(), loader);
+        }
+        found++;
+    }
+    // plugins may be more suitable for hardware that has already been resolved
+    QWriteLocker locker{&_private->registerLock};
+    _private->resolutions.clear();
+    return found;
+}
+
 Optional<QSharedPointer<CuteException>>
 DeviceServer::registerDevice(std::function<QSharedPointer<Device>(Identifier)> factory,
                              QStringList const &signatures) {
@@ -127,11 +345,18 @@ DeviceServer::registerDevice(std::function<QSharedPointer<Device>(Identifier)> f
                                                  "The factory you want to register lacks device names.")};
     }
     auto &_private{instance()._private};
-    QWriteLocker{&_private->registerLock};
+    QWriteLocker locker{&_private->registerLock};
+    // signatures refer to the factory by its index, the latest registered factory is tried first
+    auto const index{_private->factories.size()};
+    _private->factories.append(std::move(factory));
     for (auto const &signature : signatures) {
-        // FIXME: this is some overhead
-        _private->factories.insert(signature, factory);
+        auto &indices{_private->signatures[signature]};
+        if (!indices.contains(index)) {
+            indices.prepend(index);
+        }
     }
+    // a new factory may be more suitable for hardware that has already been resolved
+    _private->resolutions.clear();
     return {};
 }
 
@@ -7,10 +7,14 @@
 #include <openvr.h>
 
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Devices/Controller/Generic.hpp>
+#include <CuteVR/Internal/ControllerStateSampler.hpp>
 #include <CuteVR/Internal/DefaultAxesProvider.hpp>
 #include <CuteVR/Internal/DefaultButtonsProvider.hpp>
 #include <CuteVR/Internal/DefaultHandsProvider.hpp>
+#include <CuteVR/Internal/DefaultHapticsProvider.hpp>
+#include <CuteVR/Internal/InputCapture.hpp>
 #include <CuteVR/DeviceServer.hpp>
 #include <CuteVR/DriverServer.hpp>
 
@@ -18,13 +22,22 @@ using namespace CuteVR;
 using Components::Input::Axis;
 using Components::Input::Button;
 using Components::Interaction::Hand;
+using Components::Output::Haptic;
 using Components::Description;
 using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
 using Configurations::feature;
+using Configurations::parameter;
 using Devices::Controller::Generic;
+using Interface::CyclicHandler;
+using Internal::ControllerStateSampler;
 using Internal::DefaultAxesProvider;
 using Internal::DefaultButtonsProvider;
 using Internal::DefaultHandsProvider;
+using Internal::DefaultHapticsProvider;
+using Internal::InputCapture;
+
+namespace Profile = Configurations::Core::Profile;
 
 namespace {
     struct RegisterMetaTypes {
@@ -32,6 +45,7 @@ namespace {
             qRegisterMetaType<QMap<Identifier, Axis>>();
             qRegisterMetaType<QMap<Identifier, Button>>();
             qRegisterMetaType<QMap<Identifier, Hand>>();
+            qRegisterMetaType<QMap<Identifier, Haptic>>();
         }
     } registerMetaTypes; // NOLINT
 
@@ -53,11 +67,15 @@ public: // variables
     QSharedPointer<DefaultAxesProvider> axesProvider;
     QSharedPointer<DefaultButtonsProvider> buttonsProvider;
     QSharedPointer<DefaultHandsProvider> handsProvider;
+    QSharedPointer<DefaultHapticsProvider> hapticsProvider;
+    QSharedPointer<ControllerStateSampler> stateSampler;
+    QScopedPointer<InputCapture> inputCapture;
     QReadWriteLock updateLock{};
     bool current{true};
     QMap<Identifier, Axis> axisCurrent{};
     QMap<Identifier, Button> buttonsCurrent{};
     QMap<Identifier, Hand> handsCurrent{};
+    QMap<Identifier, Haptic> hapticsCurrent{};
     QMap<Hand::Type, Identifier> handsByType{};
 };
 
@@ -79,12 +97,20 @@ Devices::Controller::Generic::hand(Components::Interaction::Hand::Type type) con
                                                 : Extension::Optional<Identifier>{};
 }
 
+quint64 Generic::droppedInput() const noexcept {
+    QReadLocker locker{&_private->initializeLock};
+    return _private->inputCapture.isNull() ? 0 : _private->inputCapture->dropped();
+}
+
 void Generic::destroy() {
     QWriteLocker{&_private->initializeLock};
     if (_private->initialized) {
+        _private->inputCapture.reset();
+        _private->stateSampler.clear();
         _private->axesProvider.clear();
         _private->buttonsProvider.clear();
         _private->handsProvider.clear();
+        _private->hapticsProvider.clear();
         _private->initialized = false;
     }
     CategorizedDevice::destroy();
@@ -98,47 +124,97 @@ bool Generic::isDestroyed() const noexcept {
 void Generic::initialize() {
     QWriteLocker{&_private->initializeLock};
     if (!_private->initialized) {
-        _private->axesProvider.reset(new DefaultAxesProvider{identifier, [&](Axis const &axis) {
-            QWriteLocker{&_private->updateLock};
-            if (!_private->axisCurrent.contains(axis.identifier) ||
-                _private->axisCurrent.value(axis.identifier) != axis) {
-                _private->axisCurrent.insert(axis.identifier, axis);
-                _private->current = false;
-                emit axesChanged(_private->axisCurrent);
-                emit axisChanged(axis.identifier, axis);
-            }
-        }});
-        DriverServer::announce(_private->axesProvider.toWeakRef());
-        _private->buttonsProvider.reset(new DefaultButtonsProvider{identifier, [&](Button const &button) {
-            QWriteLocker{&_private->updateLock};
-            if (!_private->buttonsCurrent.contains(button.identifier) ||
-                _private->buttonsCurrent.value(button.identifier) != button) {
-                _private->buttonsCurrent.insert(button.identifier, button);
-                _private->current = false;
-                emit buttonsChanged(_private->buttonsCurrent);
-                emit buttonChanged(button.identifier, button);
-            }
-        }});
-        DriverServer::announce(_private->buttonsProvider.toWeakRef(), {identifier}, {
-                vr::VREvent_ButtonPress,
-                vr::VREvent_ButtonUnpress,
-                vr::VREvent_ButtonTouch,
-                vr::VREvent_ButtonUntouch,
-        });
-        _private->handsProvider.reset(new DefaultHandsProvider{identifier, [&](Hand const &hand) {
-            QWriteLocker{&_private->updateLock};
-            if (!_private->handsCurrent.contains(hand.identifier) ||
-                _private->handsCurrent.value(hand.identifier) != hand) {
-                _private->handsCurrent.insert(hand.identifier, hand);
-                _private->current = false;
-                emit handsChanged(_private->handsCurrent);
-                emit handChanged(hand.identifier, hand);
-            }
-        }});
-        DriverServer::announce(_private->handsProvider.toWeakRef(), {}, {
-                vr::VREvent_TrackedDeviceRoleChanged,
-                vr::VREvent_PropertyChanged,
-        });
+        auto const profile{providerProfile()};
+        auto const input{profile != ProviderProfile::trackingOnly};
+        if (input) {
+            _private->axesProvider.reset(new DefaultAxesProvider{identifier, [&](Axis const &axis) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->axisCurrent.contains(axis.identifier) ||
+                    _private->axisCurrent.value(axis.identifier) != axis) {
+                    _private->axisCurrent.insert(axis.identifier, axis);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit axesChanged(_private->axisCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit axisChanged(axis.identifier, axis);
+                    }
+                    recordChange(ChangeSet::Member::axes, axis.category(), axis.identifier);
+                }
+            }});
+            _private->buttonsProvider.reset(new DefaultButtonsProvider{identifier, [&](Button const &button) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->buttonsCurrent.contains(button.identifier) ||
+                    _private->buttonsCurrent.value(button.identifier) != button) {
+                    _private->buttonsCurrent.insert(button.identifier, button);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit buttonsChanged(_private->buttonsCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit buttonChanged(button.identifier, button);
+                    }
+                    recordChange(ChangeSet::Member::buttons, button.category(), button.identifier);
+                }
+            }});
+            DriverServer::announce(_private->buttonsProvider.toWeakRef(), {identifier}, {
+                    vr::VREvent_ButtonPress,
+                    vr::VREvent_ButtonUnpress,
+                    vr::VREvent_ButtonTouch,
+                    vr::VREvent_ButtonUntouch,
+            });
+            // both input streams are fed by a single read of the controller state per cycle
+            _private->stateSampler.reset(new ControllerStateSampler{identifier, {
+                    _private->axesProvider.staticCast<CyclicHandler>().toWeakRef(),
+                    _private->buttonsProvider.staticCast<CyclicHandler>().toWeakRef(),
+            }});
+            _private->stateSampler->handleCyclic(nullptr);
+            DriverServer::announce(_private->stateSampler.toWeakRef());
+            _private->handsProvider.reset(new DefaultHandsProvider{identifier, [&](Hand const &hand) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->handsCurrent.contains(hand.identifier) ||
+                    _private->handsCurrent.value(hand.identifier) != hand) {
+                    _private->handsCurrent.insert(hand.identifier, hand);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit handsChanged(_private->handsCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit handChanged(hand.identifier, hand);
+                    }
+                    recordChange(ChangeSet::Member::hands, hand.category(), hand.identifier);
+                }
+            }});
+            DriverServer::announce(_private->handsProvider.toWeakRef(), {}, {
+                    vr::VREvent_TrackedDeviceRoleChanged,
+                    vr::VREvent_PropertyChanged,
+            });
+        }
+        if (profile == ProviderProfile::full) {
+            _private->hapticsProvider.reset(new DefaultHapticsProvider{identifier, [&](Haptic const &haptic) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->hapticsCurrent.contains(haptic.identifier) ||
+                    _private->hapticsCurrent.value(haptic.identifier) != haptic) {
+                    _private->hapticsCurrent.insert(haptic.identifier, haptic);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit hapticsChanged(_private->hapticsCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit hapticChanged(haptic.identifier, haptic);
+                    }
+                    recordChange(ChangeSet::Member::haptics, haptic.category(), haptic.identifier);
+                }
+            }});
+        }
+        if (input && ConfigurationServer::isEnabled(feature(Feature::inputCapture))) {
+            auto const rate{ConfigurationServer::value(parameter(Parameter::inputCaptureRate))
+                                    .right(QVariant{1000}).toUInt()};
+            auto const depth{ConfigurationServer::value(parameter(Parameter::inputCaptureDepth))
+                                     .right(QVariant{4096}).toUInt()};
+            _private->inputCapture.reset(new InputCapture{identifier, rate, depth});
+            _private->inputCapture->start();
+        }
         _private->initialized = true;
     }
     CategorizedDevice::initialize();
@@ -155,6 +231,7 @@ void Devices::Controller::Generic::update() {
         axes = _private->axisCurrent;
         buttons = _private->buttonsCurrent;
         hands = _private->handsCurrent;
+        haptics = _private->hapticsCurrent;
         _private->handsByType.clear();
         for (auto const &hand : hands) {
             _private->handsByType.insert(hand.type, hand.identifier);
@@ -169,4 +246,14 @@ bool Devices::Controller::Generic::isCurrent() const noexcept {
     return _private->current && CategorizedDevice::isCurrent();
 }
 
+qint32 Devices::Controller::Generic::drainInput(QVector<InputRecord> &records, qint32 const maximum) {
+    QReadLocker locker{&_private->initializeLock};
+    return _private->inputCapture.isNull() ? 0 : _private->inputCapture->drain(records, maximum);
+}
+
+bool Devices::Controller::Generic::vibrate(Identifier const haptic, QVector<qreal> const &envelope) {
+    QReadLocker locker{&_private->initializeLock};
+    return !_private->hapticsProvider.isNull() && _private->hapticsProvider->vibrate(haptic, envelope);
+}
+
 #include "../../../include/CuteVR/Devices/Controller/moc_Generic.cpp" // LEGACY: CMake 3.8 ignores include paths
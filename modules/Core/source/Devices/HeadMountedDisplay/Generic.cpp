@@ -7,15 +7,21 @@
 #include <openvr.h>
 
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Devices/HeadMountedDisplay/Generic.hpp>
 #include <CuteVR/Internal/DefaultDisplaysProvider.hpp>
 #include <CuteVR/Internal/DefaultEyesProvider.hpp>
+#include <CuteVR/Internal/EyeMatricesStage.hpp>
+#include <CuteVR/Internal/LensMeshCache.hpp>
 #include <CuteVR/DeviceServer.hpp>
 #include <CuteVR/DriverServer.hpp>
 
 using namespace CuteVR;
 using Components::Interaction::Eye;
+using Components::Interaction::EyeMatrices;
+using Components::Output::DistortionMesh;
 using Components::Output::Display;
+using Components::Output::HiddenAreaMesh;
 using Components::Description;
 using Configurations::Core::Feature;
 using Configurations::feature;
@@ -23,12 +29,17 @@ using Devices::HeadMountedDisplay::Generic;
 using Extension::Optional;
 using Internal::DefaultDisplaysProvider;
 using Internal::DefaultEyesProvider;
+using Internal::EyeMatricesStage;
+using Internal::LensMeshCache;
+
+namespace Profile = Configurations::Core::Profile;
 
 namespace {
     struct RegisterMetaTypes {
         RegisterMetaTypes() {
             qRegisterMetaType<QMap<Identifier, Display>>();
             qRegisterMetaType<QMap<Identifier, Eye>>();
+            qRegisterMetaType<QMap<Identifier, EyeMatrices>>();
         }
     } registerMetaTypes; // NOLINT
 
@@ -54,6 +65,7 @@ public: // variables
     QMap<Identifier, Display> displaysCurrent{};
     QMap<Identifier, Eye> eyesCurrent{};
     QMap<Eye::Type, Identifier> eyesByType{};
+    EyeMatricesStage eyeMatricesStage{};
 };
 
 Generic::Generic(Identifier const identifier) :
@@ -73,6 +85,25 @@ Optional<Identifier> Generic::eye(Eye::Type type) const noexcept {
                                                : Extension::Optional<Identifier>{};
 }
 
+DistortionMesh Generic::distortionMesh(Eye::Type const type, QSize const resolution) const {
+    auto const theEye{eye(type)};
+    return theEye.hasValue() ? LensMeshCache::distortion(identifier, theEye.value(), resolution) : DistortionMesh{};
+}
+
+QMap<Identifier, DistortionMesh> Generic::distortionMeshes(QSize const resolution) const {
+    QList<Identifier> identifiers{};
+    {
+        QReadLocker locker{&_private->updateLock};
+        identifiers = _private->eyesByType.values();
+    }
+    return LensMeshCache::distortions(identifier, identifiers, resolution);
+}
+
+HiddenAreaMesh Generic::hiddenAreaMesh(Eye::Type const type, HiddenAreaMesh::Type const meshType) const {
+    auto const theEye{eye(type)};
+    return theEye.hasValue() ? LensMeshCache::hiddenArea(identifier, theEye.value(), meshType) : HiddenAreaMesh{};
+}
+
 void Generic::destroy() {
     QWriteLocker{&_private->initializeLock};
     if (_private->initialized) {
@@ -91,33 +122,46 @@ bool Generic::isDestroyed() const noexcept {
 void Generic::initialize() {
     QWriteLocker{&_private->initializeLock};
     if (!_private->initialized) {
-        _private->displaysProvider.reset(new DefaultDisplaysProvider{identifier, [&](Display const &display) {
-            QWriteLocker{&_private->updateLock};
-            if (!_private->displaysCurrent.contains(display.identifier) ||
-                _private->displaysCurrent.value(display.identifier) != display) {
-                _private->displaysCurrent.insert(display.identifier, display);
-                _private->current = false;
-                emit displaysChanged(_private->displaysCurrent);
-                emit displayChanged(display.identifier, display);
-            }
-        }});
-        DriverServer::announce(_private->displaysProvider.toWeakRef(), {identifier}, {
-                vr::VREvent_PropertyChanged,
-        });
-        _private->eyesProvider.reset(new DefaultEyesProvider{identifier, [&](Eye const &eye) {
-            QWriteLocker{&_private->updateLock};
-            if (!_private->eyesCurrent.contains(eye.identifier) ||
-                _private->eyesCurrent.value(eye.identifier) != eye) {
-                _private->eyesCurrent.insert(eye.identifier, eye);
-                _private->current = false;
-                emit eyesChanged(_private->eyesCurrent);
-                emit eyeChanged(eye.identifier, eye);
-            }
-        }});
-        DriverServer::announce(_private->eyesProvider.toWeakRef(), {identifier}, {
-                vr::VREvent_IpdChanged,
-                vr::VREvent_PropertyChanged,
-        });
+        // displays and eyes query the render setup of the driver, which a tracking-only profile can go without
+        if (providerProfile() == ProviderProfile::full) {
+            _private->displaysProvider.reset(new DefaultDisplaysProvider{identifier, [&](Display const &display) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->displaysCurrent.contains(display.identifier) ||
+                    _private->displaysCurrent.value(display.identifier) != display) {
+                    _private->displaysCurrent.insert(display.identifier, display);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit displaysChanged(_private->displaysCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit displayChanged(display.identifier, display);
+                    }
+                    recordChange(ChangeSet::Member::displays, display.category(), display.identifier);
+                }
+            }});
+            DriverServer::announce(_private->displaysProvider.toWeakRef(), {identifier}, {
+                    vr::VREvent_PropertyChanged,
+            });
+            _private->eyesProvider.reset(new DefaultEyesProvider{identifier, [&](Eye const &eye) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->eyesCurrent.contains(eye.identifier) ||
+                    _private->eyesCurrent.value(eye.identifier) != eye) {
+                    _private->eyesCurrent.insert(eye.identifier, eye);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit eyesChanged(_private->eyesCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit eyeChanged(eye.identifier, eye);
+                    }
+                    recordChange(ChangeSet::Member::eyes, eye.category(), eye.identifier);
+                }
+            }});
+            DriverServer::announce(_private->eyesProvider.toWeakRef(), {identifier}, {
+                    vr::VREvent_IpdChanged,
+                    vr::VREvent_PropertyChanged,
+            });
+        }
         _private->initialized = true;
     }
     CategorizedDevice::initialize();
@@ -137,9 +181,17 @@ void Generic::update() {
         for (auto const &eye : eyes) {
             _private->eyesByType.insert(eye.type, eye.identifier);
         }
+        _private->eyeMatricesStage.setEyes(eyes);
         _private->current = true;
     }
     CategorizedDevice::update();
+    // the pose is taken over by the base class, so the views are derived once the whole frame is in place
+    if (_private->eyeMatricesStage.update(pose.poseTransform)) {
+        eyeMatrices = _private->eyeMatricesStage.matrices();
+        if (Profile::isEnabled<Feature::mapSignals>()) {
+            emit eyeMatricesChanged(eyeMatrices);
+        }
+    }
 }
 
 bool Generic::isCurrent() const noexcept {
@@ -0,0 +1,92 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QReadWriteLock>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Devices/Proxy.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Configurations::Core::Feature;
+using Devices::Proxy;
+
+namespace Profile = Configurations::Core::Profile;
+
+class Proxy::Private {
+public: // constructor
+    explicit Private(Category const category) :
+            category{category} {}
+
+public: // variables
+    Category const category;
+    QReadWriteLock initializeLock{QReadWriteLock::RecursionMode::Recursive};
+    bool initialized{false};
+    QReadWriteLock updateLock{QReadWriteLock::RecursionMode::Recursive};
+    bool current{true};
+    CompactPose compactPoseCurrent{};
+};
+
+Proxy::Proxy(Category const category, Identifier const node, Identifier const remote) :
+        Device(identifierOf(node, remote)),
+        node{node},
+        remote{remote},
+        _private{new Private{category}} {}
+
+Proxy::~Proxy() = default;
+
+Device::Category Proxy::category() const noexcept {
+    return _private->category;
+}
+
+void Proxy::destroy() {
+    // a proxy is not backed by the driver, thus there are no providers to release
+    QWriteLocker{&_private->initializeLock};
+    _private->initialized = false;
+}
+
+bool Proxy::isDestroyed() const noexcept {
+    QReadLocker{&_private->initializeLock};
+    return !_private->initialized;
+}
+
+void Proxy::initialize() {
+    QWriteLocker{&_private->initializeLock};
+    _private->initialized = true;
+}
+
+bool Proxy::isInitialized() const noexcept {
+    QReadLocker{&_private->initializeLock};
+    return _private->initialized;
+}
+
+void Proxy::receive(CompactPose const &pose) {
+    QWriteLocker{&_private->updateLock};
+    if (_private->compactPoseCurrent != pose) {
+        _private->compactPoseCurrent = pose;
+        _private->current = false;
+        if (Profile::isEnabled<Feature::itemSignals>()) {
+            emit poseChanged(pose.toPose());
+        }
+    }
+}
+
+void Proxy::update() {
+    QWriteLocker{&_private->updateLock};
+    if (!_private->current) {
+        compactPose = _private->compactPoseCurrent;
+        pose = compactPose.toPose();
+        _private->current = true;
+    }
+    Device::update();
+}
+
+bool Proxy::isCurrent() const noexcept {
+    QReadLocker{&_private->updateLock};
+    return _private->current && Device::isCurrent();
+}
+
+#include "../../include/CuteVR/Devices/moc_Proxy.cpp" // LEGACY: CMake 3.8 ignores include paths
@@ -6,28 +6,50 @@
 #include <QtCore/QReadWriteLock>
 #include <openvr.h>
 
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Devices/TrackedDevice.hpp>
 #include <CuteVR/Internal/DefaultAvailabilityProvider.hpp>
+#include <CuteVR/Internal/DefaultBatteriesProvider.hpp>
 #include <CuteVR/Internal/DefaultPoseProvider.hpp>
+#include <CuteVR/Internal/ProviderRegistry.hpp>
 #include <CuteVR/DriverServer.hpp>
 
 using namespace CuteVR;
 using Components::Availability;
+using Components::CompactPose;
+using Components::Peripheral::Battery;
 using Components::Pose;
+using Configurations::Core::Feature;
 using Devices::TrackedDevice;
 using Internal::DefaultAvailabilityProvider;
+using Internal::DefaultBatteriesProvider;
 using Internal::DefaultPoseProvider;
+using Internal::ProviderRegistry;
+
+namespace Profile = Configurations::Core::Profile;
+
+namespace {
+    struct RegisterMetaTypes {
+        RegisterMetaTypes() {
+            qRegisterMetaType<QMap<Identifier, Battery>>();
+        }
+    } registerMetaTypes; // NOLINT
+}
 
 class TrackedDevice::Private {
 public: // variables
     QReadWriteLock initializeLock{QReadWriteLock::RecursionMode::Recursive};
     bool initialized{false};
-    QSharedPointer<DefaultAvailabilityProvider> availabilityProvider;
-    QSharedPointer<DefaultPoseProvider> poseProvider;
+    QSharedPointer<ProviderRegistry::Subscription> availabilitySubscription;
+    QSharedPointer<ProviderRegistry::Subscription> poseSubscription;
+    QSharedPointer<DefaultBatteriesProvider> batteriesProvider;
     QReadWriteLock updateLock{QReadWriteLock::RecursionMode::Recursive};
     bool current{true};
     Availability availabilityCurrent{};
     Pose poseCurrent{};
+    CompactPose compactPoseCurrent{};
+    QMap<Identifier, Battery> batteriesCurrent{};
 };
 
 TrackedDevice::TrackedDevice(Identifier const identifier) :
@@ -39,8 +61,9 @@ TrackedDevice::~TrackedDevice() = default;
 void TrackedDevice::destroy() {
     QWriteLocker{&_private->initializeLock};
     if (_private->initialized) {
-        _private->availabilityProvider.clear();
-        _private->poseProvider.clear();
+        _private->availabilitySubscription.clear();
+        _private->poseSubscription.clear();
+        _private->batteriesProvider.clear();
         _private->initialized = false;
     }
     Device::destroy();
@@ -54,29 +77,66 @@ bool TrackedDevice::isDestroyed() const noexcept {
 void TrackedDevice::initialize() {
     QWriteLocker{&_private->initializeLock};
     if (!_private->initialized) {
-        _private->availabilityProvider
-                .reset(new DefaultAvailabilityProvider{identifier, [&](Availability const &availability) {
+        // other objects of the same device share these providers, so conversions and queries are done only once
+        _private->availabilitySubscription = ProviderRegistry::subscribe<DefaultAvailabilityProvider, Availability>(
+                identifier, [&](Availability const &availability) {
                     QWriteLocker{&_private->updateLock};
                     if (_private->availabilityCurrent != availability) {
                         _private->availabilityCurrent = availability;
                         _private->current = false;
-                        emit availabilityChanged(availability);
+                        if (Profile::isEnabled<Feature::itemSignals>()) {
+                            emit availabilityChanged(availability);
+                        }
+                        recordChange(ChangeSet::Member::availability, availability.category(), availability.identifier);
+                    }
+                }, [this](QSharedPointer<DefaultAvailabilityProvider> const &provider) {
+                    DriverServer::announce(provider.toWeakRef(), {identifier});
+                    DriverServer::announce(provider.toWeakRef(), {identifier}, {
+                            vr::VREvent_TrackedDeviceActivated,
+                            vr::VREvent_TrackedDeviceDeactivated,
+                    });
+                });
+        _private->poseSubscription = ProviderRegistry::subscribe<DefaultPoseProvider, DefaultPoseProvider::Sample>(
+                identifier, [&](DefaultPoseProvider::Sample const &sample) {
+                    QWriteLocker{&_private->updateLock};
+                    auto const &pose{sample.pose};
+                    _private->compactPoseCurrent = sample.compact;
+                    if (_private->poseCurrent != pose) {
+                        _private->poseCurrent = pose;
+                        _private->current = false;
+                        if (Profile::isEnabled<Feature::itemSignals>()) {
+                            emit poseChanged(pose);
+                        }
+                        recordChange(ChangeSet::Member::pose, pose.category(), pose.identifier);
+                    }
+                }, [this](QSharedPointer<DefaultPoseProvider> const &provider) {
+                    DriverServer::announce(provider.toWeakRef(), {identifier});
+                });
+        if (providerProfile() == ProviderProfile::full) {
+            _private->batteriesProvider.reset(new DefaultBatteriesProvider{identifier, [&](Battery const &battery) {
+                QWriteLocker{&_private->updateLock};
+                if (!_private->batteriesCurrent.contains(battery.identifier) ||
+                    _private->batteriesCurrent.value(battery.identifier) != battery) {
+                    _private->batteriesCurrent.insert(battery.identifier, battery);
+                    _private->current = false;
+                    if (Profile::isEnabled<Feature::mapSignals>()) {
+                        emit batteriesChanged(_private->batteriesCurrent);
+                    }
+                    if (Profile::isEnabled<Feature::itemSignals>()) {
+                        emit batteryChanged(battery.identifier, battery);
                     }
-                }});
-        DriverServer::announce(_private->availabilityProvider.toWeakRef(), {identifier});
-        DriverServer::announce(_private->availabilityProvider.toWeakRef(), {identifier}, {
-                vr::VREvent_TrackedDeviceActivated,
-                vr::VREvent_TrackedDeviceDeactivated,
-        });
-        _private->poseProvider.reset(new DefaultPoseProvider{identifier, [&](Pose const &pose) {
-            QWriteLocker{&_private->updateLock};
-            if (_private->poseCurrent != pose) {
-                _private->poseCurrent = pose;
-                _private->current = false;
-                emit poseChanged(pose);
+                    recordChange(ChangeSet::Member::batteries, battery.category(), battery.identifier);
+                }
+            }});
+            if (_private->batteriesProvider->hasBattery()) {
+                // the phase spreads the polls of all devices across the period
+                DriverServer::Schedule schedule{};
+                schedule.period = DefaultBatteriesProvider::period;
+                schedule.phase = (identifier * 61) % DefaultBatteriesProvider::period;
+                schedule.priority = -1;
+                DriverServer::announce(_private->batteriesProvider.toWeakRef(), {}, schedule);
             }
-        }});
-        DriverServer::announce(_private->poseProvider.toWeakRef(), {identifier});
+        }
         _private->initialized = true;
     }
     Device::initialize();
@@ -92,6 +152,8 @@ void TrackedDevice::update() {
     if (!_private->current) {
         availability = _private->availabilityCurrent;
         pose = _private->poseCurrent;
+        compactPose = _private->compactPoseCurrent;
+        batteries = _private->batteriesCurrent;
         _private->current = true;
     }
     Device::update();
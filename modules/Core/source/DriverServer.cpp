@@ -3,19 +3,29 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <algorithm>
 #include <openvr.h>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QQueue>
 #include <QtCore/QReadWriteLock>
+#include <QtCore/QThread>
 #include <QtCore/QVector>
+#include <QtCore/QWaitCondition>
 #include <QtCore/QWeakPointer>
 
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Internal/LensMeshCache.hpp>
+#include <CuteVR/Internal/PropertyCache.hpp>
+#include <CuteVR/Internal/TrackingFrame.hpp>
 #include <CuteVR/DriverServer.hpp>
 
 using namespace CuteVR;
 using Configurations::Core::Feature;
 using Configurations::Core::Parameter;
-using Configurations::feature;
 using Configurations::parameter;
 using Extension::CuteException;
 using Extension::Optional;
@@ -24,19 +34,143 @@ using Interface::CyclicHandler;
 using Interface::EventHandler;
 using Interface::TrackingHandler;
 
+namespace Profile = Configurations::Core::Profile;
+
 class DriverServer::Private {
+public: // types
+    /// Serializes all driver calls on a single thread, used if the driver thread feature is enabled.
+    class DriverThread final :
+            public QThread {
+    public: // destructor
+        ~DriverThread() override {
+            halt();
+        }
+
+    public: // methods
+        /// Runs the functor on the driver thread and blocks until it has finished, exceptions are rethrown.
+        /// @return `false` if the driver thread is not running, so the functor has not been executed.
+        bool dispatch(std::function<void()> const &functor) {
+            if (QThread::currentThread() == this) {
+                functor();
+                return true;
+            }
+            auto promise{std::make_shared<std::promise<void>>()};
+            auto future{promise->get_future()};
+            {
+                QMutexLocker locker{&mutex};
+                if (!running) {
+                    return false;
+                }
+                tasks.enqueue([promise, &functor] {
+                    try {
+                        functor();
+                        promise->set_value();
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+            }
+            condition.wakeOne();
+            future.get();
+            return true;
+        }
+
+        void launch() {
+            QMutexLocker locker{&mutex};
+            if (!running) {
+                running = true;
+                start();
+            }
+        }
+
+        /// Stops accepting new functors, but finishes all that have already been dispatched.
+        void halt() {
+            {
+                QMutexLocker locker{&mutex};
+                if (!running) {
+                    return;
+                }
+                running = false;
+            }
+            condition.wakeAll();
+            wait();
+        }
+
+    protected: // methods
+        void run() override {
+            QMutexLocker locker{&mutex};
+            while (true) {
+                while (tasks.isEmpty() && running) {
+                    condition.wait(&mutex);
+                }
+                if (tasks.isEmpty()) {
+                    return;
+                }
+                auto task{tasks.dequeue()};
+                locker.unlock();
+                task();
+                locker.relock();
+            }
+        }
+
+    private: // variables
+        QMutex mutex{};
+        QWaitCondition condition{};
+        QQueue<std::function<void()>> tasks{};
+        bool running{false};
+    };
+
+    /// A cyclic handler together with its data provider and schedule.
+    struct CyclicEntry {
+        QWeakPointer<CyclicHandler> handler{};
+        std::function<void *(void)> dataProvider{};
+        Schedule schedule{};
+        quint64 generation{0};
+    };
+
+    /// A pending call of a cyclic handler, the generation detects handlers that have been replaced meanwhile.
+    struct CyclicTimer {
+        qint64 due{0};
+        qint32 priority{0};
+        qintptr address{0};
+        quint64 generation{0};
+    };
+
 public: // constructor
     explicit Private(DriverServer *that) :
-            that{that} {}
+            that{that} {
+        clock.start();
+    }
 
 public: // methods
     void garbageCollectCyclicHandlers() {
-        QWriteLocker{&announceLock};
+        QWriteLocker locker{&announceLock};
+        QMutexLocker scheduleLocker{&scheduleLock};
         for (auto const key : cyclicHandlers.keys()) {
-            if (cyclicHandlers.value(key).first.isNull()) {
+            if (cyclicHandlers.value(key).handler.isNull()) {
                 cyclicHandlers.remove(key);
+                everyCycle.removeAll(key);
             }
         }
+        // timers of removed handlers are dropped as soon as they are due
+    }
+
+    static bool earlierTimer(CyclicTimer const &left, CyclicTimer const &right) noexcept {
+        return left.due > right.due; // inverted, since the standard heap keeps the largest element on top
+    }
+
+    static bool higherPriority(CyclicTimer const &left, CyclicTimer const &right) noexcept {
+        return left.priority > right.priority;
+    }
+
+    void pushTimer(CyclicTimer const &timer) {
+        timers.append(timer);
+        std::push_heap(timers.begin(), timers.end(), earlierTimer);
+    }
+
+    CyclicTimer popTimer() {
+        std::pop_heap(timers.begin(), timers.end(), earlierTimer);
+        return timers.takeLast();
     }
 
     void garbageCollectEventHandlers() {
@@ -64,20 +198,32 @@ public: // methods
                 }
             }
         }
+        for (auto const key : frameHandlers.keys()) {
+            if (frameHandlers.value(key).isNull()) {
+                frameHandlers.remove(key);
+            }
+        }
     }
 
 public: // variables
     DriverServer *that{nullptr};
     QReadWriteLock mutex{QReadWriteLock::RecursionMode::Recursive};
     bool preInitialized{false};
-    bool initialized{false};
+    QAtomicInteger<quint32> initialized{0}; // also read by the driver thread, which does not hold the mutex
     QReadWriteLock announceLock{QReadWriteLock::RecursionMode::Recursive};
-    QHash<qintptr, QPair<QWeakPointer<CyclicHandler>, std::function<void *(void)>>> cyclicHandlers{};
+    QHash<qintptr, CyclicEntry> cyclicHandlers{};
+    QMutex scheduleLock{};
+    QElapsedTimer clock{};
+    QVector<qintptr> everyCycle{}; // handlers without period, ordered by priority
+    QVector<CyclicTimer> timers{}; // heap of handlers with period, ordered by due time
+    quint64 generations{0};
     QHash<qintptr, QWeakPointer<EventHandler>> eventHandlers{};
     QHash<qintptr, QWeakPointer<TrackingHandler>> trackingHandlers{};
+    QHash<qintptr, QWeakPointer<TrackingHandler>> frameHandlers{};
     QMultiHash<Identifier, qintptr> devicesToEventHandlers{};
     QMultiHash<qint64, qintptr> eventsToEventHandlers{};
     QMultiHash<Identifier, qintptr> devicesToTrackingHandlers{};
+    DriverThread driverThread{};
 };
 
 DriverServer::~DriverServer() = default;
@@ -89,13 +235,32 @@ DriverServer &DriverServer::instance() noexcept {
 
 void DriverServer::synchronized(std::function<void()> const &functor, Trilean const initialized) {
     auto const &_private{instance()._private};
-    QReadLocker{&_private->mutex};
-    if (initialized == Trilean::yes && !_private->initialized) {
-        NotInitialized().raise();
-    } else if (initialized == Extension::no && _private->initialized) {
-        NotTerminated().raise();
+    auto const checked{[&] {
+        if (initialized == Trilean::yes && !_private->initialized.load()) {
+            NotInitialized().raise();
+        } else if (initialized == Extension::no && _private->initialized.load()) {
+            NotTerminated().raise();
+        }
+        functor();
+    }};
+    if (_private->driverThread.dispatch(checked)) {
+        return;
+    }
+    QReadLocker locker{&_private->mutex};
+    checked();
+}
+
+void DriverServer::execute(Batch &batch, Trilean const initialized) {
+    if (batch.isEmpty()) {
+        return;
     }
-    functor();
+    auto const calls{std::move(batch.calls)};
+    batch.calls.clear();
+    synchronized([&calls] {
+        for (auto const &call : calls) {
+            call();
+        }
+    }, initialized);
 }
 
 void DriverServer::announce(QWeakPointer<EventHandler> eventHandler, QSet<Identifier> const &devices,
@@ -105,7 +270,7 @@ void DriverServer::announce(QWeakPointer<EventHandler> eventHandler, QSet<Identi
         return;
     }
     auto &_private{instance()._private};
-    QWriteLocker{&_private->announceLock};
+    QWriteLocker locker{&_private->announceLock};
     if (!_private->eventHandlers.contains(address) || _private->eventHandlers.value(address).isNull()) {
         _private->eventHandlers.insert(address, eventHandler);
     }
@@ -124,12 +289,12 @@ void DriverServer::announce(QWeakPointer<EventHandler> eventHandler, QSet<Identi
 }
 
 Optional<QSharedPointer<CuteException>> DriverServer::pollEvents() {
-    auto const eventsEnabled{ConfigurationServer::isEnabled(feature(Feature::events)).right(false)};
+    auto const eventsEnabled{Profile::isEnabled<Feature::events>()};
     if (!eventsEnabled) {
         return {};
     }
-    auto const drawingEnabled{ConfigurationServer::isEnabled(feature(Feature::drawing)).right(false)};
-    auto const eventTrackingEnabled{ConfigurationServer::isEnabled(feature(Feature::eventTracking)).right(false)};
+    auto const drawingEnabled{Profile::isEnabled<Feature::drawing>()};
+    auto const eventTrackingEnabled{Profile::isEnabled<Feature::eventTracking>()};
     auto const &_private{instance()._private};
     bool garbageFound{false};
     QReadLocker locker{&_private->announceLock};
@@ -148,6 +313,10 @@ Optional<QSharedPointer<CuteException>> DriverServer::pollEvents() {
             void const *event{&vrEvent};
             void const *tracking{eventTrackingEnabled ? &vrPose : nullptr};
 
+            // invalidate cached properties and meshes before any handler can query them again
+            Internal::PropertyCache::observe(event);
+            Internal::LensMeshCache::observe(event);
+
             // first find all event handlers that subscribed to this device and event, then send the event to them
             auto eventHandlersForDevice{
                     QSet<qintptr>::fromList(_private->devicesToEventHandlers.values(vrEvent.trackedDeviceIndex))};
@@ -176,10 +345,11 @@ Optional<QSharedPointer<CuteException>> DriverServer::pollEvents() {
             }
         }
     }, Trilean::yes);
+    locker.unlock();
     if (garbageFound) {
-        locker.unlock();
         _private->garbageCollectEventHandlers();
     }
+    emit instance().polled();
     return {};
 }
 
@@ -190,7 +360,7 @@ void DriverServer::announce(QWeakPointer<TrackingHandler> trackingHandler,
         return;
     }
     auto &_private{instance()._private};
-    QWriteLocker{&_private->announceLock};
+    QWriteLocker locker{&_private->announceLock};
     if (!_private->trackingHandlers.contains(address) || _private->trackingHandlers.value(address).isNull()) {
         _private->trackingHandlers.insert(address, trackingHandler);
     }
@@ -202,21 +372,33 @@ void DriverServer::announce(QWeakPointer<TrackingHandler> trackingHandler,
     }
 }
 
+void DriverServer::announceFrame(QWeakPointer<TrackingHandler> trackingHandler) noexcept {
+    auto const address{reinterpret_cast<qintptr>(trackingHandler.data())};
+    if (trackingHandler.isNull()) {
+        return;
+    }
+    auto &_private{instance()._private};
+    QWriteLocker locker{&_private->announceLock};
+    _private->frameHandlers.insert(address, trackingHandler);
+}
+
 Optional<QSharedPointer<CuteException>> DriverServer::pollTracking() {
-    auto const trackingEnabled{ConfigurationServer::isEnabled(feature(Feature::tracking)).right(false)};
+    auto const trackingEnabled{Profile::isEnabled<Feature::tracking>()};
     if (!trackingEnabled) {
         return {};
     }
-    auto const drawingEnabled{ConfigurationServer::isEnabled(feature(Feature::drawing)).right(false)};
+    auto const drawingEnabled{Profile::isEnabled<Feature::drawing>()};
     auto const &_private{instance()._private};
     bool garbageFound{false};
     QReadLocker locker{&_private->announceLock};
 
     // get tracking poses
     vr::TrackedDevicePose_t vrPoses[vr::k_unMaxTrackedDeviceCount];
+    Internal::TrackingFrame frame{vrPoses, vr::k_unMaxTrackedDeviceCount, vr::TrackingUniverseRawAndUncalibrated};
     DriverServer::synchronized([&] {
         if (drawingEnabled) {
             vr::VRCompositor()->WaitGetPoses(vrPoses, vr::k_unMaxTrackedDeviceCount, nullptr, 0);
+            frame.universe = vr::VRCompositor()->GetTrackingSpace();
         } else {
             vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseRawAndUncalibrated, 0, vrPoses,
                                                             vr::k_unMaxTrackedDeviceCount);
@@ -248,44 +430,147 @@ Optional<QSharedPointer<CuteException>> DriverServer::pollTracking() {
             qDebug("Device pose for device %d not handled.", index);
         }
     }
+
+    // update whole frames
+    for (auto const &frameHandler : _private->frameHandlers) {
+        auto trackingHandler{frameHandler.toStrongRef()};
+        if (!trackingHandler.isNull()) {
+            trackingHandler->handleTracking(&frame);
+        } else {
+            garbageFound = true;
+        }
+    }
+    locker.unlock();
     if (garbageFound) {
-        locker.unlock();
         _private->garbageCollectTrackingHandlers();
     }
+    emit instance().polled();
     return {};
 }
 
 void DriverServer::announce(QWeakPointer<CyclicHandler> cyclicHandler,
-                            std::function<void *(void)> dataProvider) noexcept {
+                            std::function<void *(void)> dataProvider, Schedule const schedule) noexcept {
     auto const address{reinterpret_cast<qintptr>(cyclicHandler.data())};
     if (cyclicHandler.isNull()) {
         return;
     }
     auto const &_private{instance()._private};
-    QWriteLocker{&_private->announceLock};
-    if (!_private->cyclicHandlers.contains(address) || _private->cyclicHandlers.value(address).first.isNull()) {
-        _private->cyclicHandlers.insert(address, qMakePair(cyclicHandler, dataProvider));
+    QWriteLocker locker{&_private->announceLock};
+    if (!_private->cyclicHandlers.contains(address) || _private->cyclicHandlers.value(address).handler.isNull()) {
+        QMutexLocker scheduleLocker{&_private->scheduleLock};
+        Private::CyclicEntry entry{};
+        entry.handler = cyclicHandler;
+        entry.dataProvider = std::move(dataProvider);
+        entry.schedule = schedule;
+        entry.generation = ++_private->generations;
+        _private->cyclicHandlers.insert(address, entry);
+        _private->everyCycle.removeAll(address);
+        if (schedule.period == 0) {
+            auto position{0};
+            while (position < _private->everyCycle.size() &&
+                   _private->cyclicHandlers.value(_private->everyCycle.at(position)).schedule.priority >=
+                   schedule.priority) {
+                position++;
+            }
+            _private->everyCycle.insert(position, address);
+        } else {
+            Private::CyclicTimer timer{};
+            timer.due = _private->clock.nsecsElapsed() + static_cast<qint64>(schedule.phase) * 1000000;
+            timer.priority = schedule.priority;
+            timer.address = address;
+            timer.generation = entry.generation;
+            _private->pushTimer(timer);
+        }
     }
 }
 
 Optional<QSharedPointer<CuteException>> DriverServer::runCycle() {
     auto const &_private{instance()._private};
+    auto const budget{static_cast<qint64>(ConfigurationServer::value(parameter(Parameter::cycleBudget))
+                                                  .right(QVariant{0}).toUInt()) * 1000};
     bool garbageFound{false};
     QReadLocker locker{&_private->announceLock};
+    QMutexLocker scheduleLocker{&_private->scheduleLock};
+    auto const start{_private->clock.nsecsElapsed()};
+
+    // collect the handlers that are due in this cycle, in the order of their priority
+    QVector<Private::CyclicTimer> due{};
+    due.reserve(_private->everyCycle.size());
+    for (auto const address : _private->everyCycle) {
+        Private::CyclicTimer timer{};
+        timer.due = start;
+        timer.priority = _private->cyclicHandlers.value(address).schedule.priority;
+        timer.address = address;
+        timer.generation = _private->cyclicHandlers.value(address).generation;
+        due.append(timer);
+    }
+    auto const everyCycleCount{due.size()};
+    while (!_private->timers.isEmpty() && _private->timers.first().due <= start) {
+        due.append(_private->popTimer());
+    }
+    if (due.size() > everyCycleCount) {
+        std::stable_sort(due.begin(), due.end(), Private::higherPriority);
+    }
 
-    // cycle over all cyclic handlers
-    for (auto const &cyclicHandlerPair : _private->cyclicHandlers) {
-        auto cyclicHandler{cyclicHandlerPair.first.toStrongRef()};
-        if (!cyclicHandler.isNull()) {
-            cyclicHandler->handleCyclic(cyclicHandlerPair.second ? cyclicHandlerPair.second() : nullptr);
-        } else {
+    // resolve the handlers while the schedule is locked, but call them without any lock, so that they may announce
+    QVector<QPair<Private::CyclicTimer, Private::CyclicEntry>> calls{};
+    calls.reserve(due.size());
+    for (auto const &timer : due) {
+        auto const entry{_private->cyclicHandlers.value(timer.address)};
+        if (entry.generation != timer.generation) {
+            continue; // the handler has been removed or replaced since the timer was set
+        }
+        calls.append(qMakePair(timer, entry));
+    }
+    scheduleLocker.unlock();
+    locker.unlock();
+
+    // call them until the time budget is spent, but at least the most important one
+    auto called{0};
+    QVector<Private::CyclicTimer> rescheduled{};
+    for (auto const &call : calls) {
+        auto const &timer{call.first};
+        auto const &entry{call.second};
+        auto const periodic{entry.schedule.period > 0};
+        if (budget > 0 && called > 0 && _private->clock.nsecsElapsed() - start > budget) {
+            if (periodic) {
+                rescheduled.append(timer); // stays due for the next cycle
+            }
+            continue;
+        }
+        auto cyclicHandler{entry.handler.toStrongRef()};
+        if (cyclicHandler.isNull()) {
             garbageFound = true;
+            continue;
+        }
+        cyclicHandler->handleCyclic(entry.dataProvider ? entry.dataProvider() : nullptr);
+        called++;
+        if (periodic) {
+            auto const period{static_cast<qint64>(entry.schedule.period) * 1000000};
+            auto next{timer};
+            next.due += period;
+            if (next.due <= start) {
+                next.due = start + period; // skip missed periods instead of calling the handler in a burst
+            }
+            rescheduled.append(next);
         }
     }
-    if (garbageFound) {
+    if (!rescheduled.isEmpty()) {
+        locker.relock();
+        scheduleLocker.relock();
+        for (auto const &timer : rescheduled) {
+            // handlers that have been removed or replaced meanwhile already have their own timer
+            if (_private->cyclicHandlers.value(timer.address).generation == timer.generation) {
+                _private->pushTimer(timer);
+            }
+        }
+        scheduleLocker.unlock();
         locker.unlock();
+    }
+    if (garbageFound) {
         _private->garbageCollectCyclicHandlers();
     }
+    emit instance().polled();
     return {};
 }
 
@@ -343,8 +628,8 @@ void DriverServer::destroy() {
 }
 
 Optional<QSharedPointer<CuteException>> DriverServer::destroy2() {
-    auto const cellEnabled{ConfigurationServer::isEnabled(feature(Feature::cell)).right(false)};
-    auto const drawingEnabled{ConfigurationServer::isEnabled(feature(Feature::drawing)).right(false)};
+    auto const cellEnabled{Profile::isEnabled<Feature::cell>()};
+    auto const drawingEnabled{Profile::isEnabled<Feature::drawing>()};
     auto const driverLockWarn{ConfigurationServer::value(parameter(Parameter::driverLockWarn)).right(QVariant{5000})};
     auto const driverLockAbort{ConfigurationServer::value(parameter(Parameter::driverLockAbort)).right(QVariant{5000})};
     Optional<QSharedPointer<CuteException>> exception{};
@@ -366,16 +651,19 @@ Optional<QSharedPointer<CuteException>> DriverServer::destroy2() {
         }
     }
 
+    // finish all calls that are still queued for the driver thread, from now on calls are locked again
+    _private->driverThread.halt();
+
     try {
         // test if system has already been shutdown
-        if (!_private->initialized) {
+        if (!_private->initialized.load()) {
             exception.setValue(AlreadyTerminated::create(AlreadyTerminated::Severity::warning, 0,
                                                          "Driver has already been terminated.",
                                                          exception.value(QSharedPointer<CuteException>{})));
             _private->mutex.unlock();
             return exception;
         } else if (!vr::VRSystem()) {
-            _private->initialized = false;
+            _private->initialized.store(0);
             AlreadyTerminated::create(AlreadyTerminated::Severity::critical, 0,
                                       "Driver has already been terminated but not by this method.",
                                       exception.value(QSharedPointer<CuteException>{}))->raise();
@@ -403,7 +691,8 @@ Optional<QSharedPointer<CuteException>> DriverServer::destroy2() {
                                                exception.value(QSharedPointer<CuteException>{}))->raise();
         }
 
-        _private->initialized = false;
+        _private->initialized.store(0);
+        Internal::PropertyCache::clear();
     } catch (...) {
         _private->mutex.unlock();
         throw;
@@ -414,7 +703,7 @@ Optional<QSharedPointer<CuteException>> DriverServer::destroy2() {
 
 bool DriverServer::isDestroyed() const noexcept {
     QReadLocker{&_private->mutex};
-    return !_private->initialized;
+    return !_private->initialized.load();
 }
 
 void DriverServer::initialize() {
@@ -422,8 +711,8 @@ void DriverServer::initialize() {
 }
 
 Optional<QSharedPointer<CuteException>> DriverServer::initialize2() {
-    auto const cellEnabled{ConfigurationServer::isEnabled(feature(Feature::cell)).right(false)};
-    auto const drawingEnabled{ConfigurationServer::isEnabled(feature(Feature::drawing)).right(false)};
+    auto const cellEnabled{Profile::isEnabled<Feature::cell>()};
+    auto const drawingEnabled{Profile::isEnabled<Feature::drawing>()};
     auto const driverLockWarn{ConfigurationServer::value(parameter(Parameter::driverLockWarn)).right(QVariant{5000})};
     auto const driverLockAbort{ConfigurationServer::value(parameter(Parameter::driverLockAbort)).right(QVariant{5000})};
     Optional<QSharedPointer<CuteException>> exception{};
@@ -456,13 +745,13 @@ Optional<QSharedPointer<CuteException>> DriverServer::initialize2() {
 
     try {
         // test if system has already been initialized
-        if (_private->initialized) {
+        if (_private->initialized.load()) {
             exception.setValue(AlreadyInitialized::create(AlreadyInitialized::Severity::warning, 0,
                                                           "Driver has already been initialized.",
                                                           exception.value(QSharedPointer<CuteException>{})));
             return exception;
         } else if (vr::VRSystem() != nullptr) {
-            _private->initialized = true;
+            _private->initialized.store(1);
             AlreadyInitialized::create(AlreadyInitialized::Severity::critical, 0,
                                        "Driver has not been initialized properly by this method.",
                                        exception.value(QSharedPointer<CuteException>{}))->raise();
@@ -530,7 +819,11 @@ Optional<QSharedPointer<CuteException>> DriverServer::initialize2() {
         }
 
         // set new state, the system can potentially be used now
-        _private->initialized = true;
+        _private->initialized.store(1);
+        if (Profile::isEnabled<Feature::driverThread>()) {
+            _private->driverThread.launch();
+            qInfo("Driver calls are serialized on the driver thread.");
+        }
     } catch (...) {
         vr::VR_Shutdown();
         throw;
@@ -540,7 +833,7 @@ Optional<QSharedPointer<CuteException>> DriverServer::initialize2() {
 
 bool DriverServer::isInitialized() const noexcept {
     QReadLocker{&_private->mutex};
-    return _private->initialized;
+    return _private->initialized.load() != 0;
 }
 
 DriverServer::DriverServer() :
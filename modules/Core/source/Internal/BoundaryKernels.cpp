@@ -0,0 +1,193 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <CuteVR/Components/Geometry/Cube.hpp>
+#include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Components/Geometry/Sphere.hpp>
+#include <CuteVR/Internal/BoundaryKernels.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cube;
+using Components::Geometry::Cuboid;
+using Components::Geometry::Sphere;
+using Internal::BoundaryKernels::InstructionSet;
+using Internal::BoundaryKernels::Shape;
+
+static_assert(sizeof(QVector3D) == 3 * sizeof(float), "A vector must consist of its packed components.");
+
+namespace {
+    // like the transform kernels, the math is written once against a lane type, which is either a single float or
+    // four floats in a register
+
+    template<class F>
+    struct Points {
+        F x, y, z;
+    };
+
+    inline float splat(float const value, float) noexcept {
+        return value;
+    }
+
+    inline float absoluteOf(float const value) noexcept {
+        return std::abs(value);
+    }
+
+    inline float maximumOf(float const left, float const right) noexcept {
+        return std::max(left, right);
+    }
+
+    inline float minimumOf(float const left, float const right) noexcept {
+        return std::min(left, right);
+    }
+
+    inline float sqrtOf(float const value) noexcept {
+        return std::sqrt(value);
+    }
+
+    inline Points<float> load(float const *source, float) noexcept {
+        return {source[0], source[1], source[2]};
+    }
+
+    inline void store(float const distance, float *target) noexcept {
+        *target = distance;
+    }
+
+#ifdef CUTE_VR_SIMD_SSE2
+    struct Lanes {
+        __m128 v;
+    };
+
+    inline Lanes splat(float const value, Lanes) noexcept {
+        return {_mm_set1_ps(value)};
+    }
+
+    inline Lanes operator+(Lanes const left, Lanes const right) noexcept {
+        return {_mm_add_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator-(Lanes const left, Lanes const right) noexcept {
+        return {_mm_sub_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator*(Lanes const left, Lanes const right) noexcept {
+        return {_mm_mul_ps(left.v, right.v)};
+    }
+
+    inline Lanes absoluteOf(Lanes const lanes) noexcept {
+        return {_mm_andnot_ps(_mm_set1_ps(-0.0f), lanes.v)};
+    }
+
+    inline Lanes maximumOf(Lanes const left, Lanes const right) noexcept {
+        return {_mm_max_ps(left.v, right.v)};
+    }
+
+    inline Lanes minimumOf(Lanes const left, Lanes const right) noexcept {
+        return {_mm_min_ps(left.v, right.v)};
+    }
+
+    inline Lanes sqrtOf(Lanes const lanes) noexcept {
+        return {_mm_sqrt_ps(lanes.v)};
+    }
+
+    inline Points<Lanes> load(float const *source, Lanes) noexcept {
+        return {{_mm_setr_ps(source[0], source[3], source[6], source[9])},
+                {_mm_setr_ps(source[1], source[4], source[7], source[10])},
+                {_mm_setr_ps(source[2], source[5], source[8], source[11])}};
+    }
+
+    inline void store(Lanes const distances, float *target) noexcept {
+        _mm_storeu_ps(target, distances.v);
+    }
+#endif
+
+    /// row-major rotation and translation of the transform into the coordinate system of the shape
+    struct Affine {
+        float m[3][4];
+    };
+
+    template<class F>
+    Points<F> transformed(Affine const &affine, Points<F> const &points) noexcept {
+        Points<F> result{};
+        F *axes[3]{&result.x, &result.y, &result.z};
+        for (auto row = 0; row < 3; row++) {
+            auto const &m{affine.m[row]};
+            *axes[row] = splat(m[0], F{}) * points.x + splat(m[1], F{}) * points.y + splat(m[2], F{}) * points.z +
+                         splat(m[3], F{});
+        }
+        return result;
+    }
+
+    template<class F>
+    F boxDistance(QVector3D const &halfExtents, Points<F> const &points) noexcept {
+        auto const zero{splat(0.0f, F{})};
+        auto const x{absoluteOf(points.x) - splat(halfExtents.x(), F{})};
+        auto const y{absoluteOf(points.y) - splat(halfExtents.y(), F{})};
+        auto const z{absoluteOf(points.z) - splat(halfExtents.z(), F{})};
+        auto const outsideX{maximumOf(x, zero)}, outsideY{maximumOf(y, zero)}, outsideZ{maximumOf(z, zero)};
+        auto const outside{sqrtOf(outsideX * outsideX + outsideY * outsideY + outsideZ * outsideZ)};
+        return outside + minimumOf(maximumOf(x, maximumOf(y, z)), zero);
+    }
+
+    template<class F>
+    F sphereDistance(float const radius, Points<F> const &points) noexcept {
+        return sqrtOf(points.x * points.x + points.y * points.y + points.z * points.z) - splat(radius, F{});
+    }
+
+    template<class F>
+    qint32 evaluate(Shape const &shape, Affine const &affine, float const *points, float *result, qint32 index,
+                    qint32 const count, qint32 const width) noexcept {
+        for (; index + width <= count; index += width) {
+            auto const local{transformed(affine, load(points + index * 3, F{}))};
+            store(shape.type == Shape::Type::box ? boxDistance(shape.halfExtents, local)
+                                                 : sphereDistance(shape.radius, local), result + index);
+        }
+        return index;
+    }
+}
+
+Shape Internal::BoundaryKernels::shape(CategorizedComponent<Component::Category::geometry> const *geometry) {
+    Shape shape{};
+    if (auto const *cube = dynamic_cast<Cube const *>(geometry)) {
+        auto const half{static_cast<float>(cube->a / 2)};
+        shape.type = Shape::Type::box;
+        shape.halfExtents = QVector3D{half, half, half};
+    } else if (auto const *cuboid = dynamic_cast<Cuboid const *>(geometry)) {
+        shape.type = Shape::Type::box;
+        shape.halfExtents = QVector3D{static_cast<float>(cuboid->a / 2), static_cast<float>(cuboid->b / 2),
+                                      static_cast<float>(cuboid->c / 2)};
+    } else if (auto const *sphere = dynamic_cast<Sphere const *>(geometry)) {
+        shape.type = Shape::Type::sphere;
+        shape.radius = static_cast<float>(sphere->r);
+    }
+    return shape;
+}
+
+void Internal::BoundaryKernels::distances(Shape const &shape, QMatrix4x4 const &toShape, QVector3D const *points,
+                                          float *result, qint32 const count, InstructionSet const set) {
+    if (shape.type == Shape::Type::none) {
+        std::fill(result, result + count, -std::numeric_limits<float>::infinity());
+        return;
+    }
+    Affine affine{};
+    for (auto row = 0; row < 3; row++) {
+        for (auto column = 0; column < 4; column++) {
+            affine.m[row][column] = toShape(row, column);
+        }
+    }
+    auto const *const packed{reinterpret_cast<float const *>(points)};
+    auto index{0};
+#ifdef CUTE_VR_SIMD_SSE2
+    if (Simd::select(set) != InstructionSet::scalar) {
+        index = evaluate<Lanes>(shape, affine, packed, result, index, count, 4);
+    }
+#else
+    Q_UNUSED(set);
+#endif
+    evaluate<float>(shape, affine, packed, result, index, count, 1);
+}
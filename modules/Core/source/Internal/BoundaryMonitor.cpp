@@ -0,0 +1,68 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <algorithm>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include <CuteVR/Internal/BoundaryMonitor.hpp>
+
+using namespace CuteVR;
+using Internal::BoundaryKernels::Shape;
+using Internal::BoundaryMonitor;
+
+class BoundaryMonitor::Private {
+public: // variables
+    QHash<Identifier, System::BoundaryState> states{};
+    // the buffers keep their capacity between evaluations
+    QVector<QVector3D> points{};
+    QVector<float> distances{};
+};
+
+BoundaryMonitor::BoundaryMonitor() :
+        _private{new Private} {}
+
+BoundaryMonitor::~BoundaryMonitor() = default;
+
+BoundaryMonitor::Evaluation BoundaryMonitor::evaluate(System::Cell::Boundary const &boundary,
+                                                      QMap<Identifier, QVector3D> const &positions,
+                                                      qreal const nearDistance, BoundaryKernels::InstructionSet set) {
+    Evaluation evaluation{};
+    auto const shape{BoundaryKernels::shape(boundary.second.data())};
+    if (shape.type == Shape::Type::none) {
+        _private->states.clear();
+        return evaluation;
+    }
+    _private->points.resize(positions.size());
+    _private->distances.resize(positions.size());
+    std::copy(positions.cbegin(), positions.cend(), _private->points.begin());
+    BoundaryKernels::distances(shape, boundary.first.inverted(), _private->points.constData(),
+                               _private->distances.data(), positions.size(), set);
+
+    QHash<Identifier, System::BoundaryState> states{};
+    auto index{0};
+    for (auto iterator = positions.cbegin(); iterator != positions.cend(); ++iterator, index++) {
+        auto const distance{static_cast<qreal>(_private->distances.at(index))};
+        auto const state{classify(distance, nearDistance)};
+        evaluation.distances.insert(iterator.key(), distance);
+        if (state != _private->states.value(iterator.key(), System::BoundaryState::inside)) {
+            evaluation.transitions.append(Transition{iterator.key(), state});
+        }
+        states.insert(iterator.key(), state);
+    }
+    _private->states.swap(states);
+    return evaluation;
+}
+
+void BoundaryMonitor::clear() {
+    _private->states.clear();
+}
+
+System::BoundaryState BoundaryMonitor::classify(qreal const distance, qreal const nearDistance) noexcept {
+    if (distance > 0.0) {
+        return System::BoundaryState::outside;
+    }
+    return distance > -nearDistance ? System::BoundaryState::near : System::BoundaryState::inside;
+}
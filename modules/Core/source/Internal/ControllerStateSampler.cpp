@@ -0,0 +1,69 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QMutex>
+#include <openvr.h>
+
+#include <CuteVR/Internal/ControllerStateSampler.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Extension::Trilean;
+using Interface::CyclicHandler;
+using Internal::ControllerStateSampler;
+
+class ControllerStateSampler::Private {
+public: // constructor
+    Private(ControllerStateSampler *that, Identifier const device, QList<QWeakPointer<CyclicHandler>> consumers) :
+            that{that},
+            device{device},
+            consumers{std::move(consumers)} {}
+
+public: // variables
+    ControllerStateSampler *that{nullptr};
+    Identifier device{};
+    QList<QWeakPointer<CyclicHandler>> consumers{};
+    QMutex sampleLock{};
+    bool sampled{false};
+    quint32 packetNumber{0};
+    quint64 samples{0};
+};
+
+ControllerStateSampler::ControllerStateSampler(Identifier const device, QList<QWeakPointer<CyclicHandler>> consumers) :
+        _private{new Private{this, device, std::move(consumers)}} {}
+
+ControllerStateSampler::~ControllerStateSampler() = default;
+
+quint64 ControllerStateSampler::samples() const noexcept {
+    QMutexLocker locker{&_private->sampleLock};
+    return _private->samples;
+}
+
+bool ControllerStateSampler::handleCyclic(void const *) {
+    vr::VRControllerState_t state{};
+    auto valid{false};
+    DriverServer::synchronized([&] {
+        valid = vr::VRSystem()->GetControllerState(_private->device, &state, (sizeof(vr::VRControllerState_t)));
+    }, Trilean::yes);
+    {
+        QMutexLocker locker{&_private->sampleLock};
+        // the packet number only increases if the state has changed since the last read, until the first valid
+        // state the consumers get the empty state so that they can publish their defaults
+        if (_private->sampled && (!valid || state.unPacketNum == _private->packetNumber)) {
+            return false;
+        }
+        _private->sampled = valid;
+        _private->packetNumber = state.unPacketNum;
+        _private->samples++;
+    }
+    auto processed{false};
+    for (auto const &consumer : _private->consumers) {
+        auto const strongConsumer{consumer.toStrongRef()};
+        if (!strongConsumer.isNull()) {
+            processed = strongConsumer->handleCyclic(&state) || processed;
+        }
+    }
+    return processed;
+}
@@ -3,6 +3,7 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <QtCore/QHash>
 #include <QtCore/QList>
 #include <openvr.h>
 
@@ -22,7 +23,6 @@ public: // constructor
             device{device},
             callback{std::move(callback)} {
         queryAxisIdentifiers();
-        queryAxes();
     }
 
 public: // methods
@@ -59,11 +59,21 @@ public: // methods
         DriverServer::synchronized([&] {
             vr::VRSystem()->GetControllerState(device, &state, (sizeof(vr::VRControllerState_t)));
         }, Trilean::yes);
+        applyState(state);
+    }
+
+    void applyState(vr::VRControllerState_t const &state) {
         for (auto const axisIdentifier : axisIdentifiers) {
+            auto const position{(axisIdentifier % 2) == 0 ? state.rAxis[axisIdentifier / 2].x
+                                                          : state.rAxis[axisIdentifier / 2].y};
+            // only axes that have moved since the last state are reported
+            if (positions.contains(axisIdentifier) && qFuzzyCompare(positions.value(axisIdentifier), position)) {
+                continue;
+            }
+            positions.insert(axisIdentifier, position);
             Axis axis{};
             axis.identifier = axisIdentifier;
-            axis.position = (axisIdentifier % 2) == 0 ? state.rAxis[axisIdentifier / 2].x
-                                                      : state.rAxis[axisIdentifier / 2].y;
+            axis.position = position;
             callback(axis);
         }
     }
@@ -73,6 +83,7 @@ public: // variables
     Identifier device{};
     std::function<void(Axis const &)> callback{};
     QList<Identifier> axisIdentifiers{};
+    QHash<Identifier, float> positions{};
 };
 
 DefaultAxesProvider::DefaultAxesProvider(Identifier const device, std::function<void(Axis const &)> callback) :
@@ -80,7 +91,11 @@ DefaultAxesProvider::DefaultAxesProvider(Identifier const device, std::function<
 
 DefaultAxesProvider::~DefaultAxesProvider() = default;
 
-bool DefaultAxesProvider::handleCyclic(void const *) {
-    _private->queryAxes();
-    return false;
+bool DefaultAxesProvider::handleCyclic(void const *data) {
+    if (data == nullptr) {
+        _private->queryAxes();
+    } else {
+        _private->applyState(*static_cast<vr::VRControllerState_t const *>(data));
+    }
+    return data != nullptr;
 }
@@ -0,0 +1,71 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <openvr.h>
+
+#include <CuteVR/Internal/DefaultBatteriesProvider.hpp>
+#include <CuteVR/Internal/Property.hpp>
+
+using namespace CuteVR;
+using Components::Peripheral::Battery;
+using Extension::Trilean;
+using Internal::DefaultBatteriesProvider;
+using Internal::Property::fetch;
+using Internal::Property::query;
+
+constexpr quint32 DefaultBatteriesProvider::period;
+
+class DefaultBatteriesProvider::Private {
+public: // constructor
+    Private(DefaultBatteriesProvider *that, Identifier const device, std::function<void(Battery const &)> callback) :
+            that{that},
+            device{device},
+            callback{std::move(callback)} {
+        hasBattery = query<bool>(device, vr::Prop_DeviceProvidesBatteryStatus_Bool);
+        if (hasBattery) {
+            queryBattery();
+        }
+    }
+
+public: // methods
+    void queryBattery() {
+        bool charging{};
+        float level{};
+        // both properties change all the time, so they are fetched instead of being served from the cache
+        DriverServer::Batch batch{};
+        batch.submit([&] { charging = fetch<bool>(device, vr::Prop_DeviceIsCharging_Bool); });
+        batch.submit([&] { level = fetch<float>(device, vr::Prop_DeviceBatteryPercentage_Float); });
+        DriverServer::execute(batch, Trilean::yes);
+        Battery battery{};
+        battery.identifier = 0;
+        battery.charging = static_cast<Trilean>(charging);
+        battery.level = level;
+        callback(battery);
+    }
+
+public: // variables
+    DefaultBatteriesProvider *that{nullptr};
+    Identifier device{};
+    std::function<void(Battery const &)> callback{};
+    bool hasBattery{false};
+};
+
+DefaultBatteriesProvider::DefaultBatteriesProvider(Identifier const device,
+                                                   std::function<void(Battery const &)> callback) :
+        _private{new Private{this, device, std::move(callback)}} {}
+
+DefaultBatteriesProvider::~DefaultBatteriesProvider() = default;
+
+bool DefaultBatteriesProvider::hasBattery() const noexcept {
+    return _private->hasBattery;
+}
+
+bool DefaultBatteriesProvider::handleCyclic(void const *) {
+    if (!_private->hasBattery) {
+        return false;
+    }
+    _private->queryBattery();
+    return true;
+}
@@ -0,0 +1,76 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <openvr.h>
+
+#include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Internal/DefaultBoundaryProvider.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cuboid;
+using Configurations::Core::Parameter;
+using Configurations::parameter;
+using Extension::Trilean;
+using Internal::DefaultBoundaryProvider;
+
+class DefaultBoundaryProvider::Private {
+public: // constructor
+    explicit Private(DefaultBoundaryProvider *that, std::function<void(System::Cell::Boundary const &)> callback) :
+            that{that},
+            callback{std::move(callback)} {}
+
+public: // variables
+    DefaultBoundaryProvider *that{nullptr};
+    std::function<void(System::Cell::Boundary const &)> callback{};
+};
+
+DefaultBoundaryProvider::DefaultBoundaryProvider(std::function<void(System::Cell::Boundary const &)> callback) :
+        _private{new Private{this, std::move(callback)}} {}
+
+DefaultBoundaryProvider::~DefaultBoundaryProvider() = default;
+
+bool DefaultBoundaryProvider::handleEvent(void const *event, void const *) {
+    auto const *theEvent(static_cast<vr::VREvent_t const *>(event));
+    if (theEvent == nullptr) {
+        return false;
+    }
+    switch (theEvent->eventType) {
+        case vr::VREvent_ChaperoneDataHasChanged:
+        case vr::VREvent_ChaperoneUniverseHasChanged: {
+            query();
+            return true;
+        }
+        default: return false;
+    }
+}
+
+void DefaultBoundaryProvider::query() {
+    auto calibrated{false};
+    auto width{0.0f};
+    auto depth{0.0f};
+    DriverServer::synchronized([&] {
+        if (vr::VRChaperone() == nullptr) {
+            return;
+        }
+        // warnings still describe a usable play area, whereas errors do not
+        auto const state{vr::VRChaperone()->GetCalibrationState()};
+        calibrated = state < vr::ChaperoneCalibrationState_Error &&
+                     vr::VRChaperone()->GetPlayAreaSize(&width, &depth);
+    }, Trilean::yes);
+    System::Cell::Boundary boundary{};
+    if (calibrated && width > 0.0f && depth > 0.0f) {
+        auto const height{ConfigurationServer::value(parameter(Parameter::boundaryHeight)).right(QVariant{2.5})
+                                                                                         .toDouble()};
+        QSharedPointer<Cuboid> cuboid{new Cuboid{}};
+        cuboid->a = width;
+        cuboid->b = height;
+        cuboid->c = depth;
+        boundary.first.translate(0.0f, static_cast<float>(height / 2), 0.0f);
+        boundary.second = cuboid;
+    }
+    _private->callback(boundary);
+}
@@ -3,6 +3,8 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <openvr.h>
 
 #include <CuteVR/Internal/DefaultButtonsProvider.hpp>
@@ -20,46 +22,89 @@ public: // constructor
             that{that},
             device{device},
             callback{std::move(callback)} {
-        queryButtonIdentifiers();
-        queryButtons();
+        supportedButtons = query<quint64>(device, vr::Prop_SupportedButtons_Uint64);
     }
 
 public: // methods
-    void queryButtonIdentifiers() {
-        auto const supportedButtons{query<quint64>(device, vr::Prop_SupportedButtons_Uint64)};
-        for (Identifier bit = 0; bit < 64; bit++) {
-            if ((supportedButtons & (1ULL << bit))) {
-                buttonIdentifiers.append(bit);
+    void queryButtons() {
+        vr::VRControllerState_t state{};
+        DriverServer::synchronized([&] {
+            vr::VRSystem()->GetControllerState(device, &state, (sizeof(vr::VRControllerState_t)));
+        }, Trilean::yes);
+        applyMasks(state.ulButtonPressed, state.ulButtonTouched);
+    }
+
+    void applyMasks(quint64 const nextPressed, quint64 const nextTouched) {
+        QList<Button> changedButtons{};
+        {
+            QMutexLocker locker{&maskLock};
+            changedButtons = transition(nextPressed, nextTouched);
+        }
+        report(changedButtons);
+    }
+
+    void applyEvent(vr::EVREventType const type, Identifier const identifier) {
+        if (identifier >= 64) {
+            return;
+        }
+        auto const mask{vr::ButtonMaskFromId(static_cast<vr::EVRButtonId>(identifier))};
+        QList<Button> changedButtons{};
+        {
+            QMutexLocker locker{&maskLock};
+            auto nextPressed{pressed}, nextTouched{touched};
+            switch (type) {
+                case vr::VREvent_ButtonPress: nextPressed |= mask; break;
+                case vr::VREvent_ButtonUnpress: nextPressed &= ~mask; break;
+                case vr::VREvent_ButtonTouch: nextTouched |= mask; break;
+                case vr::VREvent_ButtonUntouch: nextTouched &= ~mask; break;
+                default: break;
             }
+            changedButtons = transition(nextPressed, nextTouched);
         }
+        report(changedButtons);
     }
 
-    void queryButtons() {
-        for (auto const buttonIdentifier : buttonIdentifiers) {
-            queryButton(buttonIdentifier);
+    /// @attention The mask lock must be held by the caller.
+    QList<Button> transition(quint64 const nextPressed, quint64 const nextTouched) {
+        // the first state reports every supported button, afterwards only the transitions are reported
+        auto const changedMask{sampled ? ((pressed ^ nextPressed) | (touched ^ nextTouched)) & supportedButtons
+                                       : supportedButtons};
+        pressed = nextPressed;
+        touched = nextTouched;
+        sampled = true;
+        QList<Button> changedButtons{};
+        for (Identifier bit = 0; bit < 64; bit++) {
+            if ((changedMask & (1ULL << bit))) {
+                changedButtons.append(button(bit));
+            }
         }
+        return changedButtons;
     }
 
-    void queryButton(Identifier identifier) {
-        vr::VRControllerState_t state{};
-        DriverServer::synchronized([&] {
-            vr::VRSystem()->GetControllerState(device, &state, (sizeof(vr::VRControllerState_t)));
-        }, Trilean::yes);
+    void report(QList<Button> const &changedButtons) const {
+        for (auto const &changedButton : changedButtons) {
+            callback(changedButton);
+        }
+    }
 
+    Button button(Identifier const identifier) const {
+        auto const mask{vr::ButtonMaskFromId(static_cast<vr::EVRButtonId>(identifier))};
         Button button{};
         button.identifier = identifier;
-        button.pressed = static_cast<Trilean>((state.ulButtonPressed &
-                                               vr::ButtonMaskFromId((vr::EVRButtonId) identifier)) > 0);
-        button.touched = static_cast<Trilean>((state.ulButtonTouched &
-                                               vr::ButtonMaskFromId((vr::EVRButtonId) identifier)) > 0);
-        callback(button);
+        button.pressed = static_cast<Trilean>((pressed & mask) > 0);
+        button.touched = static_cast<Trilean>((touched & mask) > 0);
+        return button;
     }
 
 public: // variables
     DefaultButtonsProvider *that{nullptr};
     Identifier device{};
     std::function<void(Button const &)> callback{};
-    QList<Identifier> buttonIdentifiers{};
+    quint64 supportedButtons{0};
+    QMutex maskLock{};
+    bool sampled{false};
+    quint64 pressed{0};
+    quint64 touched{0};
 };
 
 DefaultButtonsProvider::DefaultButtonsProvider(Identifier const device, std::function<void(Button const &)> callback) :
@@ -67,6 +112,16 @@ DefaultButtonsProvider::DefaultButtonsProvider(Identifier const device, std::fun
 
 DefaultButtonsProvider::~DefaultButtonsProvider() = default;
 
+bool DefaultButtonsProvider::handleCyclic(void const *data) {
+    if (data == nullptr) {
+        _private->queryButtons();
+    } else {
+        auto const *state{static_cast<vr::VRControllerState_t const *>(data)};
+        _private->applyMasks(state->ulButtonPressed, state->ulButtonTouched);
+    }
+    return data != nullptr;
+}
+
 bool DefaultButtonsProvider::handleEvent(void const *event, void const *) {
     auto const *theEvent(static_cast<vr::VREvent_t const *>(event));
     if (theEvent == nullptr) {
@@ -77,7 +132,8 @@ bool DefaultButtonsProvider::handleEvent(void const *event, void const *) {
         case vr::VREvent_ButtonUnpress:
         case vr::VREvent_ButtonTouch:
         case vr::VREvent_ButtonUntouch: {
-            _private->queryButton(theEvent->data.controller.button);
+            // the event itself tells the transition, so there is no need to ask the driver for the whole state
+            _private->applyEvent(static_cast<vr::EVREventType>(theEvent->eventType), theEvent->data.controller.button);
             return true;
         }
         default: return false;
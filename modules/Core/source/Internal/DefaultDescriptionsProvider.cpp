@@ -4,6 +4,7 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <QtCore/QList>
+#include <QtCore/QVector>
 #include <openvr.h>
 
 #include <CuteVR/Internal/DefaultDescriptionsProvider.hpp>
@@ -12,7 +13,9 @@
 
 using namespace CuteVR;
 using Components::Description;
+using Extension::Trilean;
 using Internal::DefaultDescriptionsProvider;
+using Internal::Property::load;
 using Internal::Property::query;
 
 class DefaultDescriptionsProvider::Private {
@@ -27,15 +30,32 @@ public: // constructor
 
 public: // methods
     void queryDescriptions() {
-        queryDescription(vr::Prop_ManufacturerName_String);
-        queryDescription(vr::Prop_TrackingSystemName_String);
-        // FIXME: currently unknown queryDescription(vr::Prop_HardwareName_String);
-        queryDescription(vr::Prop_HardwareRevision_String);
-        queryDescription(vr::Prop_ModelNumber_String);
-        queryDescription(vr::Prop_SerialNumber_String);
+        QList<vr::ETrackedDeviceProperty> const types{
+                vr::Prop_ManufacturerName_String,
+                vr::Prop_TrackingSystemName_String,
+                // FIXME: currently unknown vr::Prop_HardwareName_String,
+                vr::Prop_HardwareRevision_String,
+                vr::Prop_ModelNumber_String,
+                vr::Prop_SerialNumber_String,
+        };
+        QVector<QString> values(types.size());
+        DriverServer::Batch batch{};
+        for (auto index = 0; index < types.size(); index++) {
+            batch.submit([&, index] {
+                values[index] = load<QString>(device, types.at(index));
+            });
+        }
+        DriverServer::execute(batch, Trilean::yes);
+        for (auto index = 0; index < types.size(); index++) {
+            publishDescription(types.at(index), values.at(index));
+        }
     }
 
     void queryDescription(vr::ETrackedDeviceProperty const type) {
+        publishDescription(type, query<QString>(device, type));
+    }
+
+    void publishDescription(vr::ETrackedDeviceProperty const type, QString const &value) {
         QMap<vr::ETrackedDeviceProperty, Description::Type> const typeMapping{
                 {vr::Prop_ManufacturerName_String,   Description::Type::manufacturerName},
                 {vr::Prop_TrackingSystemName_String, Description::Type::trackingSystemName},
@@ -47,7 +67,7 @@ public: // methods
         Description description{};
         description.identifier = static_cast<Identifier >(type);
         description.type = typeMapping.value(type, Description::Type::undefined);
-        description.append(query<QString>(device, type));
+        description.append(value);
         callback(description);
     }
 
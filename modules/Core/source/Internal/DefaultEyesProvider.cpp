@@ -4,6 +4,7 @@
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
 #include <QtCore/QMap>
+#include <QtCore/QMutex>
 
 #include <CuteVR/Configurations/Core.hpp>
 #include <CuteVR/Internal/DefaultEyesProvider.hpp>
@@ -18,48 +19,91 @@ using Configurations::parameter;
 using Extension::Trilean;
 using Internal::DefaultEyesProvider;
 using Internal::Matrix4x4::from;
-using Internal::Property::query;
+using Internal::Property::load;
 
 class DefaultEyesProvider::Private {
-public: // constructor
+public: // types
+    /// Everything the projection and the head transform of an eye depend on.
+    struct Key {
+        float ipd{};
+        float zNear{};
+        float zFar{};
+
+        bool operator==(Key const &other) const noexcept {
+            return ipd == other.ipd && zNear == other.zNear && zFar == other.zFar;
+        }
+    };
+
+public: // constructor/destructor
     explicit Private(DefaultEyesProvider *that, Identifier const device, std::function<void(Eye const &)> callback) :
             that{that},
             device{device},
             callback{std::move(callback)} {
-        queryEyes();
+        queryEyes(load<float>(device, vr::Prop_UserIpdMeters_Float));
+        parameterConnection = QObject::connect(
+                &ConfigurationServer::instance(), &ConfigurationServer::parameterChanged,
+                [this](ConfigurationServer::Parameter const changed, QVariant const &) {
+                    if (changed == parameter(Parameter::zNear) || changed == parameter(Parameter::zFar)) {
+                        queryEyes(load<float>(this->device, vr::Prop_UserIpdMeters_Float));
+                    }
+                });
+    }
+
+    ~Private() {
+        QObject::disconnect(parameterConnection);
     }
 
 public: // methods
-    void queryEyes() {
-        queryEye(vr::EVREye::Eye_Left);
-        queryEye(vr::EVREye::Eye_Right);
+    /// Fetches both eyes again, unless neither the distance between the eyes nor the clipping planes have changed.
+    void queryEyes(float const ipd) {
+        QMutexLocker locker{&queryLock};
+        auto const zNearCandidate{load<float>(device, vr::Prop_UserHeadToEyeDepthMeters_Float)};
+        Key key{};
+        key.ipd = ipd;
+        key.zNear = ConfigurationServer::value(parameter(Parameter::zNear)).right(QVariant{zNearCandidate}).toFloat();
+        key.zFar = ConfigurationServer::value(parameter(Parameter::zFar)).right(QVariant{zNearCandidate * 1e4f})
+                                                                          .toFloat();
+        if (queried && key == lastKey) {
+            return;
+        }
+        Eye left{};
+        Eye right{};
+        DriverServer::Batch batch{};
+        batch.submit([&] {
+            left = fetchEye(vr::EVREye::Eye_Left, key);
+        });
+        batch.submit([&] {
+            right = fetchEye(vr::EVREye::Eye_Right, key);
+        });
+        DriverServer::execute(batch, Trilean::yes);
+        lastKey = key;
+        queried = true;
+        callback(left);
+        callback(right);
     }
 
-    void queryEye(vr::EVREye const type) {
+    Eye fetchEye(vr::EVREye const type, Key const &key) {
         QMap<vr::EVREye, Eye::Type> const typeMapping{
                 {vr::EVREye::Eye_Left, Eye::Type::left},
                 {vr::EVREye::Eye_Right, Eye::Type::right},
                 // FIXME: not available yet {vr::EVREye::Eye_Center, Eye::Type::both},
         };
-        auto const zNearCandidate{query<float>(device, vr::Prop_UserHeadToEyeDepthMeters_Float)};
-        auto const zNear{ConfigurationServer::value(parameter(Parameter::zNear)).right(QVariant{zNearCandidate})
-                                                                                .toFloat()};
-        auto const zFar{ConfigurationServer::value(parameter(Parameter::zFar)).right(QVariant{zNearCandidate * 1e4f})
-                                                                               .toFloat()};
         Eye eye{};
         eye.identifier = static_cast<Identifier>(type);
         eye.type = typeMapping.value(type, Eye::Type::undefined);
-        DriverServer::synchronized([&] {
-            eye.perspectiveProjection = from(vr::VRSystem()->GetProjectionMatrix(type, zNear, zFar));
-            eye.headTransform = from(vr::VRSystem()->GetEyeToHeadTransform(type));
-        }, Trilean::yes);
-        callback(eye);
+        eye.perspectiveProjection = from(vr::VRSystem()->GetProjectionMatrix(type, key.zNear, key.zFar));
+        eye.headTransform = from(vr::VRSystem()->GetEyeToHeadTransform(type));
+        return eye;
     }
 
 public: // variables
     DefaultEyesProvider *that{nullptr};
     Identifier device{};
     std::function<void(Eye const &)> callback{};
+    QMutex queryLock{};
+    bool queried{false};
+    Key lastKey{};
+    QMetaObject::Connection parameterConnection{};
 };
 
 DefaultEyesProvider::DefaultEyesProvider(Identifier const device, std::function<void(Eye const &)> callback) :
@@ -74,14 +118,16 @@ bool DefaultEyesProvider::handleEvent(void const *event, void const *) {
     }
     switch (theEvent->eventType) {
         case vr::VREvent_IpdChanged: {
-            _private->queryEyes();
+            // the property might still be cached, whereas the event carries the new distance
+            _private->queryEyes(theEvent->data.ipd.ipdMeters);
             return true;
         }
         case vr::VREvent_PropertyChanged: {
             if (theEvent->trackedDeviceIndex == _private->device) {
                 switch (theEvent->data.property.prop) {
-                    case vr::Prop_UserIpdMeters_Float: {
-                        _private->queryEyes();
+                    case vr::Prop_UserIpdMeters_Float:
+                    case vr::Prop_UserHeadToEyeDepthMeters_Float: {
+                        _private->queryEyes(load<float>(_private->device, vr::Prop_UserIpdMeters_Float));
                         return true;
                     }
                     default: return false;
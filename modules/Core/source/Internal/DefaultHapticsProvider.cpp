@@ -0,0 +1,55 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QSet>
+
+#include <CuteVR/Internal/DefaultHapticsProvider.hpp>
+#include <CuteVR/Internal/HapticScheduler.hpp>
+
+using namespace CuteVR;
+using Components::Output::Haptic;
+using Internal::DefaultHapticsProvider;
+using Internal::HapticScheduler;
+
+class DefaultHapticsProvider::Private {
+public: // constructor
+    Private(DefaultHapticsProvider *that, Identifier const device, std::function<void(Haptic const &)> callback) :
+            that{that},
+            device{device},
+            callback{std::move(callback)} {
+        queryHaptics();
+    }
+
+public: // methods
+    void queryHaptics() {
+        // OpenVR only supports pulses on the first axis of a controller
+        Haptic haptic{};
+        haptic.identifier = 0;
+        haptic.interval = HapticScheduler::interval / 1000000.0;
+        haptic.duration = HapticScheduler::maximumPulse / 1000000.0;
+        hapticIdentifiers.insert(haptic.identifier);
+        callback(haptic);
+    }
+
+public: // variables
+    DefaultHapticsProvider *that{nullptr};
+    Identifier device{};
+    std::function<void(Haptic const &)> callback{};
+    QSet<Identifier> hapticIdentifiers{};
+};
+
+DefaultHapticsProvider::DefaultHapticsProvider(Identifier const device, std::function<void(Haptic const &)> callback) :
+        _private{new Private{this, device, std::move(callback)}} {}
+
+DefaultHapticsProvider::~DefaultHapticsProvider() {
+    HapticScheduler::cancel(_private->device);
+}
+
+bool DefaultHapticsProvider::vibrate(Identifier const haptic, QVector<qreal> const &envelope) {
+    if (!_private->hapticIdentifiers.contains(haptic)) {
+        return false;
+    }
+    return HapticScheduler::submit(_private->device, haptic, envelope);
+}
@@ -3,26 +3,27 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
-#include <openvr.h>
 #include <QtCore/QDateTime>
+#include <openvr.h>
 
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Internal/DefaultPoseProvider.hpp>
 #include <CuteVR/Internal/Matrix4x4.hpp>
+#include <CuteVR/Internal/Quaternion.hpp>
 #include <CuteVR/Internal/Vector3.hpp>
 
 using namespace CuteVR;
-using Components::Pose;
+using Components::CompactPose;
 using Configurations::Core::Feature;
-using Configurations::feature;
-using Extension::Trilean;
 using Internal::DefaultPoseProvider;
-using Internal::Matrix4x4::from;
 using Internal::Vector3::from;
 
+namespace Profile = Configurations::Core::Profile;
+
 class DefaultPoseProvider::Private {
 public: // constructor
-    Private(DefaultPoseProvider *that, Identifier const device, std::function<void(Pose const &)> callback) :
+    Private(DefaultPoseProvider *that, Identifier const device, std::function<void(Sample const &)> callback) :
             that{that},
             device{device},
             callback{std::move(callback)} {}
@@ -30,50 +31,60 @@ public: // constructor
 public: // variables
     DefaultPoseProvider *that{nullptr};
     Identifier device{};
-    std::function<void(Pose const &)> callback{};
+    std::function<void(Sample const &)> callback{};
     qint64 lastTrackingTime{};
     QVector3D lastLinearVelocity{};
     QVector3D lastAngularVelocity{};
 };
 
-DefaultPoseProvider::DefaultPoseProvider(Identifier const device, std::function<void(Pose const &)> callback) :
+DefaultPoseProvider::DefaultPoseProvider(Identifier const device,
+                                         std::function<void(Sample const &)> callback) :
         _private{new Private{this, device, std::move(callback)}} {}
 
 DefaultPoseProvider::~DefaultPoseProvider() = default;
 
 bool DefaultPoseProvider::handleTracking(void const *tracking) {
-    auto const linearVelocity{ConfigurationServer::isEnabled(feature(Feature::linearVelocity)).right(false)};
-    auto const linearAcceleration{ConfigurationServer::isEnabled(feature(Feature::linearAcceleration)).right(false)};
-    auto const angularVelocity{ConfigurationServer::isEnabled(feature(Feature::angularVelocity)).right(false)};
-    auto const angularAcceleration{ConfigurationServer::isEnabled(feature(Feature::angularAcceleration)).right(false)};
-    auto const newTrackingTime{QDateTime::currentMSecsSinceEpoch()};
     auto const *theTracking{static_cast<vr::TrackedDevicePose_t const *>(tracking)};
     if (theTracking == nullptr) {
         return false;
     }
-    Pose pose{};
-    // calculate and set new tracking data
-    pose.valid = static_cast<Trilean>(theTracking->bPoseIsValid);
-    pose.poseTransform = from(theTracking->mDeviceToAbsoluteTracking);
-    if (linearAcceleration) {
-        pose.linearAcceleration
-            .setValue((from(theTracking->vVelocity) - _private->lastLinearVelocity) * 1000.0 /
-                      (newTrackingTime - _private->lastTrackingTime));
-        _private->lastLinearVelocity = from(theTracking->vVelocity);
+    auto const &m{theTracking->mDeviceToAbsoluteTracking.m};
+    Sample sample{};
+    auto &compact{sample.compact};
+    compact.position = {m[0][3], m[1][3], m[2][3]};
+    compact.orientation = Internal::Quaternion::from(theTracking->mDeviceToAbsoluteTracking);
+    compact.linearVelocity = from(theTracking->vVelocity);
+    compact.angularVelocity = from(theTracking->vAngularVelocity);
+    compact.flags = theTracking->bPoseIsValid ? CompactPose::isValid : CompactPose::isInvalid;
+    if (Profile::isEnabled<Feature::linearVelocity>()) {
+        compact.flags |= CompactPose::hasLinearVelocity;
     }
-    if (linearVelocity) {
-        pose.linearVelocity.setValue(from(theTracking->vVelocity));
+    if (Profile::isEnabled<Feature::angularVelocity>()) {
+        compact.flags |= CompactPose::hasAngularVelocity;
     }
-    if (angularAcceleration) {
-        pose.angularAcceleration
-            .setValue((from(theTracking->vAngularVelocity) - _private->lastAngularVelocity) * 1000.0 /
-                      (newTrackingTime - _private->lastTrackingTime));
-        _private->lastLinearVelocity = from(theTracking->vVelocity);
+
+    // the pose keeps the matrix of the driver, a round trip through the quaternion would not be exact
+    auto &pose{sample.pose};
+    pose.valid = compact.valid();
+    pose.poseTransform = Internal::Matrix4x4::from(theTracking->mDeviceToAbsoluteTracking);
+    if (compact.flags & CompactPose::hasLinearVelocity) {
+        pose.linearVelocity.setValue(compact.linearVelocity);
+    }
+    if (compact.flags & CompactPose::hasAngularVelocity) {
+        pose.angularVelocity.setValue(compact.angularVelocity);
     }
-    if (angularVelocity) {
-        pose.angularVelocity.setValue(from(theTracking->vAngularVelocity));
+    auto const trackingTime{QDateTime::currentMSecsSinceEpoch()};
+    auto const elapsed{static_cast<float>(trackingTime - _private->lastTrackingTime)};
+    if (elapsed > 0.0f && Profile::isEnabled<Feature::linearAcceleration>()) {
+        pose.linearAcceleration.setValue((compact.linearVelocity - _private->lastLinearVelocity) * 1000.0f / elapsed);
+    }
+    if (elapsed > 0.0f && Profile::isEnabled<Feature::angularAcceleration>()) {
+        pose.angularAcceleration
+            .setValue((compact.angularVelocity - _private->lastAngularVelocity) * 1000.0f / elapsed);
     }
-    _private->lastTrackingTime = newTrackingTime;
-    _private->callback(pose);
+    _private->lastTrackingTime = trackingTime;
+    _private->lastLinearVelocity = compact.linearVelocity;
+    _private->lastAngularVelocity = compact.angularVelocity;
+    _private->callback(sample);
     return true;
 }
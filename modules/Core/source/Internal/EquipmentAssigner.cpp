@@ -0,0 +1,185 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <limits>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include <CuteVR/Internal/EquipmentAssigner.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Internal::EquipmentAssigner;
+
+class EquipmentAssigner::Private {
+public: // types
+    /// @brief The pose of a device in one frame, where frame zero marks an empty slot.
+    struct Sample {
+        quint64 frame{0};
+        QVector3D position{};
+        QVector3D velocity{};
+    };
+
+    /// @brief A head-mounted display that has been cheaper than the assigned one for some consecutive frames.
+    struct Challenge {
+        Identifier headMountedDisplay{invalidIdentifier};
+        qint32 frames{0};
+    };
+
+public: // methods
+    void record(Identifier const device, CompactPose const &pose, qint32 const window) {
+        auto &samples{histories[device]};
+        if (samples.size() != window) {
+            samples = QVector<Sample>(window);
+        }
+        // velocities are only compared if the driver delivers them, otherwise the distance decides alone
+        samples[static_cast<qint32>(frame % static_cast<quint64>(window))] = Sample{
+                frame, pose.position, (pose.flags & CompactPose::hasLinearVelocity) ? pose.linearVelocity
+                                                                                   : QVector3D{}};
+    }
+
+    /// The mean cost of a pair over all frames of the window in which both devices have been sampled.
+    qreal cost(Identifier const controller, Identifier const headMountedDisplay, Tuning const &tuning) const {
+        auto const controllerSamples{histories.value(controller)};
+        auto const headMountedDisplaySamples{histories.value(headMountedDisplay)};
+        qreal distance{0.0};
+        qreal speed{0.0};
+        auto count{0};
+        for (auto index = 0; index < controllerSamples.size() && index < headMountedDisplaySamples.size(); index++) {
+            auto const &left{controllerSamples.at(index)};
+            auto const &right{headMountedDisplaySamples.at(index)};
+            if (left.frame != 0 && left.frame == right.frame &&
+                frame - left.frame < static_cast<quint64>(controllerSamples.size())) {
+                distance += static_cast<qreal>((left.position - right.position).length());
+                speed += static_cast<qreal>((left.velocity - right.velocity).length());
+                count++;
+            }
+        }
+        return count > 0 ? (distance + tuning.motionWeight * speed) / count : std::numeric_limits<qreal>::infinity();
+    }
+
+public: // variables
+    quint64 frame{0}; // the last recorded tracking frame
+    QHash<Identifier, QVector<Sample>> histories{};
+    QHash<Identifier, Identifier> assignments{};
+    QHash<Identifier, Challenge> challenges{};
+};
+
+EquipmentAssigner::EquipmentAssigner() :
+        _private{new Private} {}
+
+EquipmentAssigner::~EquipmentAssigner() = default;
+
+Identifier EquipmentAssigner::assignment(Identifier const controller) const noexcept {
+    return _private->assignments.value(controller, invalidIdentifier);
+}
+
+QList<EquipmentAssigner::Reassignment> EquipmentAssigner::assign(
+        quint64 const frame, QMap<Identifier, CompactPose> const &headMountedDisplays,
+        QMap<Identifier, CompactPose> const &controllers, Tuning const &tuning) {
+    // several updates may see the same frame, which must neither fill the window nor count towards the persistence
+    if (frame <= _private->frame) {
+        return {};
+    }
+    auto const window{qMax(tuning.window, 1)};
+    _private->frame = frame;
+    QMap<Identifier, QVector3D> tracked{};
+    for (auto iterator = headMountedDisplays.cbegin(); iterator != headMountedDisplays.cend(); ++iterator) {
+        if (iterator->flags & CompactPose::isValid) {
+            _private->record(iterator.key(), iterator.value(), window);
+            tracked.insert(iterator.key(), iterator->position);
+        }
+    }
+    // the distance to the nearest other head-mounted display bounds how near a controller must be to be unambiguous
+    QHash<Identifier, qreal> separations{};
+    for (auto iterator = tracked.cbegin(); iterator != tracked.cend(); ++iterator) {
+        auto separation{std::numeric_limits<qreal>::infinity()};
+        for (auto other = tracked.cbegin(); other != tracked.cend(); ++other) {
+            if (other != iterator) {
+                separation = qMin(separation, static_cast<qreal>((iterator.value() - other.value()).length()));
+            }
+        }
+        separations.insert(iterator.key(), separation);
+    }
+
+    QList<Reassignment> reassignments{};
+    for (auto iterator = controllers.cbegin(); iterator != controllers.cend(); ++iterator) {
+        if (!(iterator->flags & CompactPose::isValid)) {
+            continue;
+        }
+        auto const controller{iterator.key()};
+        _private->record(controller, iterator.value(), window);
+        auto const current{_private->assignments.value(controller, invalidIdentifier)};
+        if (current != invalidIdentifier) {
+            if (!tracked.contains(current)) {
+                continue;
+            }
+            // by the triangle inequality every other head-mounted display is farther away by at least the hysteresis
+            auto const distance{static_cast<qreal>((iterator->position - tracked.value(current)).length())};
+            if (2 * distance + tuning.hysteresis <= separations.value(current)) {
+                _private->challenges.remove(controller);
+                continue;
+            }
+        }
+
+        auto best{invalidIdentifier};
+        auto bestCost{std::numeric_limits<qreal>::infinity()};
+        for (auto candidate = tracked.cbegin(); candidate != tracked.cend(); ++candidate) {
+            auto const cost{_private->cost(controller, candidate.key(), tuning)};
+            if (cost < bestCost) {
+                best = candidate.key();
+                bestCost = cost;
+            }
+        }
+        if (best == invalidIdentifier || best == current) {
+            _private->challenges.remove(controller);
+            continue;
+        }
+        if (current != invalidIdentifier) {
+            if (_private->cost(controller, current, tuning) - bestCost <= tuning.hysteresis) {
+                _private->challenges.remove(controller);
+                continue;
+            }
+            auto &challenge{_private->challenges[controller]};
+            if (challenge.headMountedDisplay != best) {
+                challenge = Private::Challenge{best, 0};
+            }
+            if (++challenge.frames < tuning.persistence) {
+                continue;
+            }
+            _private->challenges.remove(controller);
+        }
+        _private->assignments.insert(controller, best);
+        reassignments.append(Reassignment{controller, current, best});
+    }
+    return reassignments;
+}
+
+void EquipmentAssigner::remove(Identifier const device) {
+    _private->histories.remove(device);
+    _private->assignments.remove(device);
+    _private->challenges.remove(device);
+    // the controllers of a removed head-mounted display are assigned anew with their next valid pose
+    for (auto iterator = _private->assignments.begin(); iterator != _private->assignments.end();) {
+        if (iterator.value() == device) {
+            iterator = _private->assignments.erase(iterator);
+        } else {
+            ++iterator;
+        }
+    }
+    for (auto iterator = _private->challenges.begin(); iterator != _private->challenges.end();) {
+        if (iterator->headMountedDisplay == device) {
+            iterator = _private->challenges.erase(iterator);
+        } else {
+            ++iterator;
+        }
+    }
+}
+
+void EquipmentAssigner::clear() {
+    _private->histories.clear();
+    _private->assignments.clear();
+    _private->challenges.clear();
+}
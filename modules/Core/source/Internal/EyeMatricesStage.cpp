@@ -0,0 +1,95 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Internal/EyeMatricesStage.hpp>
+
+using namespace CuteVR;
+using Components::Interaction::Eye;
+using Components::Interaction::EyeMatrices;
+using Internal::EyeMatricesStage;
+
+namespace {
+    /// Inverts a transform that consists of a rotation and a translation only, by transposing the rotation.
+    QMatrix4x4 invertRigid(QMatrix4x4 const &transform) {
+        QMatrix4x4 inverse{};
+        for (auto row = 0; row < 3; row++) {
+            for (auto column = 0; column < 3; column++) {
+                inverse(row, column) = transform(column, row);
+            }
+        }
+        for (auto row = 0; row < 3; row++) {
+            inverse(row, 3) = -(inverse(row, 0) * transform(0, 3) + inverse(row, 1) * transform(1, 3) +
+                                inverse(row, 2) * transform(2, 3));
+        }
+        return inverse;
+    }
+}
+
+class EyeMatricesStage::Private {
+public: // types
+    struct Entry {
+        Eye eye{};
+        QMatrix4x4 headToEye{};
+        QMatrix4x4 inverseProjection{};
+    };
+
+public: // variables
+    QMap<Identifier, Entry> entries{};
+    QMap<Identifier, EyeMatrices> matrices{};
+    QMatrix4x4 poseTransform{};
+    bool dirty{false};
+};
+
+EyeMatricesStage::EyeMatricesStage() :
+        _private{new Private} {}
+
+EyeMatricesStage::~EyeMatricesStage() = default;
+
+QMap<Identifier, EyeMatrices> const &EyeMatricesStage::matrices() const noexcept {
+    return _private->matrices;
+}
+
+void EyeMatricesStage::setEyes(QMap<Identifier, Eye> const &eyes) {
+    for (auto entry = _private->entries.begin(); entry != _private->entries.end();) {
+        if (!eyes.contains(entry.key())) {
+            entry = _private->entries.erase(entry);
+            _private->dirty = true;
+        } else {
+            ++entry;
+        }
+    }
+    for (auto const &eye : eyes) {
+        auto const entry{_private->entries.constFind(eye.identifier)};
+        if (entry == _private->entries.constEnd() || entry->eye != eye) {
+            Private::Entry changed{};
+            changed.eye = eye;
+            changed.headToEye = invertRigid(eye.headTransform);
+            changed.inverseProjection = eye.perspectiveProjection.inverted();
+            _private->entries.insert(eye.identifier, changed);
+            _private->dirty = true;
+        }
+    }
+}
+
+bool EyeMatricesStage::update(QMatrix4x4 const &poseTransform) {
+    if (!_private->dirty && _private->poseTransform == poseTransform) {
+        return false;
+    }
+    auto const worldToHead{invertRigid(poseTransform)};
+    _private->matrices.clear();
+    for (auto const &entry : _private->entries) {
+        EyeMatrices matrices{};
+        matrices.view = entry.headToEye * worldToHead;
+        matrices.projection = entry.eye.perspectiveProjection;
+        matrices.viewProjection = matrices.projection * matrices.view;
+        matrices.inverseView = poseTransform * entry.eye.headTransform;
+        matrices.inverseProjection = entry.inverseProjection;
+        matrices.inverseViewProjection = matrices.inverseView * matrices.inverseProjection;
+        _private->matrices.insert(entry.eye.identifier, matrices);
+    }
+    _private->poseTransform = poseTransform;
+    _private->dirty = false;
+    return true;
+}
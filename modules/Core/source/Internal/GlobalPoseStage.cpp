@@ -0,0 +1,229 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <utility>
+#include <openvr.h>
+#include <QtCore/QMutex>
+#include <QtCore/QVector>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Internal/GlobalPoseStage.hpp>
+#include <CuteVR/Internal/Matrix4x4.hpp>
+#include <CuteVR/Internal/PoseBatch.hpp>
+#include <CuteVR/Internal/TrackingFrame.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Configurations::Core::Feature;
+using Extension::Trilean;
+using Internal::GlobalPoseStage;
+using Internal::TransformKernels::Rigid;
+
+namespace Profile = Configurations::Core::Profile;
+
+namespace {
+    /// Intermediate arrays of GlobalPoseStage::apply, which are kept between frames by the stage.
+    struct Scratch {
+        QVector<Rigid> rigids{};
+        QVector<QQuaternion> rotations{};
+        QVector<QVector3D> linearVelocities{};
+        QVector<QVector3D> angularVelocities{};
+
+        void resize(qint32 const count) {
+            rigids.resize(count);
+            rotations.resize(count);
+            linearVelocities.resize(count);
+            angularVelocities.resize(count);
+        }
+    };
+
+    void applyWith(Scratch &scratch, Rigid const *transforms, CompactPose const *poses, CompactPose *result,
+                   qint32 const count, Internal::Simd::InstructionSet const set) {
+        scratch.resize(count);
+        for (auto index = 0; index < count; index++) {
+            scratch.rigids[index] = Rigid{poses[index].orientation, poses[index].position};
+            scratch.rotations[index] = transforms[index].rotation;
+            scratch.linearVelocities[index] = poses[index].linearVelocity;
+            scratch.angularVelocities[index] = poses[index].angularVelocity;
+        }
+        Internal::TransformKernels::compose(transforms, scratch.rigids.constData(), scratch.rigids.data(), count, set);
+        Internal::TransformKernels::rotate(scratch.rotations.constData(), scratch.linearVelocities.constData(),
+                                           scratch.linearVelocities.data(), count, set);
+        Internal::TransformKernels::rotate(scratch.rotations.constData(), scratch.angularVelocities.constData(),
+                                           scratch.angularVelocities.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            result[index].flags = poses[index].flags;
+            result[index].position = scratch.rigids.at(index).translation;
+            result[index].orientation = scratch.rigids.at(index).rotation;
+            result[index].linearVelocity = scratch.linearVelocities.at(index);
+            result[index].angularVelocity = scratch.angularVelocities.at(index);
+        }
+    }
+}
+
+class GlobalPoseStage::Private {
+public: // methods
+    /// Fetches the transforms of the seated and the raw universe into the standing universe, if they are not cached.
+    QMatrix4x4 toStanding(qint32 const universe) {
+        if (universe == vr::TrackingUniverseStanding) {
+            return {};
+        }
+        quint64 generation{};
+        {
+            QMutexLocker locker{&lock};
+            if (universesCached) {
+                return universe == vr::TrackingUniverseSeated ? seatedToStanding : rawToStanding;
+            }
+            generation = universesGeneration;
+        }
+        QMatrix4x4 seated{};
+        QMatrix4x4 raw{};
+        DriverServer::synchronized([&] {
+            seated = Matrix4x4::from(vr::VRSystem()->GetSeatedZeroPoseToStandingAbsoluteTrackingPose());
+            raw = Matrix4x4::from(vr::VRSystem()->GetRawZeroPoseToStandingAbsoluteTrackingPose());
+        }, Trilean::yes);
+        QMutexLocker locker{&lock};
+        // a change announced during the fetch may not be reflected by the fetched transforms, which are not cached then
+        if (generation == universesGeneration) {
+            seatedToStanding = seated;
+            rawToStanding = raw;
+            universesCached = true;
+        }
+        return universe == vr::TrackingUniverseSeated ? seated : raw;
+    }
+
+    void resize(qint32 const count) {
+        packed.resize(count);
+        poses.resize(count);
+        cellPoses.resize(count);
+        globalPoses.resize(count);
+        transforms.resize(count);
+    }
+
+public: // variables
+    QMutex lock{};
+    bool universesCached{false};
+    quint64 universesGeneration{0}; // counts the announced changes of the universes
+    QMatrix4x4 seatedToStanding{};
+    QMatrix4x4 rawToStanding{};
+    QHash<Identifier, Rigid> cellTransforms{};
+    Snapshot snapshot{};
+    // the buffers are only used by the polling thread and keep their capacity between frames
+    QVector<Internal::PoseBatch::Packed> packed{};
+    QVector<CompactPose> poses{};
+    QVector<CompactPose> cellPoses{};
+    QVector<CompactPose> globalPoses{};
+    QVector<Rigid> transforms{};
+    Scratch scratch{};
+};
+
+GlobalPoseStage::GlobalPoseStage() :
+        _private{new Private} {}
+
+GlobalPoseStage::~GlobalPoseStage() = default;
+
+GlobalPoseStage::Snapshot GlobalPoseStage::snapshot() const {
+    QMutexLocker locker{&_private->lock};
+    return _private->snapshot;
+}
+
+QMatrix4x4 GlobalPoseStage::universeTransform(qint32 const from, qint32 const to) const {
+    if (from == to) {
+        return {};
+    }
+    return _private->toStanding(to).inverted() * _private->toStanding(from);
+}
+
+void GlobalPoseStage::setCellTransforms(QHash<Identifier, QMatrix4x4> const &transforms) {
+    QHash<Identifier, Rigid> rigids{};
+    for (auto iterator = transforms.cbegin(); iterator != transforms.cend(); ++iterator) {
+        rigids.insert(iterator.key(), rigid(iterator.value()));
+    }
+    QMutexLocker locker{&_private->lock};
+    _private->cellTransforms.swap(rigids);
+}
+
+bool GlobalPoseStage::handleEvent(void const *event, void const *) {
+    auto const *theEvent{static_cast<vr::VREvent_t const *>(event)};
+    if (theEvent == nullptr) {
+        return false;
+    }
+    switch (theEvent->eventType) {
+        case vr::VREvent_ChaperoneDataHasChanged:
+        case vr::VREvent_ChaperoneUniverseHasChanged:
+        case vr::VREvent_ChaperoneSettingsHaveChanged:
+        case vr::VREvent_SeatedZeroPoseReset: {
+            QMutexLocker locker{&_private->lock};
+            _private->universesCached = false;
+            _private->universesGeneration++;
+            return true;
+        }
+        default: return false;
+    }
+}
+
+bool GlobalPoseStage::handleTracking(void const *tracking) {
+    auto const *theFrame{static_cast<TrackingFrame const *>(tracking)};
+    if (theFrame == nullptr || theFrame->poses == nullptr) {
+        return false;
+    }
+    auto const count{static_cast<qint32>(theFrame->count)};
+    auto const linearVelocity{Profile::isEnabled<Feature::linearVelocity>()};
+    auto const angularVelocity{Profile::isEnabled<Feature::angularVelocity>()};
+    _private->resize(count);
+    PoseBatch::toPacked(theFrame->poses, count, _private->packed.data());
+    for (auto index = 0; index < count; index++) {
+        auto const &packed{_private->packed.at(index)};
+        auto &pose{_private->poses[index]};
+        pose.position = PoseBatch::position(packed);
+        pose.orientation = PoseBatch::orientation(packed);
+        pose.linearVelocity = {packed.linearVelocity[0], packed.linearVelocity[1], packed.linearVelocity[2]};
+        pose.angularVelocity = {packed.angularVelocity[0], packed.angularVelocity[1], packed.angularVelocity[2]};
+        pose.flags = theFrame->poses[index].bPoseIsValid ? CompactPose::isValid : CompactPose::isInvalid;
+        if (linearVelocity) {
+            pose.flags |= CompactPose::hasLinearVelocity;
+        }
+        if (angularVelocity) {
+            pose.flags |= CompactPose::hasAngularVelocity;
+        }
+    }
+
+    // every pose of a frame shares the same universe, whereas every device may be surrounded by another cell
+    _private->transforms.fill(rigid(_private->toStanding(theFrame->universe)));
+    applyWith(_private->scratch, _private->transforms.constData(), _private->poses.constData(),
+              _private->cellPoses.data(), count, Simd::supported());
+    {
+        QMutexLocker locker{&_private->lock};
+        for (auto index = 0; index < count; index++) {
+            _private->transforms[index] = _private->cellTransforms.value(static_cast<Identifier>(index), Rigid{});
+        }
+    }
+    applyWith(_private->scratch, _private->transforms.constData(), _private->cellPoses.constData(),
+              _private->globalPoses.data(), count, Simd::supported());
+
+    Snapshot snapshot{};
+    for (auto index = 0; index < count; index++) {
+        if (theFrame->poses[index].bDeviceIsConnected) {
+            snapshot.cellPoses.insert(static_cast<Identifier>(index), _private->cellPoses.at(index));
+            snapshot.globalPoses.insert(static_cast<Identifier>(index), _private->globalPoses.at(index));
+        }
+    }
+    QMutexLocker locker{&_private->lock};
+    snapshot.frame = _private->snapshot.frame + 1;
+    std::swap(_private->snapshot, snapshot);
+    return true;
+}
+
+void GlobalPoseStage::apply(Rigid const *transforms, CompactPose const *poses, CompactPose *result,
+                            qint32 const count, TransformKernels::InstructionSet const set) {
+    Scratch scratch{};
+    applyWith(scratch, transforms, poses, result, count, set);
+}
+
+Rigid GlobalPoseStage::rigid(QMatrix4x4 const &transform) {
+    return Rigid{QQuaternion::fromRotationMatrix(transform.toGenericMatrix<3, 3>()), transform.column(3).toVector3D()};
+}
@@ -0,0 +1,258 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+#include <openvr.h>
+
+#include <CuteVR/Internal/HapticScheduler.hpp>
+#include <CuteVR/Internal/MpscQueue.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Extension::CuteException;
+using Extension::Trilean;
+using Internal::HapticScheduler;
+using Internal::MpscQueue;
+
+constexpr quint32 HapticScheduler::interval;
+constexpr quint32 HapticScheduler::maximumPulse;
+constexpr qint32 HapticScheduler::depth;
+
+class HapticScheduler::Private {
+public: // types
+    struct Request {
+        Identifier device{};
+        Identifier haptic{};
+        QVector<float> envelope{};
+        quint32 generation{0};
+    };
+
+    class SchedulerThread final :
+            public QThread {
+    public: // constructor
+        explicit SchedulerThread(Private *scheduler) :
+                scheduler{scheduler} {}
+
+    protected: // methods
+        void run() override {
+            auto const period{static_cast<qint64>(interval) * 1000};
+            QElapsedTimer clock{};
+            clock.start();
+            auto deadline{qint64{0}};
+            while (!scheduler->stopping.load()) {
+                scheduler->takeRequests();
+                if (scheduler->timelines.isEmpty()) {
+                    scheduler->waitForRequests();
+                    deadline = clock.nsecsElapsed();
+                    continue;
+                }
+                scheduler->playPulses();
+                deadline += period;
+                auto const remaining{deadline - clock.nsecsElapsed()};
+                if (remaining > 0) {
+                    QThread::usleep(static_cast<unsigned long>(remaining / 1000));
+                } else {
+                    // never play pulses in a burst to catch up, since the driver would swallow them anyway
+                    deadline = clock.nsecsElapsed();
+                }
+            }
+        }
+
+    private: // variables
+        Private *scheduler{nullptr};
+    };
+
+public: // constructor
+    explicit Private(HapticScheduler *that) :
+            that{that},
+            thread{this} {}
+
+public: // methods
+    static constexpr quint64 key(Identifier const device, Identifier const haptic) noexcept {
+        return static_cast<quint64>(device) << 32 | haptic;
+    }
+
+    static constexpr Identifier deviceOf(quint64 const key) noexcept {
+        return static_cast<Identifier>(key >> 32);
+    }
+
+    /// Drops the timelines of a device once it has been cancelled, returns the generation that is valid now.
+    quint32 synchronize(Identifier const device) {
+        auto const generation{generations[device].load()};
+        if (generation != seen[device]) {
+            seen[device] = generation;
+            auto iterator{timelines.begin()};
+            while (iterator != timelines.end()) {
+                iterator = deviceOf(iterator.key()) == device ? timelines.erase(iterator) : ++iterator;
+            }
+        }
+        return generation;
+    }
+
+    void takeRequests() {
+        // only devices with scheduled pulses can lose them, all other devices are synchronized with their requests
+        auto iterator{timelines.begin()};
+        while (iterator != timelines.end()) {
+            auto const device{deviceOf(iterator.key())};
+            if (generations[device].load() != seen[device]) {
+                synchronize(device);
+                iterator = timelines.begin();
+            } else {
+                ++iterator;
+            }
+        }
+        Request request{};
+        while (requests.pop(request)) {
+            // requests that were submitted before a cancellation are outdated
+            if (request.generation != synchronize(request.device)) {
+                continue;
+            }
+            auto &timeline{timelines[key(request.device, request.haptic)]};
+            for (auto index = 0; index < request.envelope.size(); index++) {
+                auto const amplitude{request.envelope.at(index)};
+                if (index >= timeline.size()) {
+                    timeline.append(amplitude);
+                } else if (amplitude > 0.0f) {
+                    if (timeline.at(index) > 0.0f) {
+                        merged.fetchAndAddRelaxed(1);
+                    }
+                    timeline[index] = qMax(timeline.at(index), amplitude);
+                }
+            }
+        }
+    }
+
+    void playPulses() {
+        auto iterator{timelines.begin()};
+        while (iterator != timelines.end()) {
+            auto const amplitude{iterator.value().takeFirst()};
+            auto const duration{static_cast<unsigned short>(qRound(amplitude * maximumPulse))};
+            if (duration > 0) {
+                auto const device{deviceOf(iterator.key())};
+                auto const haptic{static_cast<quint32>(iterator.key())};
+                try {
+                    DriverServer::synchronized([&] {
+                        vr::VRSystem()->TriggerHapticPulse(device, haptic, duration);
+                    }, Trilean::yes);
+                    pulses.fetchAndAddRelaxed(1);
+                } catch (CuteException const &) {
+                    // the driver has been shut down, the remaining pulses are dropped with the next cancellation
+                }
+            }
+            iterator = iterator.value().isEmpty() ? timelines.erase(iterator) : ++iterator;
+        }
+    }
+
+    /// Blocks the scheduler thread until a request is submitted or the scheduler stops.
+    void waitForRequests() {
+        QMutexLocker locker{&idleLock};
+        // the ordered exchange pairs with the one in wake(), so either the request is seen here or the waker sees idle
+        idle.fetchAndStoreOrdered(1);
+        if (requests.isEmpty() && !stopping.load()) {
+            idleCondition.wait(&idleLock);
+        }
+        idle.fetchAndStoreOrdered(0);
+    }
+
+    /// Wakes the scheduler thread if it waits for requests, which is the only case in which submitting locks.
+    void wake() {
+        if (idle.fetchAndAddOrdered(0) != 0) {
+            QMutexLocker locker{&idleLock};
+            idleCondition.wakeOne();
+        }
+    }
+
+    void start() {
+        if (started.testAndSetOrdered(0, 1)) {
+            thread.start(QThread::HighPriority);
+        } else {
+            wake();
+        }
+    }
+
+public: // variables
+    HapticScheduler *that{nullptr};
+    MpscQueue<Request> requests{depth};
+    QHash<quint64, QVector<float>> timelines{}; // only touched by the scheduler thread
+    // cancellations bypass the queue, so that they cannot be dropped while it is full
+    QAtomicInteger<quint32> generations[vr::k_unMaxTrackedDeviceCount]{};
+    quint32 seen[vr::k_unMaxTrackedDeviceCount]{}; // only touched by the scheduler thread
+    SchedulerThread thread;
+    QAtomicInteger<quint32> started{0};
+    QAtomicInteger<quint32> stopping{0};
+    QMutex idleLock{};
+    QWaitCondition idleCondition{};
+    QAtomicInteger<quint32> idle{0};
+    QAtomicInteger<quint64> pulses{0};
+    QAtomicInteger<quint64> merged{0};
+};
+
+HapticScheduler::~HapticScheduler() {
+    {
+        QMutexLocker locker{&_private->idleLock};
+        _private->stopping.store(1);
+        _private->idleCondition.wakeOne();
+    }
+    _private->thread.wait();
+}
+
+quint64 HapticScheduler::pulses() noexcept {
+    return instance()._private->pulses.load();
+}
+
+quint64 HapticScheduler::merged() noexcept {
+    return instance()._private->merged.load();
+}
+
+quint64 HapticScheduler::dropped() noexcept {
+    return instance()._private->requests.dropped();
+}
+
+bool HapticScheduler::submit(Identifier const device, Identifier const haptic, QVector<qreal> const &envelope) {
+    if (envelope.isEmpty() || device >= vr::k_unMaxTrackedDeviceCount) {
+        return envelope.isEmpty();
+    }
+    auto const &_private{instance()._private};
+    Private::Request request{};
+    request.device = device;
+    request.haptic = haptic;
+    request.generation = _private->generations[device].load();
+    request.envelope.reserve(envelope.size());
+    for (auto const amplitude : envelope) {
+        request.envelope.append(static_cast<float>(qBound(0.0, amplitude, 1.0)));
+    }
+    if (!_private->requests.push(request)) {
+        return false;
+    }
+    _private->start();
+    return true;
+}
+
+void HapticScheduler::cancel(Identifier const device) {
+    // a scheduler thread that has not been started yet has nothing to cancel but the pending requests, which it checks
+    // against the generation once it starts
+    if (device < vr::k_unMaxTrackedDeviceCount) {
+        instance()._private->generations[device].fetchAndAddOrdered(1);
+    }
+}
+
+void HapticScheduler::resetStatistics() noexcept {
+    auto const &_private{instance()._private};
+    _private->pulses.store(0);
+    _private->merged.store(0);
+}
+
+HapticScheduler::HapticScheduler() :
+        _private{new Private{this}} {}
+
+HapticScheduler &HapticScheduler::instance() noexcept {
+    static HapticScheduler instance;
+    return instance;
+}
@@ -0,0 +1,160 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <chrono>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <openvr.h>
+
+#include <CuteVR/Internal/InputCapture.hpp>
+#include <CuteVR/Internal/SpscRing.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Extension::CuteException;
+using Extension::Trilean;
+using Internal::InputCapture;
+using Internal::SpscRing;
+
+class InputCapture::Private {
+public: // types
+    class SamplerThread final :
+            public QThread {
+    public: // constructor
+        explicit SamplerThread(Private *capture) :
+                capture{capture} {}
+
+    protected: // methods
+        void run() override {
+            auto const period{static_cast<qint64>(1000000000 / capture->rate)};
+            QElapsedTimer clock{};
+            clock.start();
+            auto deadline{qint64{0}};
+            while (!capture->stopping.load()) {
+                capture->sample();
+                deadline += period;
+                auto const remaining{deadline - clock.nsecsElapsed()};
+                if (remaining > 0) {
+                    QThread::usleep(static_cast<unsigned long>(remaining / 1000));
+                } else {
+                    // the sampler fell behind, so it continues at the rate instead of catching up in a burst
+                    deadline = clock.nsecsElapsed();
+                }
+            }
+        }
+
+    private: // variables
+        Private *capture{nullptr};
+    };
+
+public: // constructor
+    Private(InputCapture *that, Identifier const device, quint32 const rate, quint32 const depth) :
+            that{that},
+            device{device},
+            rate{qMax(rate, 1u)},
+            ring{depth},
+            thread{this} {}
+
+public: // methods
+    void sample() {
+        vr::VRControllerState_t state{};
+        auto valid{false};
+        try {
+            DriverServer::synchronized([&] {
+                valid = vr::VRSystem()->GetControllerState(device, &state, (sizeof(vr::VRControllerState_t)));
+            }, Trilean::yes);
+        } catch (CuteException const &) {
+            return;
+        }
+        if (!valid || (sampled && state.unPacketNum == previous.unPacketNum)) {
+            return;
+        }
+        auto const timestamp{static_cast<qint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count())};
+        for (quint16 axis = 0; axis < vr::k_unControllerStateAxisCount; axis++) {
+            // the identifiers match those of the axes provider, so x is even and y is odd
+            record(timestamp, Record::Kind::axis, static_cast<quint16>(axis * 2),
+                   previous.rAxis[axis].x, state.rAxis[axis].x);
+            record(timestamp, Record::Kind::axis, static_cast<quint16>(axis * 2 + 1),
+                   previous.rAxis[axis].y, state.rAxis[axis].y);
+        }
+        auto const pressedChanges{previous.ulButtonPressed ^ state.ulButtonPressed};
+        auto const touchedChanges{previous.ulButtonTouched ^ state.ulButtonTouched};
+        for (quint16 bit = 0; bit < 64; bit++) {
+            auto const mask{1ULL << bit};
+            if ((pressedChanges & mask)) {
+                push(timestamp, Record::Kind::press, bit, (state.ulButtonPressed & mask) ? 1.0f : 0.0f);
+            }
+            if ((touchedChanges & mask)) {
+                push(timestamp, Record::Kind::touch, bit, (state.ulButtonTouched & mask) ? 1.0f : 0.0f);
+            }
+        }
+        previous = state;
+        sampled = true;
+    }
+
+    void record(qint64 const timestamp, Record::Kind const kind, quint16 const identifier,
+                float const before, float const after) {
+        // any change of the raw value is recorded, there is no dead zone
+        if (before != after) {
+            push(timestamp, kind, identifier, after);
+        }
+    }
+
+    void push(qint64 const timestamp, Record::Kind const kind, quint16 const identifier, float const value) {
+        Record record{};
+        record.timestamp = timestamp;
+        record.value = value;
+        record.identifier = identifier;
+        record.kind = kind;
+        ring.push(record);
+    }
+
+public: // variables
+    InputCapture *that{nullptr};
+    Identifier device{};
+    quint32 rate{};
+    SpscRing<Record> ring;
+    SamplerThread thread;
+    QAtomicInteger<quint32> stopping{0};
+    QMutex controlLock{};
+    vr::VRControllerState_t previous{}; // starts at rest, so the first sample records what is already held
+    bool sampled{false};
+};
+
+InputCapture::InputCapture(Identifier const device, quint32 const rate, quint32 const depth) :
+        _private{new Private{this, device, rate, depth}} {}
+
+InputCapture::~InputCapture() {
+    stop();
+}
+
+bool InputCapture::isRunning() const noexcept {
+    return _private->thread.isRunning();
+}
+
+quint64 InputCapture::dropped() const noexcept {
+    return _private->ring.dropped();
+}
+
+void InputCapture::start() {
+    QMutexLocker locker{&_private->controlLock};
+    if (!_private->thread.isRunning()) {
+        _private->stopping.store(0);
+        _private->thread.start(QThread::HighPriority);
+    }
+}
+
+void InputCapture::stop() {
+    QMutexLocker locker{&_private->controlLock};
+    _private->stopping.store(1);
+    _private->thread.wait();
+}
+
+qint32 InputCapture::drain(QVector<Record> &records, qint32 const maximum) {
+    return _private->ring.drain(records, maximum);
+}
@@ -0,0 +1,310 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <algorithm>
+#include <openvr.h>
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSaveFile>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Internal/LensMeshCache.hpp>
+#include <CuteVR/Internal/Property.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+using namespace CuteVR;
+using Components::Output::DistortionMesh;
+using Components::Output::HiddenAreaMesh;
+using Configurations::Core::Parameter;
+using Configurations::parameter;
+using Extension::Trilean;
+using Internal::LensMeshCache;
+using Internal::Property::load;
+
+constexpr qint32 LensMeshCache::minimumResolution;
+constexpr qint32 LensMeshCache::maximumResolution;
+
+class LensMeshCache::Private {
+public: // types
+    /// Identifies the head-mounted display together with everything its lenses depend on.
+    struct Key {
+        QString serial{};
+        qint32 ipd{0}; // in micrometers, so that the key does not depend on the rounding of the driver
+    };
+
+public: // constants
+    static constexpr quint32 magic{0x4356444D}; // "CVDM"
+    static constexpr quint8 version{1};
+
+public: // methods
+    static Key resolve(Identifier const device) {
+        Key key{};
+        auto ipd{0.0f};
+        DriverServer::Batch batch{};
+        batch.submit([&] {
+            key.serial = load<QString>(device, vr::Prop_SerialNumber_String);
+            ipd = load<float>(device, vr::Prop_UserIpdMeters_Float);
+        });
+        DriverServer::execute(batch, Trilean::yes);
+        key.ipd = qRound(ipd * 1.0e6f);
+        return key;
+    }
+
+    static QString name(Key const &key, Identifier const eye, QSize const &resolution) {
+        // serial numbers are chosen by the vendor, so only a safe subset of characters ends up in the file name
+        auto serial{key.serial};
+        serial.replace(QRegularExpression{"[^A-Za-z0-9_-]"}, "_");
+        return QString{"%1_%2_%3x%4_%5"}.arg(serial).arg(eye).arg(resolution.width()).arg(resolution.height())
+                                        .arg(key.ipd);
+    }
+
+    static QString directory() {
+        return ConfigurationServer::value(parameter(Parameter::lensMeshDirectory)).right(QVariant{QString{}})
+                                                                                   .toString();
+    }
+
+    static DistortionMesh read(QString const &name, QSize const &resolution) {
+        auto const directory{Private::directory()};
+        if (directory.isEmpty()) {
+            return {};
+        }
+        QFile file{QDir{directory}.filePath(name + ".mesh")};
+        if (!file.open(QIODevice::ReadOnly)) {
+            return {};
+        }
+        QDataStream stream{&file};
+        stream.setVersion(QDataStream::Qt_5_6);
+        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        quint32 fileMagic{0};
+        quint8 fileVersion{0};
+        stream >> fileMagic >> fileVersion;
+        if (fileMagic != magic || fileVersion != version) {
+            return {};
+        }
+        DistortionMesh mesh{};
+        stream >> mesh;
+        // a truncated or foreign file is regenerated instead of being trusted
+        if (stream.status() != QDataStream::Ok || !isConsistent(mesh, resolution)) {
+            return {};
+        }
+        return mesh;
+    }
+
+    static void write(QString const &name, DistortionMesh const &mesh) {
+        auto const directory{Private::directory()};
+        if (directory.isEmpty() || !QDir{}.mkpath(directory)) {
+            return;
+        }
+        // the file is replaced atomically, so that concurrent applications never read a partial mesh
+        QSaveFile file{QDir{directory}.filePath(name + ".mesh")};
+        if (!file.open(QIODevice::WriteOnly)) {
+            return;
+        }
+        QDataStream stream{&file};
+        stream.setVersion(QDataStream::Qt_5_6);
+        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        stream << magic << version << mesh;
+        file.commit();
+    }
+
+    static DistortionMesh generate(Identifier const eye, QSize const &resolution) {
+        DistortionMesh mesh{};
+        // one scope for the whole grid instead of one driver lock per vertex
+        DriverServer::synchronized([&] {
+            mesh = build(resolution, [eye](QVector2D const &position, DistortionMesh::Vertex &vertex) {
+                vr::DistortionCoordinates_t coordinates{};
+                if (!vr::VRSystem()->ComputeDistortion(static_cast<vr::EVREye>(eye), position.x(), position.y(),
+                                                       &coordinates)) {
+                    return false;
+                }
+                vertex.red = QVector2D{coordinates.rfRed[0], coordinates.rfRed[1]};
+                vertex.green = QVector2D{coordinates.rfGreen[0], coordinates.rfGreen[1]};
+                vertex.blue = QVector2D{coordinates.rfBlue[0], coordinates.rfBlue[1]};
+                return true;
+            });
+        }, Trilean::yes);
+        return mesh;
+    }
+
+    DistortionMesh lookup(QString const &name) {
+        QMutexLocker locker{&lock};
+        return distortions.value(name);
+    }
+
+    void store(QString const &name, DistortionMesh const &mesh) {
+        QMutexLocker locker{&lock};
+        distortions.insert(name, mesh);
+    }
+
+public: // variables
+    QMutex lock{};
+    QHash<QString, DistortionMesh> distortions{};
+    QHash<QString, HiddenAreaMesh> hiddenAreas{};
+};
+
+constexpr quint32 LensMeshCache::Private::magic;
+constexpr quint8 LensMeshCache::Private::version;
+
+LensMeshCache::~LensMeshCache() = default;
+
+DistortionMesh LensMeshCache::distortion(Identifier const device, Identifier const eye, QSize const resolution) {
+    return distortions(device, {eye}, resolution).value(eye);
+}
+
+QMap<Identifier, DistortionMesh>
+LensMeshCache::distortions(Identifier const device, QList<Identifier> const &eyes, QSize const resolution) {
+    auto const &_private{instance()._private};
+    QSize const bounded{qBound(minimumResolution, resolution.width(), maximumResolution),
+                        qBound(minimumResolution, resolution.height(), maximumResolution)};
+    auto const key{Private::resolve(device)};
+    QMap<Identifier, DistortionMesh> meshes{};
+    QMap<Identifier, QFuture<DistortionMesh>> futures{};
+    for (auto const eye : eyes) {
+        auto const name{Private::name(key, eye, bounded)};
+        auto const mesh{_private->lookup(name)};
+        if (!mesh.isEmpty()) {
+            meshes.insert(eye, mesh);
+            continue;
+        }
+        // while one eye waits for the driver, the other one can be read from or written to disk
+        futures.insert(eye, QtConcurrent::run([name, eye, bounded] {
+            auto mesh{Private::read(name, bounded)};
+            if (mesh.isEmpty()) {
+                mesh = Private::generate(eye, bounded);
+                if (!mesh.isEmpty()) {
+                    Private::write(name, mesh);
+                }
+            }
+            return mesh;
+        }));
+    }
+    for (auto future = futures.begin(); future != futures.end(); ++future) {
+        auto const mesh{future->result()};
+        if (!mesh.isEmpty()) {
+            _private->store(Private::name(key, future.key(), bounded), mesh);
+        }
+        meshes.insert(future.key(), mesh);
+    }
+    return meshes;
+}
+
+HiddenAreaMesh LensMeshCache::hiddenArea(Identifier const device, Identifier const eye,
+                                         HiddenAreaMesh::Type const type) {
+    auto const &_private{instance()._private};
+    auto const name{QString{"%1_%2"}.arg(Private::name(Private::resolve(device), eye, {})).arg(static_cast<int>(type))};
+    {
+        QMutexLocker locker{&_private->lock};
+        auto const iterator{_private->hiddenAreas.constFind(name)};
+        if (iterator != _private->hiddenAreas.constEnd()) {
+            return iterator.value();
+        }
+    }
+    QVector<QVector2D> vertices{};
+    DriverServer::synchronized([&] {
+        auto const mesh{vr::VRSystem()->GetHiddenAreaMesh(static_cast<vr::EVREye>(eye),
+                                                          static_cast<vr::EHiddenAreaMeshType>(type))};
+        // the driver owns the vertices, so they are copied before the scope is left
+        auto const count{type == HiddenAreaMesh::Type::lineLoop ? mesh.unTriangleCount : mesh.unTriangleCount * 3};
+        if (mesh.pVertexData != nullptr) {
+            vertices.reserve(static_cast<qint32>(count));
+            for (quint32 index = 0; index < count; index++) {
+                vertices.append(QVector2D{mesh.pVertexData[index].v[0], mesh.pVertexData[index].v[1]});
+            }
+        }
+    }, Trilean::yes);
+    auto const compacted{compact(vertices, type)};
+    QMutexLocker locker{&_private->lock};
+    _private->hiddenAreas.insert(name, compacted);
+    return compacted;
+}
+
+DistortionMesh LensMeshCache::build(QSize const resolution,
+                                    std::function<bool(QVector2D const &, DistortionMesh::Vertex &)> const &sample) {
+    auto const columns{qBound(minimumResolution, resolution.width(), maximumResolution)};
+    auto const rows{qBound(minimumResolution, resolution.height(), maximumResolution)};
+    DistortionMesh mesh{};
+    mesh.vertices.reserve(columns * rows);
+    for (auto row = 0; row < rows; row++) {
+        for (auto column = 0; column < columns; column++) {
+            DistortionMesh::Vertex vertex{};
+            vertex.position = QVector2D{static_cast<float>(column) / static_cast<float>(columns - 1),
+                                        static_cast<float>(row) / static_cast<float>(rows - 1)};
+            if (!sample(vertex.position, vertex)) {
+                return {};
+            }
+            mesh.vertices.append(vertex);
+        }
+    }
+    mesh.resolution = QSize{columns, rows};
+    mesh.indices.reserve((columns - 1) * (rows - 1) * 6);
+    for (auto row = 0; row < rows - 1; row++) {
+        for (auto column = 0; column < columns - 1; column++) {
+            auto const topLeft{static_cast<quint16>(row * columns + column)};
+            auto const topRight{static_cast<quint16>(topLeft + 1)};
+            auto const bottomLeft{static_cast<quint16>(topLeft + columns)};
+            auto const bottomRight{static_cast<quint16>(bottomLeft + 1)};
+            mesh.indices << topLeft << topRight << bottomRight << topLeft << bottomRight << bottomLeft;
+        }
+    }
+    return mesh;
+}
+
+bool LensMeshCache::isConsistent(DistortionMesh const &mesh, QSize const resolution) noexcept {
+    if (mesh.resolution != resolution || resolution.width() < minimumResolution ||
+        resolution.height() < minimumResolution ||
+        mesh.vertices.size() != resolution.width() * resolution.height() ||
+        mesh.indices.size() != (resolution.width() - 1) * (resolution.height() - 1) * 6) {
+        return false;
+    }
+    auto const vertices{mesh.vertices.size()};
+    return std::all_of(mesh.indices.cbegin(), mesh.indices.cend(), [vertices](quint16 const index) {
+        return index < vertices;
+    });
+}
+
+HiddenAreaMesh LensMeshCache::compact(QVector<QVector2D> const &vertices, HiddenAreaMesh::Type const type) {
+    HiddenAreaMesh mesh{};
+    mesh.type = type;
+    QHash<QPair<float, float>, quint16> known{};
+    for (auto const &vertex : vertices) {
+        auto const key{qMakePair(vertex.x(), vertex.y())};
+        auto const iterator{known.constFind(key)};
+        if (iterator != known.constEnd()) {
+            mesh.indices.append(iterator.value());
+        } else {
+            auto const index{static_cast<quint16>(mesh.vertices.size())};
+            known.insert(key, index);
+            mesh.vertices.append(vertex);
+            mesh.indices.append(index);
+        }
+    }
+    return mesh;
+}
+
+void LensMeshCache::observe(void const *event) {
+    auto const *theEvent{static_cast<vr::VREvent_t const *>(event)};
+    if (theEvent != nullptr && theEvent->eventType == vr::VREvent_IpdChanged) {
+        clear();
+    }
+}
+
+void LensMeshCache::clear() {
+    auto const &_private{instance()._private};
+    QMutexLocker locker{&_private->lock};
+    _private->distortions.clear();
+    _private->hiddenAreas.clear();
+}
+
+LensMeshCache::LensMeshCache() :
+        _private{new Private} {}
+
+LensMeshCache &LensMeshCache::instance() noexcept {
+    static LensMeshCache instance;
+    return instance;
+}
@@ -0,0 +1,61 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QDataStream>
+
+#include <CuteVR/Internal/NodeFrame.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Extension::Optional;
+using Internal::NodeFrame;
+
+constexpr quint32 NodeFrame::magic;
+constexpr quint8 NodeFrame::version;
+
+namespace {
+    /// an entry takes 58 bytes, thus a frame of this many entries still fits into a single datagram
+    constexpr quint16 maximumEntries{1024};
+}
+
+QByteArray NodeFrame::encode() const {
+    QByteArray datagram{};
+    QDataStream stream{&datagram, QIODevice::WriteOnly};
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    auto const count{static_cast<quint16>(qMin(entries.size(), static_cast<qint32>(maximumEntries)))};
+    stream << magic << version << node << sequence << count;
+    for (auto index = 0; index < count; index++) {
+        auto const &entry{entries.at(index)};
+        stream << entry.device << entry.category << entry.pose.position << entry.pose.flags << entry.pose.orientation
+               << entry.pose.linearVelocity << entry.pose.angularVelocity;
+    }
+    return datagram;
+}
+
+Optional<NodeFrame> NodeFrame::decode(QByteArray const &datagram) {
+    QDataStream stream{datagram};
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    quint32 datagramMagic{0};
+    quint8 datagramVersion{0};
+    quint16 count{0};
+    NodeFrame frame{};
+    stream >> datagramMagic >> datagramVersion >> frame.node >> frame.sequence >> count;
+    if (stream.status() != QDataStream::Ok || datagramMagic != magic || datagramVersion != version ||
+        count > maximumEntries) {
+        return {};
+    }
+    frame.entries.resize(count);
+    for (auto &entry : frame.entries) {
+        stream >> entry.device >> entry.category >> entry.pose.position >> entry.pose.flags >> entry.pose.orientation
+               >> entry.pose.linearVelocity >> entry.pose.angularVelocity;
+    }
+    // a truncated datagram or one with trailing data is not trusted at all
+    if (stream.status() != QDataStream::Ok || !stream.atEnd()) {
+        return {};
+    }
+    return Optional<NodeFrame>{frame};
+}
@@ -0,0 +1,101 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QtGlobal>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+#include <CuteVR/Internal/NodeHub.hpp>
+
+using namespace CuteVR;
+using Internal::NodeFrame;
+using Internal::NodeHub;
+
+class NodeHub::Private {
+public: // types
+    struct Received {
+        NodeFrame frame{};
+        qint64 time{0};
+    };
+
+public: // variables
+    QUdpSocket socket{};
+    QMap<Identifier, Received> nodes{};
+    quint64 dropped{0};
+    QByteArray buffer{};
+};
+
+NodeHub::NodeHub(quint16 const port) :
+        _private{new Private} {
+    if (!_private->socket.bind(QHostAddress::AnyIPv4, port)) {
+        qWarning("Node hub could not listen on UDP port %u: %s", port, qPrintable(_private->socket.errorString()));
+    }
+}
+
+NodeHub::~NodeHub() = default;
+
+quint16 NodeHub::port() const noexcept {
+    return _private->socket.state() == QAbstractSocket::BoundState ? _private->socket.localPort() : quint16{0};
+}
+
+QMap<Identifier, NodeFrame> NodeHub::frames() const {
+    QMap<Identifier, NodeFrame> frames{};
+    for (auto node = _private->nodes.cbegin(); node != _private->nodes.cend(); ++node) {
+        frames.insert(node.key(), node->frame);
+    }
+    return frames;
+}
+
+quint64 NodeHub::dropped() const noexcept {
+    return _private->dropped;
+}
+
+void NodeHub::receive(qint64 const now) {
+    // the buffer keeps its capacity, so that draining a frame does not allocate
+    while (_private->socket.hasPendingDatagrams()) {
+        auto const size{_private->socket.pendingDatagramSize()};
+        if (size < 0) {
+            break;
+        }
+        _private->buffer.resize(static_cast<qint32>(size));
+        auto const read{_private->socket.readDatagram(_private->buffer.data(), size)};
+        if (read < 0) {
+            break;
+        }
+        _private->buffer.resize(static_cast<qint32>(read));
+        accept(_private->buffer, now);
+    }
+}
+
+bool NodeHub::accept(QByteArray const &datagram, qint64 const now) {
+    auto const frame{NodeFrame::decode(datagram)};
+    // node zero would collide with the local cell and its devices, larger ones with the identifiers of the proxies
+    if (!frame.hasValue() || frame.value().node == 0 || frame.value().node > 0xffffu) {
+        _private->dropped++;
+        return false;
+    }
+    auto const node{frame.value().node};
+    // a restarted node starts over with its sequence, thus it is only accepted again once its old frames expired
+    auto const known{_private->nodes.constFind(node)};
+    if (known != _private->nodes.constEnd() && !NodeFrame::isNewer(frame.value().sequence, known->frame.sequence)) {
+        _private->dropped++;
+        return false;
+    }
+    _private->nodes.insert(node, Private::Received{frame.value(), now});
+    return true;
+}
+
+QList<Identifier> NodeHub::expire(qint64 const now, qint64 const timeout) {
+    QList<Identifier> expired{};
+    for (auto node = _private->nodes.begin(); node != _private->nodes.end();) {
+        if (now - node->time > timeout) {
+            expired.append(node.key());
+            node = _private->nodes.erase(node);
+        } else {
+            ++node;
+        }
+    }
+    return expired;
+}
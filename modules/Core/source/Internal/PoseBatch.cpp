@@ -0,0 +1,126 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <openvr.h>
+
+#include <CuteVR/Internal/PoseBatch.hpp>
+#include <CuteVR/Internal/Quaternion.hpp>
+#include <CuteVR/Internal/Simd.hpp>
+
+using namespace CuteVR;
+using Internal::PoseBatch::InstructionSet;
+using Internal::PoseBatch::Packed;
+using Internal::PoseBatch::matrixSize;
+
+namespace {
+    void scalarMatrices(vr::TrackedDevicePose_t const *poses, qint32 const count, float *matrices) noexcept {
+        for (auto index = 0; index < count; index++) {
+            auto const &m{poses[index].mDeviceToAbsoluteTracking.m};
+            auto *matrix{matrices + index * matrixSize};
+            for (auto column = 0; column < 4; column++) {
+                matrix[column * 4 + 0] = m[0][column];
+                matrix[column * 4 + 1] = m[1][column];
+                matrix[column * 4 + 2] = m[2][column];
+                matrix[column * 4 + 3] = column == 3 ? 1.0f : 0.0f;
+            }
+        }
+    }
+
+#ifdef CUTE_VR_SIMD_SSE2
+    void sse2Matrices(vr::TrackedDevicePose_t const *poses, qint32 const count, float *matrices) noexcept {
+        auto const bottom{_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)};
+        for (auto index = 0; index < count; index++) {
+            auto const *rows{&poses[index].mDeviceToAbsoluteTracking.m[0][0]};
+            auto *matrix{matrices + index * matrixSize};
+            auto row0{_mm_loadu_ps(rows)};
+            auto row1{_mm_loadu_ps(rows + 4)};
+            auto row2{_mm_loadu_ps(rows + 8)};
+            auto row3{bottom};
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+            _mm_storeu_ps(matrix, row0);
+            _mm_storeu_ps(matrix + 4, row1);
+            _mm_storeu_ps(matrix + 8, row2);
+            _mm_storeu_ps(matrix + 12, row3);
+        }
+    }
+#endif
+
+#ifdef CUTE_VR_SIMD_AVX2
+    CUTE_VR_SIMD_AVX2
+    __m256 loadRows(float const *first, float const *second) noexcept {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(first)), _mm_loadu_ps(second), 1);
+    }
+
+    CUTE_VR_SIMD_AVX2
+    void avx2Matrices(vr::TrackedDevicePose_t const *poses, qint32 const count, float *matrices) noexcept {
+        // each 128 bit lane holds the rows of another pose and is transposed on its own
+        auto const bottom{_mm256_set_ps(1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f)};
+        auto index{0};
+        for (; index + 1 < count; index += 2) {
+            auto const *first{&poses[index].mDeviceToAbsoluteTracking.m[0][0]};
+            auto const *second{&poses[index + 1].mDeviceToAbsoluteTracking.m[0][0]};
+            auto *matrix{matrices + index * matrixSize};
+            auto const row0{loadRows(first, second)};
+            auto const row1{loadRows(first + 4, second + 4)};
+            auto const row2{loadRows(first + 8, second + 8)};
+            auto const low01{_mm256_unpacklo_ps(row0, row1)};
+            auto const high01{_mm256_unpackhi_ps(row0, row1)};
+            auto const low23{_mm256_unpacklo_ps(row2, bottom)};
+            auto const high23{_mm256_unpackhi_ps(row2, bottom)};
+            auto const column0{_mm256_shuffle_ps(low01, low23, _MM_SHUFFLE(1, 0, 1, 0))};
+            auto const column1{_mm256_shuffle_ps(low01, low23, _MM_SHUFFLE(3, 2, 3, 2))};
+            auto const column2{_mm256_shuffle_ps(high01, high23, _MM_SHUFFLE(1, 0, 1, 0))};
+            auto const column3{_mm256_shuffle_ps(high01, high23, _MM_SHUFFLE(3, 2, 3, 2))};
+            _mm256_storeu_ps(matrix, _mm256_permute2f128_ps(column0, column1, 0x20));
+            _mm256_storeu_ps(matrix + 8, _mm256_permute2f128_ps(column2, column3, 0x20));
+            _mm256_storeu_ps(matrix + 16, _mm256_permute2f128_ps(column0, column1, 0x31));
+            _mm256_storeu_ps(matrix + 24, _mm256_permute2f128_ps(column2, column3, 0x31));
+        }
+        if (index < count) {
+            sse2Matrices(poses + index, count - index, matrices + index * matrixSize);
+        }
+    }
+#endif
+}
+
+void Internal::PoseBatch::toMatrices(vr::TrackedDevicePose_t const *poses, qint32 const count, float *matrices,
+                                     InstructionSet const set) noexcept {
+    switch (Simd::select(set)) {
+#ifdef CUTE_VR_SIMD_AVX2
+        case InstructionSet::avx2: {
+            avx2Matrices(poses, count, matrices);
+            break;
+        }
+#endif
+#ifdef CUTE_VR_SIMD_SSE2
+        case InstructionSet::sse2: {
+            sse2Matrices(poses, count, matrices);
+            break;
+        }
+#endif
+        default: {
+            scalarMatrices(poses, count, matrices);
+            break;
+        }
+    }
+}
+
+void Internal::PoseBatch::toPacked(vr::TrackedDevicePose_t const *poses, qint32 const count, Packed *packed) {
+    for (auto index = 0; index < count; index++) {
+        auto const &pose{poses[index]};
+        auto const &m{pose.mDeviceToAbsoluteTracking.m};
+        auto &target{packed[index]};
+        auto const orientation{Internal::Quaternion::from(pose.mDeviceToAbsoluteTracking)};
+        target.position[0] = m[0][3];
+        target.position[1] = m[1][3];
+        target.position[2] = m[2][3];
+        target.orientation[0] = orientation.scalar();
+        target.orientation[1] = orientation.x();
+        target.orientation[2] = orientation.y();
+        target.orientation[3] = orientation.z();
+        std::copy(pose.vVelocity.v, pose.vVelocity.v + 3, target.linearVelocity);
+        std::copy(pose.vAngularVelocity.v, pose.vAngularVelocity.v + 3, target.angularVelocity);
+    }
+}
@@ -0,0 +1,261 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <openvr.h>
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QHash>
+#include <QtCore/QReadWriteLock>
+#include <QtGui/QMatrix4x4>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Internal/PropertyCache.hpp>
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Internal::PropertyCache;
+
+namespace Profile = Configurations::Core::Profile;
+
+class PropertyCache::Private {
+public: // constructor
+    explicit Private(PropertyCache *that) :
+            that{that} {}
+
+public: // methods
+    static constexpr quint64 key(Identifier const device, qint32 const property) noexcept {
+        return static_cast<quint64>(device) << 32 | static_cast<quint32>(property);
+    }
+
+    static constexpr Identifier deviceOf(quint64 const key) noexcept {
+        return static_cast<Identifier>(key >> 32);
+    }
+
+    template<class ValueT>
+    QHash<quint64, ValueT> &typedSlots() noexcept;
+
+    template<class ValueT>
+    static void removeDevice(QHash<quint64, ValueT> &hash, Identifier const device) {
+        auto iterator{hash.begin()};
+        while (iterator != hash.end()) {
+            if (deviceOf(iterator.key()) == device) {
+                iterator = hash.erase(iterator);
+            } else {
+                ++iterator;
+            }
+        }
+    }
+
+    /// The generation of an entry is the latest of its own, of its device, and of the whole cache.
+    quint64 generationOf(quint64 const key) const {
+        return qMax(qMax(keyGenerations.value(key), deviceGenerations.value(deviceOf(key))), cacheGeneration);
+    }
+
+    void invalidate(quint64 const key) {
+        QWriteLocker locker{&lock};
+        keyGenerations.insert(key, ++generations);
+        bools.remove(key);
+        floats.remove(key);
+        int32s.remove(key);
+        uint64s.remove(key);
+        matrices4x3.remove(key);
+        matrices4x4.remove(key);
+        strings.remove(key);
+    }
+
+    void clear(Identifier const device) {
+        QWriteLocker locker{&lock};
+        deviceGenerations.insert(device, ++generations);
+        removeDevice(bools, device);
+        removeDevice(floats, device);
+        removeDevice(int32s, device);
+        removeDevice(uint64s, device);
+        removeDevice(matrices4x3, device);
+        removeDevice(matrices4x4, device);
+        removeDevice(strings, device);
+    }
+
+public: // variables
+    PropertyCache *that{nullptr};
+    QReadWriteLock lock{};
+    QAtomicInteger<quint64> hits{0};
+    QAtomicInteger<quint64> misses{0};
+    QHash<quint64, bool> bools{};
+    QHash<quint64, float> floats{};
+    QHash<quint64, qint32> int32s{};
+    QHash<quint64, quint64> uint64s{};
+    QHash<quint64, QMatrix4x3> matrices4x3{};
+    QHash<quint64, QMatrix4x4> matrices4x4{};
+    QHash<quint64, QString> strings{};
+    // all generations are drawn from one counter, so that the latest of them is the valid one
+    quint64 generations{0};
+    quint64 cacheGeneration{0};
+    QHash<quint64, quint64> keyGenerations{};
+    QHash<Identifier, quint64> deviceGenerations{};
+};
+
+template<>
+QHash<quint64, bool> &PropertyCache::Private::typedSlots<bool>() noexcept {
+    return bools;
+}
+
+template<>
+QHash<quint64, float> &PropertyCache::Private::typedSlots<float>() noexcept {
+    return floats;
+}
+
+template<>
+QHash<quint64, qint32> &PropertyCache::Private::typedSlots<qint32>() noexcept {
+    return int32s;
+}
+
+template<>
+QHash<quint64, quint64> &PropertyCache::Private::typedSlots<quint64>() noexcept {
+    return uint64s;
+}
+
+template<>
+QHash<quint64, QMatrix4x3> &PropertyCache::Private::typedSlots<QMatrix4x3>() noexcept {
+    return matrices4x3;
+}
+
+template<>
+QHash<quint64, QMatrix4x4> &PropertyCache::Private::typedSlots<QMatrix4x4>() noexcept {
+    return matrices4x4;
+}
+
+template<>
+QHash<quint64, QString> &PropertyCache::Private::typedSlots<QString>() noexcept {
+    return strings;
+}
+
+PropertyCache::~PropertyCache() = default;
+
+bool PropertyCache::isEnabled() noexcept {
+    return Profile::isEnabled<Feature::propertyCache>() && Profile::isEnabled<Feature::events>();
+}
+
+quint64 PropertyCache::hits() noexcept {
+    return instance()._private->hits.load();
+}
+
+quint64 PropertyCache::misses() noexcept {
+    return instance()._private->misses.load();
+}
+
+quint64 PropertyCache::generation(Identifier const device, qint32 const property) {
+    auto const &_private{instance()._private};
+    QReadLocker locker{&_private->lock};
+    return _private->generationOf(Private::key(device, property));
+}
+
+template<class ValueT>
+bool PropertyCache::lookup(Identifier const device, qint32 const property, ValueT &value) {
+    if (!isEnabled()) {
+        return false;
+    }
+    auto const &_private{instance()._private};
+    QReadLocker locker{&_private->lock};
+    auto const &typedSlots{_private->typedSlots<ValueT>()};
+    auto const iterator{typedSlots.constFind(Private::key(device, property))};
+    if (iterator == typedSlots.constEnd()) {
+        _private->misses.fetchAndAddRelaxed(1);
+        return false;
+    }
+    value = iterator.value();
+    _private->hits.fetchAndAddRelaxed(1);
+    return true;
+}
+
+template<class ValueT>
+bool PropertyCache::store(Identifier const device, qint32 const property, ValueT const &value,
+                          quint64 const generation) {
+    if (!isEnabled()) {
+        return false;
+    }
+    auto const &_private{instance()._private};
+    auto const key{Private::key(device, property)};
+    QWriteLocker locker{&_private->lock};
+    // a value that has been fetched before an invalidation would otherwise stay cached
+    if (_private->generationOf(key) != generation) {
+        return false;
+    }
+    _private->typedSlots<ValueT>().insert(key, value);
+    return true;
+}
+
+void PropertyCache::observe(void const *event) {
+    auto const *theEvent{static_cast<vr::VREvent_t const *>(event)};
+    if (theEvent == nullptr) {
+        return;
+    }
+    switch (theEvent->eventType) {
+        case vr::VREvent_PropertyChanged: {
+            instance()._private->invalidate(Private::key(theEvent->trackedDeviceIndex, theEvent->data.property.prop));
+            break;
+        }
+        case vr::VREvent_IpdChanged: {
+            // the driver does not necessarily announce the distance as a changed property of the display as well
+            instance()._private->invalidate(Private::key(theEvent->trackedDeviceIndex, vr::Prop_UserIpdMeters_Float));
+            instance()._private->invalidate(Private::key(vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_UserIpdMeters_Float));
+            break;
+        }
+        case vr::VREvent_TrackedDeviceActivated:
+        case vr::VREvent_TrackedDeviceDeactivated: {
+            instance()._private->clear(theEvent->trackedDeviceIndex);
+            break;
+        }
+        default: break;
+    }
+}
+
+void PropertyCache::clear(Identifier const device) {
+    instance()._private->clear(device);
+}
+
+void PropertyCache::clear() {
+    auto const &_private{instance()._private};
+    QWriteLocker locker{&_private->lock};
+    _private->cacheGeneration = ++_private->generations;
+    _private->keyGenerations.clear();
+    _private->deviceGenerations.clear();
+    _private->bools.clear();
+    _private->floats.clear();
+    _private->int32s.clear();
+    _private->uint64s.clear();
+    _private->matrices4x3.clear();
+    _private->matrices4x4.clear();
+    _private->strings.clear();
+}
+
+void PropertyCache::resetStatistics() noexcept {
+    auto const &_private{instance()._private};
+    _private->hits.store(0);
+    _private->misses.store(0);
+}
+
+PropertyCache::PropertyCache() :
+        _private{new Private{this}} {}
+
+PropertyCache &PropertyCache::instance() noexcept {
+    static PropertyCache instance;
+    return instance;
+}
+
+// the slots are limited to the types that are supported by Property::query
+template bool PropertyCache::lookup<bool>(Identifier, qint32, bool &);
+template bool PropertyCache::lookup<float>(Identifier, qint32, float &);
+template bool PropertyCache::lookup<qint32>(Identifier, qint32, qint32 &);
+template bool PropertyCache::lookup<quint64>(Identifier, qint32, quint64 &);
+template bool PropertyCache::lookup<QMatrix4x3>(Identifier, qint32, QMatrix4x3 &);
+template bool PropertyCache::lookup<QMatrix4x4>(Identifier, qint32, QMatrix4x4 &);
+template bool PropertyCache::lookup<QString>(Identifier, qint32, QString &);
+template bool PropertyCache::store<bool>(Identifier, qint32, bool const &, quint64);
+template bool PropertyCache::store<float>(Identifier, qint32, float const &, quint64);
+template bool PropertyCache::store<qint32>(Identifier, qint32, qint32 const &, quint64);
+template bool PropertyCache::store<quint64>(Identifier, qint32, quint64 const &, quint64);
+template bool PropertyCache::store<QMatrix4x3>(Identifier, qint32, QMatrix4x3 const &, quint64);
+template bool PropertyCache::store<QMatrix4x4>(Identifier, qint32, QMatrix4x4 const &, quint64);
+template bool PropertyCache::store<QString>(Identifier, qint32, QString const &, quint64);
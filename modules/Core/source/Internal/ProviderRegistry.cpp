@@ -0,0 +1,75 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QWeakPointer>
+
+#include <CuteVR/Internal/ProviderRegistry.hpp>
+
+using namespace CuteVR;
+using Internal::ProviderRegistry;
+
+class ProviderRegistry::Private {
+public: // constructor
+    explicit Private(ProviderRegistry *that) :
+            that{that} {}
+
+public: // variables
+    ProviderRegistry *that{nullptr};
+    QMutex lock{};
+    QHash<QPair<Identifier, QByteArray>, QWeakPointer<Hub>> hubs{};
+};
+
+ProviderRegistry::~ProviderRegistry() = default;
+
+qint32 ProviderRegistry::providers() noexcept {
+    auto const &_private{instance()._private};
+    QMutexLocker locker{&_private->lock};
+    auto alive{0};
+    for (auto const &hub : _private->hubs) {
+        if (hub.toStrongRef()) {
+            alive++;
+        }
+    }
+    return alive;
+}
+
+QSharedPointer<ProviderRegistry::Hub> ProviderRegistry::acquire(Identifier const device, QByteArray const &type,
+                                                                std::function<QSharedPointer<Hub>()> const &create) {
+    auto const &_private{instance()._private};
+    auto const key{qMakePair(device, type)};
+    {
+        QMutexLocker locker{&_private->lock};
+        if (auto const hub = _private->hubs.value(key).toStrongRef()) {
+            return hub;
+        }
+    }
+    // the provider queries the driver when it is created, which must not block the lookup of all other providers
+    auto const created{create()};
+    QMutexLocker locker{&_private->lock};
+    if (auto const hub = _private->hubs.value(key).toStrongRef()) {
+        return hub; // another subscriber was faster, the created hub is dropped together with its provider
+    }
+    _private->hubs.insert(key, created.toWeakRef());
+    // drop the entries of hubs that have died meanwhile
+    auto iterator{_private->hubs.begin()};
+    while (iterator != _private->hubs.end()) {
+        if (iterator.value().isNull()) {
+            iterator = _private->hubs.erase(iterator);
+        } else {
+            ++iterator;
+        }
+    }
+    return created;
+}
+
+ProviderRegistry::ProviderRegistry() :
+        _private{new Private{this}} {}
+
+ProviderRegistry &ProviderRegistry::instance() noexcept {
+    static ProviderRegistry instance;
+    return instance;
+}
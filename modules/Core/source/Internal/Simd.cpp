@@ -0,0 +1,35 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Internal/Simd.hpp>
+
+using namespace CuteVR;
+using Internal::Simd::InstructionSet;
+
+namespace {
+#ifdef CUTE_VR_SIMD_AVX2
+    bool avx2Supported() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("avx2") != 0;
+#else
+        return true;
+#endif
+    }
+#endif
+}
+
+InstructionSet Internal::Simd::supported() noexcept {
+#ifdef CUTE_VR_SIMD_AVX2
+    static auto const avx2{avx2Supported()};
+    if (avx2) {
+        return InstructionSet::avx2;
+    }
+#endif
+#ifdef CUTE_VR_SIMD_SSE2
+    return InstructionSet::sse2;
+#else
+    return InstructionSet::scalar;
+#endif
+}
@@ -0,0 +1,468 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Internal/Simd.hpp>
+#include <CuteVR/Internal/TransformKernels.hpp>
+
+using namespace CuteVR;
+using Internal::TransformKernels::InstructionSet;
+using Internal::TransformKernels::Rigid;
+
+static_assert(sizeof(QQuaternion) == 4 * sizeof(float), "A quaternion must consist of its packed components.");
+static_assert(sizeof(QVector3D) == 3 * sizeof(float), "A vector must consist of its packed components.");
+static_assert(sizeof(Rigid) == 8 * sizeof(float), "A rigid transform must fill exactly two registers.");
+
+namespace {
+    // the math is written once against a lane type, which is either a single float or four floats in a register,
+    // while Pack converts between the arrays of the caller and the lanes
+
+    template<class F>
+    struct Tag {
+        using Type = F;
+    };
+
+    template<class F>
+    struct Quaternions {
+        F w, x, y, z;
+    };
+
+    template<class F>
+    struct Vectors {
+        F x, y, z;
+    };
+
+    template<class F>
+    struct Rotations {
+        F m00, m01, m02, m10, m11, m12, m20, m21, m22;
+    };
+
+    template<class F>
+    struct Pack;
+
+    template<class F>
+    F splat(float value) noexcept;
+
+    template<>
+    float splat<float>(float const value) noexcept {
+        return value;
+    }
+
+    inline float sqrtOf(float const value) noexcept {
+        return std::sqrt(value);
+    }
+
+    inline bool greater(float const left, float const right) noexcept {
+        return left > right;
+    }
+
+    inline bool lessEqual(float const left, float const right) noexcept {
+        return left <= right;
+    }
+
+    inline bool greaterEqual(float const left, float const right) noexcept {
+        return left >= right;
+    }
+
+    inline float choose(bool const mask, float const chosen, float const otherwise) noexcept {
+        return mask ? chosen : otherwise;
+    }
+
+    /// the factors of QQuaternion::slerp, which need transcendental functions
+    inline void slerpFactors(float const dot, float const weight, float &fromFactor, float &toFactor) noexcept {
+        fromFactor = 1.0f - weight;
+        toFactor = weight;
+        if ((1.0f - dot) > 0.0000001f) {
+            auto const angle{std::acos(dot)};
+            auto const sinOfAngle{std::sin(angle)};
+            if (sinOfAngle > 0.0000001f) {
+                fromFactor = std::sin((1.0f - weight) * angle) / sinOfAngle;
+                toFactor = std::sin(weight * angle) / sinOfAngle;
+            }
+        }
+    }
+
+    template<>
+    struct Pack<float> {
+        static constexpr qint32 width{1};
+
+        static float scalars(float const *source) noexcept {
+            return *source;
+        }
+
+        static Quaternions<float> quaternions(float const *source, qint32) noexcept {
+            return {source[0], source[1], source[2], source[3]};
+        }
+
+        static Vectors<float> vectors(float const *source, qint32) noexcept {
+            return {source[0], source[1], source[2]};
+        }
+
+        static Rotations<float> rotations(float const *source) noexcept {
+            return {source[0], source[4], source[8], source[1], source[5], source[9], source[2], source[6], source[10]};
+        }
+
+        static void store(Quaternions<float> const &quaternions, float *target, qint32) noexcept {
+            target[0] = quaternions.w;
+            target[1] = quaternions.x;
+            target[2] = quaternions.y;
+            target[3] = quaternions.z;
+        }
+
+        static void store(Vectors<float> const &vectors, float *target, qint32) noexcept {
+            target[0] = vectors.x;
+            target[1] = vectors.y;
+            target[2] = vectors.z;
+        }
+    };
+
+#ifdef CUTE_VR_SIMD_SSE2
+    struct Lanes {
+        __m128 v;
+    };
+
+    template<>
+    Lanes splat<Lanes>(float const value) noexcept {
+        return {_mm_set1_ps(value)};
+    }
+
+    inline Lanes operator+(Lanes const left, Lanes const right) noexcept {
+        return {_mm_add_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator-(Lanes const left, Lanes const right) noexcept {
+        return {_mm_sub_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator*(Lanes const left, Lanes const right) noexcept {
+        return {_mm_mul_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator/(Lanes const left, Lanes const right) noexcept {
+        return {_mm_div_ps(left.v, right.v)};
+    }
+
+    inline Lanes operator-(Lanes const lanes) noexcept {
+        return {_mm_xor_ps(lanes.v, _mm_set1_ps(-0.0f))};
+    }
+
+    inline Lanes sqrtOf(Lanes const lanes) noexcept {
+        return {_mm_sqrt_ps(lanes.v)};
+    }
+
+    inline Lanes greater(Lanes const left, Lanes const right) noexcept {
+        return {_mm_cmpgt_ps(left.v, right.v)};
+    }
+
+    inline Lanes lessEqual(Lanes const left, Lanes const right) noexcept {
+        return {_mm_cmple_ps(left.v, right.v)};
+    }
+
+    inline Lanes greaterEqual(Lanes const left, Lanes const right) noexcept {
+        return {_mm_cmpge_ps(left.v, right.v)};
+    }
+
+    inline Lanes choose(Lanes const mask, Lanes const chosen, Lanes const otherwise) noexcept {
+        return {_mm_or_ps(_mm_and_ps(mask.v, chosen.v), _mm_andnot_ps(mask.v, otherwise.v))};
+    }
+
+    inline void slerpFactors(Lanes const dot, Lanes const weight, Lanes &fromFactor, Lanes &toFactor) noexcept {
+        alignas(16) float dots[4], weights[4], fromFactors[4], toFactors[4];
+        _mm_store_ps(dots, dot.v);
+        _mm_store_ps(weights, weight.v);
+        for (auto lane = 0; lane < 4; lane++) {
+            slerpFactors(dots[lane], weights[lane], fromFactors[lane], toFactors[lane]);
+        }
+        fromFactor = {_mm_load_ps(fromFactors)};
+        toFactor = {_mm_load_ps(toFactors)};
+    }
+
+    template<>
+    struct Pack<Lanes> {
+        static constexpr qint32 width{4};
+
+        static Lanes scalars(float const *source) noexcept {
+            return {_mm_loadu_ps(source)};
+        }
+
+        static Lanes gather(float const *source, qint32 const stride) noexcept {
+            return {_mm_setr_ps(source[0], source[stride], source[2 * stride], source[3 * stride])};
+        }
+
+        static Quaternions<Lanes> quaternions(float const *source, qint32 const stride) noexcept {
+            auto w{_mm_loadu_ps(source)};
+            auto x{_mm_loadu_ps(source + stride)};
+            auto y{_mm_loadu_ps(source + 2 * stride)};
+            auto z{_mm_loadu_ps(source + 3 * stride)};
+            _MM_TRANSPOSE4_PS(w, x, y, z);
+            return {{w}, {x}, {y}, {z}};
+        }
+
+        static Vectors<Lanes> vectors(float const *source, qint32 const stride) noexcept {
+            return {gather(source, stride), gather(source + 1, stride), gather(source + 2, stride)};
+        }
+
+        static Rotations<Lanes> rotations(float const *source) noexcept {
+            return {gather(source, 16), gather(source + 4, 16), gather(source + 8, 16),
+                    gather(source + 1, 16), gather(source + 5, 16), gather(source + 9, 16),
+                    gather(source + 2, 16), gather(source + 6, 16), gather(source + 10, 16)};
+        }
+
+        static void store(Quaternions<Lanes> const &quaternions, float *target, qint32 const stride) noexcept {
+            auto first{quaternions.w.v}, second{quaternions.x.v}, third{quaternions.y.v}, fourth{quaternions.z.v};
+            _MM_TRANSPOSE4_PS(first, second, third, fourth);
+            _mm_storeu_ps(target, first);
+            _mm_storeu_ps(target + stride, second);
+            _mm_storeu_ps(target + 2 * stride, third);
+            _mm_storeu_ps(target + 3 * stride, fourth);
+        }
+
+        static void store(Vectors<Lanes> const &vectors, float *target, qint32 const stride) noexcept {
+            alignas(16) float x[4], y[4], z[4];
+            _mm_store_ps(x, vectors.x.v);
+            _mm_store_ps(y, vectors.y.v);
+            _mm_store_ps(z, vectors.z.v);
+            for (auto lane = 0; lane < 4; lane++) {
+                target[lane * stride] = x[lane];
+                target[lane * stride + 1] = y[lane];
+                target[lane * stride + 2] = z[lane];
+            }
+        }
+    };
+#endif
+
+    inline float const *floats(QQuaternion const *quaternion) noexcept {
+        return reinterpret_cast<float const *>(quaternion);
+    }
+
+    inline float *floats(QQuaternion *quaternion) noexcept {
+        return reinterpret_cast<float *>(quaternion);
+    }
+
+    inline float const *floats(QVector3D const *vector) noexcept {
+        return reinterpret_cast<float const *>(vector);
+    }
+
+    inline float *floats(QVector3D *vector) noexcept {
+        return reinterpret_cast<float *>(vector);
+    }
+
+    template<class M, class F>
+    Quaternions<F> choose(M const &mask, Quaternions<F> const &chosen, Quaternions<F> const &otherwise) noexcept {
+        return {choose(mask, chosen.w, otherwise.w), choose(mask, chosen.x, otherwise.x),
+                choose(mask, chosen.y, otherwise.y), choose(mask, chosen.z, otherwise.z)};
+    }
+
+    template<class F>
+    F dot(Quaternions<F> const &left, Quaternions<F> const &right) noexcept {
+        return left.w * right.w + left.x * right.x + left.y * right.y + left.z * right.z;
+    }
+
+    template<class F>
+    Quaternions<F> scaled(Quaternions<F> const &quaternions, F const factor) noexcept {
+        return {quaternions.w * factor, quaternions.x * factor, quaternions.y * factor, quaternions.z * factor};
+    }
+
+    template<class F>
+    Quaternions<F> sum(Quaternions<F> const &left, Quaternions<F> const &right) noexcept {
+        return {left.w + right.w, left.x + right.x, left.y + right.y, left.z + right.z};
+    }
+
+    template<class F>
+    Vectors<F> sum(Vectors<F> const &left, Vectors<F> const &right) noexcept {
+        return {left.x + right.x, left.y + right.y, left.z + right.z};
+    }
+
+    template<class F>
+    Vectors<F> negated(Vectors<F> const &vectors) noexcept {
+        return {-vectors.x, -vectors.y, -vectors.z};
+    }
+
+    template<class F>
+    Quaternions<F> conjugated(Quaternions<F> const &quaternions) noexcept {
+        return {quaternions.w, -quaternions.x, -quaternions.y, -quaternions.z};
+    }
+
+    /// the product is formed like the one of QQuaternion, so that the results are identical
+    template<class F>
+    Quaternions<F> multiply(Quaternions<F> const &q1, Quaternions<F> const &q2) noexcept {
+        auto const yy{(q1.w - q1.y) * (q2.w + q2.z)};
+        auto const zz{(q1.w + q1.y) * (q2.w - q2.z)};
+        auto const ww{(q1.z + q1.x) * (q2.x + q2.y)};
+        auto const xx{ww + yy + zz};
+        auto const qq{splat<F>(0.5f) * (xx + (q1.z - q1.x) * (q2.x - q2.y))};
+        return {qq - ww + (q1.z - q1.y) * (q2.y - q2.z),
+                qq - xx + (q1.x + q1.w) * (q2.x + q2.w),
+                qq - yy + (q1.w - q1.x) * (q2.y + q2.z),
+                qq - zz + (q1.z + q1.y) * (q2.w - q2.x)};
+    }
+
+    template<class F>
+    Vectors<F> rotate(Quaternions<F> const &rotation, Vectors<F> const &vector) noexcept {
+        auto const pure{Quaternions<F>{splat<F>(0.0f), vector.x, vector.y, vector.z}};
+        auto const rotated{multiply(multiply(rotation, pure), conjugated(rotation))};
+        return {rotated.x, rotated.y, rotated.z};
+    }
+
+    /// the target is negated wherever this results in the shorter path
+    template<class F>
+    Quaternions<F> shortest(Quaternions<F> const &from, Quaternions<F> const &to) noexcept {
+        auto const flip{greater(splat<F>(0.0f), dot(from, to))};
+        return choose(flip, Quaternions<F>{-to.w, -to.x, -to.y, -to.z}, to);
+    }
+
+    /// weights outside of the unit interval select one of the ends, like QQuaternion does
+    template<class F>
+    Quaternions<F> clamped(F const weight, Quaternions<F> const &from, Quaternions<F> const &to,
+                           Quaternions<F> const &between) noexcept {
+        return choose(lessEqual(weight, splat<F>(0.0f)), from,
+                      choose(greaterEqual(weight, splat<F>(1.0f)), to, between));
+    }
+
+    template<class F>
+    Quaternions<F> nlerp(Quaternions<F> const &from, Quaternions<F> const &to, F const weight) noexcept {
+        auto const target{shortest(from, to)};
+        auto const blended{sum(scaled(from, splat<F>(1.0f) - weight), scaled(target, weight))};
+        auto const normalized{scaled(blended, splat<F>(1.0f) / sqrtOf(dot(blended, blended)))};
+        return clamped(weight, from, to, normalized);
+    }
+
+    template<class F>
+    Quaternions<F> slerp(Quaternions<F> const &from, Quaternions<F> const &to, F const weight) noexcept {
+        auto const target{shortest(from, to)};
+        F fromFactor, toFactor;
+        slerpFactors(dot(from, target), weight, fromFactor, toFactor);
+        return clamped(weight, from, to, sum(scaled(from, fromFactor), scaled(target, toFactor)));
+    }
+
+    /// the cases of QQuaternion::fromRotationMatrix are all computed and then selected per lane
+    template<class F>
+    Quaternions<F> fromRotation(Rotations<F> const &m) noexcept {
+        auto const half{splat<F>(0.5f)};
+        auto const one{splat<F>(1.0f)};
+        auto const trace{m.m00 + m.m11 + m.m22};
+        auto const s{splat<F>(2.0f) * sqrtOf(trace + one)};
+        Quaternions<F> const byTrace{splat<F>(0.25f) * s,
+                                     (m.m21 - m.m12) / s, (m.m02 - m.m20) / s, (m.m10 - m.m01) / s};
+        auto const s0{sqrtOf(m.m00 - m.m11 - m.m22 + one)};
+        auto const r0{half / s0};
+        Quaternions<F> const byX{(m.m21 - m.m12) * r0, s0 * half, (m.m01 + m.m10) * r0, (m.m02 + m.m20) * r0};
+        auto const s1{sqrtOf(m.m11 - m.m22 - m.m00 + one)};
+        auto const r1{half / s1};
+        Quaternions<F> const byY{(m.m02 - m.m20) * r1, (m.m10 + m.m01) * r1, s1 * half, (m.m12 + m.m21) * r1};
+        auto const s2{sqrtOf(m.m22 - m.m00 - m.m11 + one)};
+        auto const r2{half / s2};
+        Quaternions<F> const byZ{(m.m10 - m.m01) * r2, (m.m20 + m.m02) * r2, (m.m21 + m.m12) * r2, s2 * half};
+        auto const yLargest{greater(m.m11, m.m00)};
+        auto const zLargest{greater(m.m22, choose(yLargest, m.m11, m.m00))};
+        auto const byDiagonal{choose(zLargest, byZ, choose(yLargest, byY, byX))};
+        return choose(greater(trace, splat<F>(0.00000001f)), byTrace, byDiagonal);
+    }
+
+    /// runs the vectorized kernel as far as possible and the scalar one for the remainder
+    template<class KernelT>
+    void dispatch(InstructionSet const set, KernelT const &kernel) {
+        auto index{0};
+#ifdef CUTE_VR_SIMD_SSE2
+        if (Internal::Simd::select(set) != InstructionSet::scalar) {
+            index = kernel(Tag<Lanes>{}, index);
+        }
+#else
+        Q_UNUSED(set);
+#endif
+        kernel(Tag<float>{}, index);
+    }
+}
+
+void Internal::TransformKernels::nlerp(QQuaternion const *from, QQuaternion const *to, float const *weights,
+                                       QQuaternion *result, qint32 const count, InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            P::store(::nlerp(P::quaternions(floats(from + index), 4), P::quaternions(floats(to + index), 4),
+                             P::scalars(weights + index)), floats(result + index), 4);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::slerp(QQuaternion const *from, QQuaternion const *to, float const *weights,
+                                       QQuaternion *result, qint32 const count, InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            P::store(::slerp(P::quaternions(floats(from + index), 4), P::quaternions(floats(to + index), 4),
+                             P::scalars(weights + index)), floats(result + index), 4);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::multiply(QQuaternion const *left, QQuaternion const *right, QQuaternion *result,
+                                          qint32 const count, InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            P::store(::multiply(P::quaternions(floats(left + index), 4), P::quaternions(floats(right + index), 4)),
+                     floats(result + index), 4);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::rotate(QQuaternion const *rotations, QVector3D const *vectors, QVector3D *result,
+                                        qint32 const count, InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            P::store(::rotate(P::quaternions(floats(rotations + index), 4), P::vectors(floats(vectors + index), 3)),
+                     floats(result + index), 3);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::fromMatrices(float const *matrices, QQuaternion *result, qint32 const count,
+                                              InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            P::store(fromRotation(P::rotations(matrices + index * 16)), floats(result + index), 4);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::compose(Rigid const *left, Rigid const *right, Rigid *result, qint32 const count,
+                                         InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            auto const leftRotation{P::quaternions(floats(&left[index].rotation), 8)};
+            auto const leftTranslation{P::vectors(floats(&left[index].translation), 8)};
+            auto const rightRotation{P::quaternions(floats(&right[index].rotation), 8)};
+            auto const rightTranslation{P::vectors(floats(&right[index].translation), 8)};
+            auto const moved{::rotate(leftRotation, rightTranslation)};
+            P::store(::multiply(leftRotation, rightRotation), floats(&result[index].rotation), 8);
+            P::store(sum(moved, leftTranslation), floats(&result[index].translation), 8);
+        }
+        return index;
+    });
+}
+
+void Internal::TransformKernels::invert(Rigid const *rigids, Rigid *result, qint32 const count,
+                                        InstructionSet const set) {
+    dispatch(set, [=](auto const tag, qint32 index) {
+        using P = Pack<typename decltype(tag)::Type>;
+        for (; index + P::width <= count; index += P::width) {
+            auto const inverse{conjugated(P::quaternions(floats(&rigids[index].rotation), 8))};
+            auto const moved{::rotate(inverse, P::vectors(floats(&rigids[index].translation), 8))};
+            P::store(inverse, floats(&result[index].rotation), 8);
+            P::store(negated(moved), floats(&result[index].translation), 8);
+        }
+        return index;
+    });
+}
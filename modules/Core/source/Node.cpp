@@ -0,0 +1,82 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Devices/Proxy.hpp>
+#include <CuteVR/Devices/TrackedDevice.hpp>
+#include <CuteVR/Internal/NodeFrame.hpp>
+#include <CuteVR/Node.hpp>
+#include <CuteVR/System.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
+using Configurations::parameter;
+using Internal::NodeFrame;
+
+namespace Profile = Configurations::Core::Profile;
+
+class Node::Private {
+public: // variables
+    QUdpSocket socket{};
+    QHostAddress hub{};
+    quint16 port{0};
+    quint32 sequence{0};
+    NodeFrame frame{};
+};
+
+Node::Node(Identifier const identifier, QString const &hub, quint16 const port) :
+        identifier{identifier},
+        _private{new Private} {
+    _private->hub.setAddress(hub);
+    _private->port = port != 0 ? port : static_cast<quint16>(
+            ConfigurationServer::value(parameter(Parameter::nodePort)).right(QVariant{47600}).toUInt());
+}
+
+Node::~Node() = default;
+
+quint32 Node::sequence() const noexcept {
+    return _private->sequence;
+}
+
+bool Node::publish(QMap<Identifier, QSharedPointer<Device>> const &devices,
+                   QMap<Identifier, CompactPose> const &poses) {
+    // the frame keeps the capacity of its entries between publications
+    auto &frame{_private->frame};
+    frame.node = identifier;
+    frame.sequence = _private->sequence + 1;
+    frame.entries.clear();
+    for (auto const &device : devices) {
+        if (device.isNull() || device.dynamicCast<Devices::Proxy>()) {
+            continue;
+        }
+        frame.entries.append(NodeFrame::Entry{device->identifier, device->category(), poses.value(device->identifier)});
+    }
+    auto const datagram{frame.encode()};
+    if (_private->socket.writeDatagram(datagram, _private->hub, _private->port) != datagram.size()) {
+        return false;
+    }
+    _private->sequence = frame.sequence;
+    return true;
+}
+
+bool Node::publish(System const &system) {
+    if (Profile::isEnabled<Feature::cell>()) {
+        return publish(system.devices, system.cellPoses);
+    }
+    // without cells the system has no cell poses, so the devices provide the poses of their last update instead
+    QMap<Identifier, CompactPose> poses{};
+    for (auto const &device : system.devices) {
+        if (auto const tracked = device.dynamicCast<Devices::TrackedDevice>()) {
+            poses.insert(tracked->identifier, tracked->compactPose);
+        }
+    }
+    return publish(system.devices, poses);
+}
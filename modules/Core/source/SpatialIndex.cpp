@@ -0,0 +1,381 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <QtCore/QHash>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QSet>
+
+#include <CuteVR/Internal/Intersection.hpp>
+#include <CuteVR/Interface/Volumetric.hpp>
+#include <CuteVR/SpatialIndex.hpp>
+
+using namespace CuteVR;
+using Interface::Volumetric;
+
+namespace Intersection = Internal::Intersection;
+
+namespace {
+    /// zones of a leaf are tested one after another, which is faster than descending any further
+    constexpr qint32 leafSize{4};
+    /// the depth of a hierarchy with median splits stays far below, even for billions of zones
+    constexpr qint32 stackSize{64};
+    /// refits are cheap but loosen the hierarchy, so that it is rebuilt once the surface of its root grew that much
+    constexpr float degradation{2.0f};
+
+    struct Bounds {
+        QVector3D lower{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+                        std::numeric_limits<float>::infinity()};
+        QVector3D upper{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                        -std::numeric_limits<float>::infinity()};
+
+        void extend(Bounds const &other) noexcept {
+            for (auto axis = 0; axis < 3; axis++) {
+                lower[axis] = qMin(lower[axis], other.lower[axis]);
+                upper[axis] = qMax(upper[axis], other.upper[axis]);
+            }
+        }
+
+        QVector3D center() const noexcept {
+            return (lower + upper) / 2.0f;
+        }
+
+        float area() const noexcept {
+            auto const extent{upper - lower};
+            return 2.0f * (extent.x() * extent.y() + extent.y() * extent.z() + extent.z() * extent.x());
+        }
+
+        /// distance of a point to the box, which is zero inside
+        qreal distance(QVector3D const &point) const noexcept {
+            auto squared{qreal{0}};
+            for (auto axis = 0; axis < 3; axis++) {
+                auto const outside{static_cast<qreal>(qMax(qMax(lower[axis] - point[axis], point[axis] - upper[axis]),
+                                                           0.0f))};
+                squared += outside * outside;
+            }
+            return std::sqrt(squared);
+        }
+    };
+
+    struct Zone {
+        Identifier identifier{invalidIdentifier};
+        SpatialIndex::Geometry geometry{};
+        Volumetric const *volume{nullptr};
+        QMatrix4x4 toZone{};
+        Bounds bounds{};
+    };
+
+    /// the left child of an inner node directly follows it and the right child is at first, whereas a leaf covers
+    /// the count zones from first on
+    struct Node {
+        Bounds bounds{};
+        qint32 first{0};
+        qint32 count{0};
+    };
+
+    /// a node that is still to be visited, together with the lower bound of the distance to its zones
+    struct Pending {
+        qint32 node{0};
+        qreal bound{0.0};
+    };
+
+    /// encloses the bounds of a volume after a rigid transform
+    Bounds enclose(Volumetric const *volume, QMatrix4x4 const &transform) noexcept {
+        auto const local{volume->bounds()};
+        auto const center{transform.map((local.first + local.second) / 2.0f)};
+        auto const half{(local.second - local.first) / 2.0f};
+        QVector3D extent{};
+        for (auto row = 0; row < 3; row++) {
+            extent[row] = qAbs(transform(row, 0)) * half.x() + qAbs(transform(row, 1)) * half.y() +
+                          qAbs(transform(row, 2)) * half.z();
+        }
+        return Bounds{center - extent, center + extent};
+    }
+}
+
+class SpatialIndex::Private {
+public: // methods
+    void build() {
+        leaves.clear();
+        leaves.reserve(zones.size());
+        std::copy(zones.cbegin(), zones.cend(), std::back_inserter(leaves));
+        nodes.clear();
+        nodes.reserve(leaves.size());
+        if (!leaves.isEmpty()) {
+            split(0, leaves.size());
+        }
+        leafIndices.clear();
+        for (auto index = 0; index < leaves.size(); index++) {
+            leafIndices.insert(leaves.at(index).identifier, index);
+        }
+        builtArea = nodes.isEmpty() ? 0.0f : nodes.first().bounds.area();
+    }
+
+    qint32 split(qint32 const first, qint32 const count) {
+        auto const index{nodes.size()};
+        nodes.append(Node{});
+        Bounds bounds{};
+        Bounds centers{};
+        for (auto leaf = first; leaf < first + count; leaf++) {
+            auto const center{leaves.at(leaf).bounds.center()};
+            bounds.extend(leaves.at(leaf).bounds);
+            centers.extend(Bounds{center, center});
+        }
+        if (count <= leafSize) {
+            nodes[index] = Node{bounds, first, count};
+            return index;
+        }
+        // median split along the axis in which the centers spread the most
+        auto const spread{centers.upper - centers.lower};
+        auto const axis{spread.x() >= spread.y() && spread.x() >= spread.z() ? 0 : spread.y() >= spread.z() ? 1 : 2};
+        auto const middle{first + count / 2};
+        std::nth_element(leaves.begin() + first, leaves.begin() + middle, leaves.begin() + first + count,
+                         [axis](Zone const &left, Zone const &right) {
+                             return left.bounds.center()[axis] < right.bounds.center()[axis];
+                         });
+        split(first, middle - first);
+        auto const right{split(middle, first + count - middle)};
+        nodes[index] = Node{bounds, right, 0};
+        return index;
+    }
+
+    void refit() {
+        for (auto const identifier : moved) {
+            if (leafIndices.contains(identifier)) {
+                auto &leaf{leaves[leafIndices.value(identifier)]};
+                leaf.toZone = zones.value(identifier).toZone;
+                leaf.bounds = zones.value(identifier).bounds;
+            }
+        }
+        // children are always stored behind their parent
+        for (auto index = nodes.size() - 1; index >= 0; index--) {
+            auto &node{nodes[index]};
+            Bounds bounds{};
+            if (node.count > 0) {
+                for (auto leaf = node.first; leaf < node.first + node.count; leaf++) {
+                    bounds.extend(leaves.at(leaf).bounds);
+                }
+            } else {
+                bounds = nodes.at(index + 1).bounds;
+                bounds.extend(nodes.at(node.first).bounds);
+            }
+            node.bounds = bounds;
+        }
+    }
+
+public: // variables
+    mutable QReadWriteLock lock{};
+    // the zones as they are changed, which become visible to the queries with the next update
+    QHash<Identifier, Zone> zones{};
+    QSet<Identifier> moved{};
+    bool rebuild{false};
+    // the hierarchy the queries use
+    QVector<Zone> leaves{};
+    QVector<Node> nodes{};
+    QHash<Identifier, qint32> leafIndices{};
+    float builtArea{0.0f};
+};
+
+SpatialIndex::SpatialIndex() :
+        _private{new Private} {}
+
+SpatialIndex::~SpatialIndex() = default;
+
+qint32 SpatialIndex::size() const {
+    QReadLocker locker{&_private->lock};
+    return _private->leaves.size();
+}
+
+bool SpatialIndex::insert(Identifier const zone, Geometry const &geometry, QMatrix4x4 const &transform) {
+    auto const *volume{dynamic_cast<Volumetric const *>(geometry.data())};
+    if (volume == nullptr) {
+        return false;
+    }
+    QWriteLocker locker{&_private->lock};
+    _private->zones.insert(zone, Zone{zone, geometry, volume, transform.inverted(), enclose(volume, transform)});
+    _private->moved.remove(zone);
+    _private->rebuild = true;
+    return true;
+}
+
+bool SpatialIndex::move(Identifier const zone, QMatrix4x4 const &transform) {
+    QWriteLocker locker{&_private->lock};
+    auto const iterator{_private->zones.find(zone)};
+    if (iterator == _private->zones.end()) {
+        return false;
+    }
+    iterator->toZone = transform.inverted();
+    iterator->bounds = enclose(iterator->volume, transform);
+    _private->moved.insert(zone);
+    return true;
+}
+
+bool SpatialIndex::remove(Identifier const zone) {
+    QWriteLocker locker{&_private->lock};
+    if (_private->zones.remove(zone) == 0) {
+        return false;
+    }
+    _private->moved.remove(zone);
+    _private->rebuild = true;
+    return true;
+}
+
+QVector<SpatialIndex::Hit> SpatialIndex::rayCast(QVector<Ray> const &rays, qreal const maximumDistance) const {
+    QReadLocker locker{&_private->lock};
+    QVector<Hit> hits(rays.size());
+    auto const &nodes{_private->nodes};
+    auto const &leaves{_private->leaves};
+    if (nodes.isEmpty()) {
+        return hits;
+    }
+    Pending stack[stackSize];
+    auto const enter = [&nodes](qint32 const node, Ray const &ray) {
+        auto const &bounds{nodes.at(node).bounds};
+        return Intersection::entry(Intersection::box(ray.origin, ray.direction, bounds.lower, bounds.upper));
+    };
+    for (auto index = 0; index < rays.size(); index++) {
+        auto const &ray{rays.at(index)};
+        auto &hit{hits[index]};
+        auto nearest{maximumDistance};
+        auto depth{0};
+        stack[depth++] = Pending{0, enter(0, ray)};
+        while (depth > 0) {
+            auto const pending{stack[--depth]};
+            if (!(pending.bound < nearest)) {
+                continue;
+            }
+            auto const &node{nodes.at(pending.node)};
+            if (node.count > 0) {
+                for (auto leaf = node.first; leaf < node.first + node.count; leaf++) {
+                    auto const &zone{leaves.at(leaf)};
+                    // rigid transforms keep the distances along the ray
+                    auto const distance{zone.volume->intersect(zone.toZone.map(ray.origin),
+                                                               zone.toZone.mapVector(ray.direction))};
+                    if (distance < nearest) {
+                        nearest = distance;
+                        hit = Hit{zone.identifier, distance};
+                    }
+                }
+                continue;
+            }
+            // the nearer child is visited first, since it is likely to shorten the ray for the other
+            Pending left{pending.node + 1, enter(pending.node + 1, ray)};
+            Pending right{node.first, enter(node.first, ray)};
+            if (left.bound < right.bound) {
+                std::swap(left, right);
+            }
+            stack[depth++] = left;
+            stack[depth++] = right;
+        }
+    }
+    return hits;
+}
+
+QVector<SpatialIndex::Hit> SpatialIndex::nearest(QVector<QVector3D> const &points, qreal const maximumDistance) const {
+    QReadLocker locker{&_private->lock};
+    QVector<Hit> hits(points.size());
+    auto const &nodes{_private->nodes};
+    auto const &leaves{_private->leaves};
+    if (nodes.isEmpty()) {
+        return hits;
+    }
+    Pending stack[stackSize];
+    for (auto index = 0; index < points.size(); index++) {
+        auto const &point{points.at(index)};
+        auto &hit{hits[index]};
+        auto nearest{maximumDistance};
+        auto depth{0};
+        stack[depth++] = Pending{0, nodes.first().bounds.distance(point)};
+        while (depth > 0) {
+            auto const pending{stack[--depth]};
+            // zones whose box contains the point may still be nearer, since the distances inside are negative
+            if (!(pending.bound < nearest || pending.bound <= qreal{0})) {
+                continue;
+            }
+            auto const &node{nodes.at(pending.node)};
+            if (node.count > 0) {
+                for (auto leaf = node.first; leaf < node.first + node.count; leaf++) {
+                    auto const &zone{leaves.at(leaf)};
+                    auto const distance{zone.volume->distance(zone.toZone.map(point))};
+                    if (distance < nearest) {
+                        nearest = distance;
+                        hit = Hit{zone.identifier, distance};
+                    }
+                }
+                continue;
+            }
+            Pending left{pending.node + 1, nodes.at(pending.node + 1).bounds.distance(point)};
+            Pending right{node.first, nodes.at(node.first).bounds.distance(point)};
+            if (left.bound < right.bound) {
+                std::swap(left, right);
+            }
+            stack[depth++] = left;
+            stack[depth++] = right;
+        }
+    }
+    return hits;
+}
+
+QVector<QList<Identifier>> SpatialIndex::overlap(QVector<QVector3D> const &points, qreal const radius) const {
+    QReadLocker locker{&_private->lock};
+    QVector<QList<Identifier>> overlaps(points.size());
+    auto const &nodes{_private->nodes};
+    auto const &leaves{_private->leaves};
+    if (nodes.isEmpty()) {
+        return overlaps;
+    }
+    qint32 stack[stackSize];
+    for (auto index = 0; index < points.size(); index++) {
+        auto const &point{points.at(index)};
+        auto &zones{overlaps[index]};
+        auto depth{0};
+        stack[depth++] = 0;
+        while (depth > 0) {
+            auto const current{stack[--depth]};
+            auto const &node{nodes.at(current)};
+            if (node.bounds.distance(point) > radius) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (auto leaf = node.first; leaf < node.first + node.count; leaf++) {
+                    auto const &zone{leaves.at(leaf)};
+                    if (zone.volume->distance(zone.toZone.map(point)) <= radius) {
+                        zones.append(zone.identifier);
+                    }
+                }
+                continue;
+            }
+            stack[depth++] = node.first;
+            stack[depth++] = current + 1;
+        }
+        std::sort(zones.begin(), zones.end());
+    }
+    return overlaps;
+}
+
+SpatialIndex::Ray SpatialIndex::ray(Components::CompactPose const &pose) noexcept {
+    return Ray{pose.position, pose.orientation.rotatedVector(QVector3D{0.0f, 0.0f, -1.0f})};
+}
+
+void SpatialIndex::update() {
+    QWriteLocker locker{&_private->lock};
+    if (_private->rebuild) {
+        _private->build();
+    } else if (!_private->moved.isEmpty()) {
+        _private->refit();
+        if (_private->nodes.first().bounds.area() > degradation * _private->builtArea) {
+            _private->build();
+        }
+    }
+    _private->moved.clear();
+    _private->rebuild = false;
+}
+
+bool SpatialIndex::isCurrent() const noexcept {
+    QReadLocker locker{&_private->lock};
+    return !_private->rebuild && _private->moved.isEmpty();
+}
@@ -8,13 +8,28 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <functional>
+#include <mutex>
 #include <openvr.h>
 #include <QtConcurrent/QtConcurrent>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QReadWriteLock>
+#include <QtCore/QThread>
 #include <QtCore/QVector>
+#include <QtCore/QWaitCondition>
 
 #include <CuteVR/Components/Geometry/Cube.hpp>
 #include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Configurations/CoreProfile.hpp>
+#include <CuteVR/Devices/Proxy.hpp>
+#include <CuteVR/Internal/BoundaryMonitor.hpp>
+#include <CuteVR/Internal/DefaultBoundaryProvider.hpp>
+#include <CuteVR/Internal/EquipmentAssigner.hpp>
+#include <CuteVR/Internal/GlobalPoseStage.hpp>
+#include <CuteVR/Internal/NodeHub.hpp>
 #include <CuteVR/Internal/Property.hpp>
 #include <CuteVR/Interface/EventHandler.hpp>
 #include <CuteVR/Interface/TrackingHandler.hpp>
@@ -23,9 +38,20 @@
 
 using namespace CuteVR;
 using Configurations::Core::Feature;
-using Configurations::feature;
+using Configurations::Core::Parameter;
+using Configurations::parameter;
+using Devices::Proxy;
 using Extension::Optional;
 using Extension::Trilean;
+using Internal::BoundaryMonitor;
+using Internal::DefaultBoundaryProvider;
+using Internal::EquipmentAssigner;
+using Internal::GlobalPoseStage;
+using Internal::NodeFrame;
+using Internal::NodeHub;
+using Internal::Property::load;
+
+namespace Profile = Configurations::Core::Profile;
 
 namespace {
     struct RegisterMetaTypes {
@@ -36,8 +62,24 @@ namespace {
             qRegisterMetaType<QMap<Identifier, System::Equipment>>();
             qRegisterMetaType<System::Cell>();
             qRegisterMetaType<QMap<Identifier, System::Cell>>();
+            qRegisterMetaType<System::Delta>();
+            qRegisterMetaType<QMap<Identifier, Components::CompactPose>>();
+            qRegisterMetaType<QMap<Identifier, qreal>>();
+            qRegisterMetaType<System::BoundaryState>();
         }
     } registerMetaTypes; // NOLINT
+
+    /// the geometry tag has no comparison of its own, but every implemented geometry is a component
+    bool equals(CategorizedComponent<Component::Category::geometry> const *left,
+                CategorizedComponent<Component::Category::geometry> const *right) {
+        if (left == nullptr || right == nullptr) {
+            return left == right;
+        }
+        auto const *leftComponent{dynamic_cast<Component const *>(left)};
+        auto const *rightComponent{dynamic_cast<Component const *>(right)};
+        return leftComponent != nullptr && rightComponent != nullptr ? leftComponent->equals(*rightComponent)
+                                                                     : left == right;
+    }
 }
 
 namespace CuteVR {
@@ -57,7 +99,8 @@ namespace CuteVR {
                (left.trackingReferences == right.trackingReferences) &&
                (left.trackers == right.trackers) &&
                (left.equipments == right.equipments) &&
-               // FIXME: no == operator for category (left.boundary == right.boundary) &&
+               (left.boundary.first == right.boundary.first) &&
+               equals(left.boundary.second.data(), right.boundary.second.data()) &&
                (left.globalTransform == right.globalTransform);
     }
 
@@ -132,9 +175,58 @@ public: // types
         }
     };
 
-public: // constructor
+    /// @brief Collects what changed during a transaction, so that it can be published at once.
+    struct Changes {
+        QList<Identifier> devices{};
+        QSet<Identifier> equipments{};
+        QSet<Identifier> cells{};
+    };
+
+    /// @brief Identifies a parked device by the serial number of its hardware and the slot it was connected to.
+    using PoolKey = QPair<QString, Identifier>;
+
+    /// @brief Sleeps until hotplugs are pending, then flushes all that arrive within the hotplug window at once.
+    class HotplugThread final :
+            public QThread {
+    public: // constructor
+        explicit HotplugThread(Private *system) :
+                system{system} {}
+
+    protected: // methods
+        void run() override {
+            QMutexLocker locker{&system->pendingLock};
+            while (!system->stopping) {
+                if (system->pending.isEmpty()) {
+                    system->pendingCondition.wait(&system->pendingLock);
+                    continue;
+                }
+                // the window starts with the first hotplug of a burst, stopping cuts it short
+                auto const window{static_cast<qint64>(ConfigurationServer::value(parameter(Parameter::hotplugWindow))
+                                                              .right(QVariant{50}).toUInt())};
+                QElapsedTimer clock{};
+                clock.start();
+                while (!system->stopping && clock.elapsed() < window) {
+                    system->pendingCondition.wait(&system->pendingLock,
+                                                  static_cast<unsigned long>(window - clock.elapsed()));
+                }
+                locker.unlock();
+                system->flushHotplugs();
+                locker.relock();
+            }
+        }
+
+    private: // variables
+        Private *system{nullptr};
+    };
+
+public: // constructor/destructor
     explicit Private(System *that) :
-            that{that} {
+            that{that},
+            hotplugThread{this} {
+    }
+
+    ~Private() {
+        stopHotplugs();
     }
 
 public: // methods
@@ -142,111 +234,680 @@ public: // methods
         // TODO: move device query from initialize to here
     }
 
-    void handleDeviceActivated(Identifier const identifier) {
-        // FIXME: move cell and equipment changes to own functions, be more dry
-        QWriteLocker{&updateLock};
-        auto either{DeviceServer::create(identifier)};
-        if (either.isRight()) {
-            auto device{either.right()};
-            device->initialize();
-            device->update();
-            devicesCurrent.insert(device->identifier, device);
-            emit that->devicesChanged(devicesCurrent);
-            emit that->deviceChanged(device->identifier, device);
-            if (ConfigurationServer::isEnabled(feature(Feature::cell)).right(false)) {
-                if (cellsCurrent.empty()) {
-                    cellsCurrent.insert(0, {});
-                    emit that->cellsChanged(cellsCurrent);
-                    emit that->cellChanged(0, cellsCurrent.value(0));
+    static Device::Category categoryOf(vr::ETrackedDeviceClass const deviceClass) noexcept {
+        switch (deviceClass) {
+            case vr::TrackedDeviceClass_HMD: return Device::Category::headMountedDisplay;
+            case vr::TrackedDeviceClass_Controller: return Device::Category::controller;
+            case vr::TrackedDeviceClass_TrackingReference: return Device::Category::trackingReference;
+            case vr::TrackedDeviceClass_GenericTracker: return Device::Category::tracker;
+            default: return Device::Category::undefined;
+        }
+    }
+
+    QSharedPointer<Device> createDevice(Identifier const identifier) {
+        QString serial{};
+        QSharedPointer<Device> device{};
+        if (Profile::isEnabled<Feature::devicePool>()) {
+            auto category{Device::Category::undefined};
+            DriverServer::synchronized([&] {
+                serial = load<QString>(identifier, vr::Prop_SerialNumber_String);
+                category = categoryOf(vr::VRSystem()->GetTrackedDeviceClass(identifier));
+            }, Trilean::yes);
+            device = reviveDevice(identifier, serial, category);
+        }
+        if (!device) {
+            auto either{DeviceServer::create(identifier)};
+            if (!either.isRight()) {
+                return {};
+            }
+            device = either.right();
+        }
+        device->initialize();
+        device->update();
+        if (!serial.isEmpty()) {
+            QMutexLocker locker{&poolLock};
+            serials.insert(identifier, serial);
+        }
+        return device;
+    }
+
+    QSharedPointer<Device> reviveDevice(Identifier const identifier, QString const &serial,
+                                        Device::Category const category) {
+        if (serial.isEmpty() || category == Device::Category::undefined) {
+            return {};
+        }
+        QMutexLocker locker{&poolLock};
+        PoolKey const key{serial, identifier};
+        auto device{pool.take(key)};
+        poolOrder.removeOne(key);
+        // the same hardware in the same slot is only revived as long as it still describes the same kind of device
+        if (!device || device->category() != category) {
+            return {};
+        }
+        // the system may have been moved to another thread while the device was parked
+        if (device->thread() != that->thread()) {
+            device->moveToThread(that->thread());
+        }
+        return device;
+    }
+
+    void parkDevice(QSharedPointer<Device> const &device) {
+        QMutexLocker locker{&poolLock};
+        auto const serial{serials.take(device->identifier)};
+        if (serial.isEmpty() || !Profile::isEnabled<Feature::devicePool>()) {
+            return;
+        }
+        auto const depth{ConfigurationServer::value(parameter(Parameter::devicePoolDepth))
+                                 .right(QVariant{16}).toInt()};
+        PoolKey const key{serial, device->identifier};
+        poolOrder.removeOne(key);
+        pool.insert(key, device);
+        poolOrder.append(key);
+        while (poolOrder.size() > depth) {
+            pool.remove(poolOrder.takeFirst());
+        }
+    }
+
+    void clearPool() {
+        QMutexLocker locker{&poolLock};
+        pool.clear();
+        poolOrder.clear();
+        serials.clear();
+    }
+
+    void insertDevice(QSharedPointer<Device> const &device, Changes &changes) {
+        // FIXME: move cell and equipment changes to own functions
+        devicesCurrent.insert(device->identifier, device);
+        if (!changes.devices.contains(device->identifier)) {
+            changes.devices.append(device->identifier);
+        }
+        if (Profile::isEnabled<Feature::cell>()) {
+            if (cellsCurrent.empty()) {
+                cellsCurrent.insert(0, {});
+                cellsCurrent[0].boundary = boundaryCurrent;
+                cellsCurrent[0].globalTransform = globalTransforms.value(0);
+                changes.cells.insert(0);
+            }
+            switch (device->category()) {
+                case Device::Category::trackingReference: {
+                    cellsCurrent[0].trackingReferences.insert(device->identifier);
+                    changes.cells.insert(0);
+                    break;
                 }
-                switch (device->category()) {
-                    case Device::Category::trackingReference: {
-                        cellsCurrent[0].trackingReferences.insert(device->identifier);
-                        emit that->cellsChanged(cellsCurrent);
-                        emit that->cellChanged(0, cellsCurrent.value(0));
-                        break;
-                    }
-                    case Device::Category::tracker: {
-                        cellsCurrent[0].trackers.insert(device->identifier);
-                        emit that->cellsChanged(cellsCurrent);
-                        emit that->cellChanged(0, cellsCurrent.value(0));
-                        break;
-                    }
-                    default: break;
+                case Device::Category::tracker: {
+                    cellsCurrent[0].trackers.insert(device->identifier);
+                    changes.cells.insert(0);
+                    break;
                 }
+                default: break;
             }
+        }
 
-            if (ConfigurationServer::isEnabled(feature(Feature::equipment)).right(false)) {
-                if (equipmentsCurrent.empty()) {
-                    equipmentsCurrent.insert(0, {});
-                    if (cellsCurrent.contains(0)) {
-                        cellsCurrent[0].equipments.insert(0);
-                        emit that->cellsChanged(cellsCurrent);
-                        emit that->cellChanged(0, cellsCurrent.value(0));
-                    }
-                    emit that->equipmentsChanged(equipmentsCurrent);
-                    emit that->equipmentChanged(0, equipmentsCurrent.value(0));
+        if (Profile::isEnabled<Feature::equipment>()) {
+            // with multiple equipments every further head-mounted display opens an equipment of its own, while all
+            // other devices join the first one until the controllers are assigned to their users during the update
+            Identifier target{0};
+            if (device->category() == Device::Category::headMountedDisplay &&
+                Profile::isEnabled<Feature::multiEquipment>() && equipmentsCurrent.contains(0) &&
+                !equipmentsCurrent[0].headMountedDisplays.empty()) {
+                target = 1;
+                while (equipmentsCurrent.contains(target)) {
+                    target++;
                 }
-                switch (device->category()) {
-                    case Device::Category::headMountedDisplay: {
-                        equipmentsCurrent[0].headMountedDisplays.insert(device->identifier);
-                        emit that->equipmentsChanged(equipmentsCurrent);
-                        emit that->equipmentChanged(0, equipmentsCurrent.value(0));
-                        break;
-                    }
-                    case Device::Category::headMountedAudio: {
-                        equipmentsCurrent[0].headMountedAudios.insert(device->identifier);
-                        emit that->equipmentsChanged(equipmentsCurrent);
-                        emit that->equipmentChanged(0, equipmentsCurrent.value(0));
-                        break;
-                    }
-                    case Device::Category::controller: {
-                        equipmentsCurrent[0].controllers.insert(device->identifier);
-                        emit that->equipmentsChanged(equipmentsCurrent);
-                        emit that->equipmentChanged(0, equipmentsCurrent.value(0));
-                        break;
-                    }
-                    default: break;
+            }
+            if (!equipmentsCurrent.contains(target)) {
+                equipmentsCurrent.insert(target, Equipment{target, {}, {}, {}});
+                changes.equipments.insert(target);
+                if (cellsCurrent.contains(0)) {
+                    cellsCurrent[0].equipments.insert(target);
+                    changes.cells.insert(0);
                 }
             }
-            current = false;
+            switch (device->category()) {
+                case Device::Category::headMountedDisplay: {
+                    equipmentsCurrent[target].headMountedDisplays.insert(device->identifier);
+                    changes.equipments.insert(target);
+                    break;
+                }
+                case Device::Category::headMountedAudio: {
+                    equipmentsCurrent[target].headMountedAudios.insert(device->identifier);
+                    changes.equipments.insert(target);
+                    break;
+                }
+                case Device::Category::controller: {
+                    equipmentsCurrent[target].controllers.insert(device->identifier);
+                    changes.equipments.insert(target);
+                    break;
+                }
+                default: break;
+            }
         }
+        current = false;
     }
 
-    void handleDeviceDeactivated(Identifier const identifier) {
-        QWriteLocker{&updateLock};
+    void removeDevice(Identifier const identifier, Changes &changes) {
         if (devicesCurrent.contains(identifier)) {
-            devicesCurrent[identifier]->destroy();
-            devicesCurrent.remove(identifier);
-            emit that->devicesChanged(devicesCurrent);
-            emit that->deviceChanged(identifier, QSharedPointer<Device>{nullptr});
+            auto const device{devicesCurrent.take(identifier)};
+            // a destroyed device has released its providers, thus it can wait in the pool for its reconnect
+            device->destroy();
+            parkDevice(device);
+            changes.devices.append(identifier);
+            current = false;
         }
         if (cellsCurrent.contains(0)) {
-            cellsCurrent[0].trackers.remove(identifier);
-            cellsCurrent[0].trackingReferences.remove(identifier);
+            auto &cell{cellsCurrent[0]};
+            auto removed{cell.trackers.remove(identifier)};
+            removed = cell.trackingReferences.remove(identifier) || removed;
+            if (removed) {
+                changes.cells.insert(0);
+                current = false;
+            }
+        }
+        QList<Equipment> dissolved{};
+        for (auto equipment = equipmentsCurrent.begin(); equipment != equipmentsCurrent.end();) {
+            auto removed{equipment->controllers.remove(identifier)};
+            removed = equipment->headMountedDisplays.remove(identifier) || removed;
+            removed = equipment->headMountedAudios.remove(identifier) || removed;
+            if (removed) {
+                changes.equipments.insert(equipment.key());
+                current = false;
+            }
+            // an additional equipment ends with its head-mounted display
+            if (removed && equipment.key() != 0 && equipment->headMountedDisplays.empty()) {
+                dissolved.append(equipment.value());
+                equipment = equipmentsCurrent.erase(equipment);
+            } else {
+                ++equipment;
+            }
+        }
+        for (auto const &equipment : dissolved) {
+            // the remaining devices fall back to the first equipment until they are assigned again
+            equipmentsCurrent[0].headMountedAudios += equipment.headMountedAudios;
+            equipmentsCurrent[0].controllers += equipment.controllers;
+            changes.equipments.insert(0);
+            if (cellsCurrent.contains(0)) {
+                cellsCurrent[0].equipments.remove(equipment.identifier);
+                changes.cells.insert(0);
+            }
+        }
+        equipmentAssigner.remove(identifier);
+    }
+
+    /// The equipment that contains a head-mounted display, invalid if there is none.
+    Identifier equipmentOf(Identifier const headMountedDisplay) const {
+        for (auto equipment = equipmentsCurrent.cbegin(); equipment != equipmentsCurrent.cend(); ++equipment) {
+            if (equipment->headMountedDisplays.contains(headMountedDisplay)) {
+                return equipment.key();
+            }
+        }
+        return invalidIdentifier;
+    }
+
+    /// Runs the given transaction unless another one is in progress, which the update never waits for: a hotplug
+    /// transaction may wait for the driver while constructing devices. Returns `false` if the transaction is skipped.
+    bool tryTransaction(std::function<void()> const &transaction) {
+        if (!transactionLock.tryLock()) {
+            return false;
+        }
+        std::unique_lock<QMutex> locker{transactionLock, std::adopt_lock};
+        transaction();
+        return true;
+    }
+
+    /// Moves the controllers to the equipments of the users that hold them, only real moves are signaled.
+    void assignEquipments(quint64 const frame, QMap<Identifier, Components::CompactPose> const &poses) {
+        // a skipped frame keeps the current assignment
+        tryTransaction([&] { reassignControllers(frame, poses); });
+    }
+
+    void reassignControllers(quint64 const frame, QMap<Identifier, Components::CompactPose> const &poses) {
+        QMap<Identifier, Components::CompactPose> headMountedDisplays{};
+        QMap<Identifier, Components::CompactPose> controllers{};
+        for (auto equipment = equipmentsCurrent.cbegin(); equipment != equipmentsCurrent.cend(); ++equipment) {
+            // the devices of a node are tracked in a cell of their own, thus they are never mixed with local ones
+            if (nodeDevices.contains(equipment.key() >> 16u)) {
+                continue;
+            }
+            for (auto const device : equipment->headMountedDisplays) {
+                headMountedDisplays.insert(device, poses.value(device));
+            }
+            for (auto const device : equipment->controllers) {
+                controllers.insert(device, poses.value(device));
+            }
+        }
+        EquipmentAssigner::Tuning tuning{};
+        tuning.window = ConfigurationServer::value(parameter(Parameter::equipmentWindow))
+                .right(QVariant{tuning.window}).toInt();
+        tuning.hysteresis = ConfigurationServer::value(parameter(Parameter::equipmentHysteresis))
+                .right(QVariant{tuning.hysteresis}).toDouble();
+        tuning.persistence = ConfigurationServer::value(parameter(Parameter::equipmentPersistence))
+                .right(QVariant{tuning.persistence}).toInt();
+        auto const reassignments{equipmentAssigner.assign(frame, headMountedDisplays, controllers, tuning)};
+        if (reassignments.empty()) {
+            return;
+        }
+
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        for (auto const &reassignment : reassignments) {
+            auto const target{equipmentOf(reassignment.headMountedDisplay)};
+            if (target == invalidIdentifier ||
+                equipmentsCurrent.value(target).controllers.contains(reassignment.controller)) {
+                continue;
+            }
+            for (auto equipment = equipmentsCurrent.begin(); equipment != equipmentsCurrent.end(); ++equipment) {
+                if (equipment->controllers.remove(reassignment.controller)) {
+                    changes.equipments.insert(equipment.key());
+                }
+            }
+            equipmentsCurrent[target].controllers.insert(reassignment.controller);
+            changes.equipments.insert(target);
+        }
+        // the moves belong to the current frame, thus they are handed over without waiting for the next update
+        for (auto const identifier : changes.equipments) {
+            that->equipments.insert(identifier, equipmentsCurrent.value(identifier));
+        }
+        publish(changes);
+    }
+
+    /// The equipment that contains the head-mounted displays and controllers of a node.
+    static constexpr Identifier nodeEquipment(Identifier const node) noexcept {
+        return Proxy::identifierOf(node, 0);
+    }
+
+    void insertProxy(QSharedPointer<Proxy> const &proxy, Changes &changes) {
+        devicesCurrent.insert(proxy->identifier, proxy);
+        changes.devices.append(proxy->identifier);
+        auto &cell{cellsCurrent[proxy->node]};
+        auto &equipment{equipmentsCurrent[nodeEquipment(proxy->node)]};
+        switch (proxy->category()) {
+            case Device::Category::trackingReference: {
+                cell.trackingReferences.insert(proxy->identifier);
+                changes.cells.insert(proxy->node);
+                break;
+            }
+            case Device::Category::tracker: {
+                cell.trackers.insert(proxy->identifier);
+                changes.cells.insert(proxy->node);
+                break;
+            }
+            case Device::Category::headMountedDisplay: {
+                equipment.headMountedDisplays.insert(proxy->identifier);
+                changes.equipments.insert(equipment.identifier);
+                break;
+            }
+            case Device::Category::headMountedAudio: {
+                equipment.headMountedAudios.insert(proxy->identifier);
+                changes.equipments.insert(equipment.identifier);
+                break;
+            }
+            case Device::Category::controller: {
+                equipment.controllers.insert(proxy->identifier);
+                changes.equipments.insert(equipment.identifier);
+                break;
+            }
+            default: break;
+        }
+        current = false;
+    }
+
+    void removeProxy(Identifier const node, Identifier const identifier, Changes &changes) {
+        auto const device{devicesCurrent.take(identifier)};
+        if (device) {
+            device->destroy();
+        }
+        changes.devices.append(identifier);
+        if (cellsCurrent.contains(node)) {
+            auto &cell{cellsCurrent[node]};
+            auto removed{cell.trackers.remove(identifier)};
+            removed = cell.trackingReferences.remove(identifier) || removed;
+            if (removed) {
+                changes.cells.insert(node);
+            }
+        }
+        if (equipmentsCurrent.contains(nodeEquipment(node))) {
+            auto &equipment{equipmentsCurrent[nodeEquipment(node)]};
+            auto removed{equipment.controllers.remove(identifier)};
+            removed = equipment.headMountedDisplays.remove(identifier) || removed;
+            removed = equipment.headMountedAudios.remove(identifier) || removed;
+            if (removed) {
+                changes.equipments.insert(equipment.identifier);
+            }
+        }
+        current = false;
+    }
+
+    void removeNode(Identifier const node, Changes &changes, Delta &delta) {
+        for (auto const identifier : nodeDevices.take(node)) {
+            removeProxy(node, identifier, changes);
+            delta.removed.append(identifier);
+        }
+        cellsCurrent.remove(node);
+        equipmentsCurrent.remove(nodeEquipment(node));
+        changes.cells.insert(node);
+        changes.equipments.insert(nodeEquipment(node));
+        remotePoses.remove(node);
+        current = false;
+    }
+
+    /// Mirrors the newest frame of every node as a cell of its own, whose devices are proxies.
+    void aggregateNodes(NodeHub &hub) {
+        auto const now{QDateTime::currentMSecsSinceEpoch()};
+        auto const timeout{ConfigurationServer::value(parameter(Parameter::nodeTimeout))
+                                   .right(QVariant{500}).toLongLong()};
+        // nodes are never waited for, a slow node simply keeps its last frame until it expires
+        hub.receive(now);
+        hub.expire(now, timeout);
+        // while skipped, the nodes keep their last frame and the hub hands over the newest one with the next update
+        tryTransaction([&] { mirrorNodes(hub.frames()); });
+    }
+
+    void mirrorNodes(QMap<Identifier, NodeFrame> const &frames) {
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        Delta delta{};
+        for (auto const node : nodeDevices.keys()) {
+            if (!frames.contains(node)) {
+                removeNode(node, changes, delta);
+            }
+        }
+        for (auto const &frame : frames) {
+            if (!cellsCurrent.contains(frame.node)) {
+                auto const equipment{nodeEquipment(frame.node)};
+                cellsCurrent.insert(frame.node, Cell{frame.node, {}, {}, {equipment}, {},
+                                                     globalTransforms.value(frame.node)});
+                equipmentsCurrent.insert(equipment, Equipment{equipment, {}, {}, {}});
+                changes.cells.insert(frame.node);
+                changes.equipments.insert(equipment);
+                current = false;
+            }
+            auto &devices{nodeDevices[frame.node]};
+            auto &poses{remotePoses[frame.node]};
+            QSet<Identifier> published{};
+            poses.clear();
+            for (auto const &entry : frame.entries) {
+                auto const identifier{Proxy::identifierOf(frame.node, entry.device)};
+                auto proxy{devicesCurrent.value(identifier).dynamicCast<Proxy>()};
+                // a slot of a node that is taken by another kind of device is a new device
+                if (proxy && proxy->category() != entry.category) {
+                    removeProxy(frame.node, identifier, changes);
+                    delta.removed.append(identifier);
+                    proxy.clear();
+                }
+                if (!proxy) {
+                    proxy.reset(new Proxy{entry.category, frame.node, entry.device});
+                    proxy->moveToThread(that->thread());
+                    proxy->initialize();
+                    insertProxy(proxy, changes);
+                    delta.added.append(identifier);
+                }
+                proxy->receive(entry.pose);
+                published.insert(identifier);
+                poses.insert(identifier, entry.pose);
+            }
+            for (auto const identifier : devices - published) {
+                removeProxy(frame.node, identifier, changes);
+                delta.removed.append(identifier);
+            }
+            devices = published;
+        }
+        publish(changes);
+        if (!delta.added.empty() || !delta.removed.empty()) {
+            emit that->devicesHotplugged(delta);
+        }
+    }
+
+    void dropNodes() {
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        Delta delta{};
+        for (auto const node : nodeDevices.keys()) {
+            removeNode(node, changes, delta);
+        }
+        publish(changes);
+        if (!delta.removed.empty()) {
+            emit that->devicesHotplugged(delta);
+        }
+    }
+
+    /// Adds the poses of the proxies, which reach global coordinates by the global transform of the cell of their node.
+    void mergeRemotePoses() {
+        for (auto node = remotePoses.cbegin(); node != remotePoses.cend(); ++node) {
+            auto const count{node->size()};
+            remoteTransforms.fill(GlobalPoseStage::rigid(that->cells.value(node.key()).globalTransform), count);
+            remoteGlobalPoses.resize(count);
+            auto global{remoteGlobalPoses.begin()};
+            for (auto pose = node->cbegin(); pose != node->cend(); ++pose, ++global) {
+                that->cellPoses.insert(pose.key(), pose.value());
+                *global = pose.value();
+            }
+            GlobalPoseStage::apply(remoteTransforms.constData(), remoteGlobalPoses.constData(),
+                                   remoteGlobalPoses.data(), count);
+            global = remoteGlobalPoses.begin();
+            for (auto pose = node->cbegin(); pose != node->cend(); ++pose, ++global) {
+                that->globalPoses.insert(pose.key(), *global);
+            }
+        }
+    }
+
+    /// The published cell that surrounds a device, only the proxies of a node are outside of the local cell.
+    Identifier cellOf(Identifier const device) const {
+        auto const proxy{that->devices.value(device).dynamicCast<Proxy>()};
+        return proxy ? proxy->node : Identifier{0};
+    }
+
+    /// The global transform of the surrounding cell by device, for all devices that are inside of a cell.
+    QHash<Identifier, QMatrix4x4> cellTransforms() const {
+        QHash<Identifier, QMatrix4x4> transforms{};
+        for (auto const &cell : cellsCurrent) {
+            for (auto const device : cell.trackingReferences + cell.trackers) {
+                transforms.insert(device, cell.globalTransform);
+            }
+            for (auto const identifier : cell.equipments) {
+                auto const equipment{equipmentsCurrent.value(identifier)};
+                for (auto const device : equipment.headMountedDisplays + equipment.headMountedAudios +
+                                         equipment.controllers) {
+                    transforms.insert(device, cell.globalTransform);
+                }
+            }
+        }
+        return transforms;
+    }
+
+    void publish(Changes const &changes) {
+        if (!changes.devices.empty()) {
+            emit that->devicesChanged(devicesCurrent);
+            for (auto const identifier : changes.devices) {
+                emit that->deviceChanged(identifier, devicesCurrent.value(identifier));
+            }
+        }
+        if (!changes.cells.empty()) {
             emit that->cellsChanged(cellsCurrent);
-            emit that->cellChanged(0, cellsCurrent.value(0));
+            for (auto const identifier : changes.cells) {
+                emit that->cellChanged(identifier, cellsCurrent.value(identifier));
+            }
         }
-        if (equipmentsCurrent.contains(0)) {
-            equipmentsCurrent[0].controllers.remove(identifier);
-            equipmentsCurrent[0].headMountedDisplays.remove(identifier);
-            equipmentsCurrent[0].headMountedAudios.remove(identifier);
+        if (!changes.equipments.empty()) {
             emit that->equipmentsChanged(equipmentsCurrent);
-            emit that->equipmentChanged(0, equipmentsCurrent.value(0));
+            for (auto const identifier : changes.equipments) {
+                emit that->equipmentChanged(identifier, equipmentsCurrent.value(identifier));
+            }
         }
     }
 
+    QList<QSharedPointer<Device>> constructDevices(QList<Identifier> const &identifiers) {
+        DeviceServer::prefetch(identifiers);
+        // devices mostly wait for the driver during their construction, hence they are constructed in parallel and
+        // handed over to the thread of the system afterwards
+        auto *const target{that->thread()};
+        QList<QFuture<QSharedPointer<Device>>> futures{};
+        for (auto const identifier : identifiers) {
+            futures.append(QtConcurrent::run([this, identifier, target] {
+                auto device{createDevice(identifier)};
+                if (device && device->thread() != target) {
+                    device->moveToThread(target);
+                }
+                return device;
+            }));
+        }
+        QList<QSharedPointer<Device>> devices{};
+        for (auto &future : futures) {
+            auto const device{future.result()};
+            if (device) {
+                devices.append(device);
+            }
+        }
+        return devices;
+    }
+
+    void applyTransaction(QList<Identifier> const &removals, QList<Identifier> const &additions) {
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        Delta delta{};
+        // removals go first, so that a device being reactivated is destroyed before it is created or revived again
+        for (auto const identifier : removals) {
+            removeDevice(identifier, changes);
+            delta.removed.append(identifier);
+        }
+        for (auto const &device : constructDevices(additions)) {
+            insertDevice(device, changes);
+            delta.added.append(device->identifier);
+        }
+        publish(changes);
+        if (!delta.added.empty() || !delta.removed.empty()) {
+            emit that->devicesHotplugged(delta);
+        }
+    }
+
+    void applyBoundary(Cell::Boundary const &boundary) {
+        QMutexLocker transactionLocker{&transactionLock};
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        // the default cell is created with the first device, which then takes over the boundary
+        boundaryCurrent = boundary;
+        if (cellsCurrent.contains(0)) {
+            cellsCurrent[0].boundary = boundary;
+            changes.cells.insert(0);
+            current = false;
+        }
+        publish(changes);
+    }
+
+    void applyGlobalTransform(Identifier const cell, QMatrix4x4 const &transform) {
+        QMutexLocker transactionLocker{&transactionLock};
+        QWriteLocker locker{&updateLock};
+        Changes changes{};
+        // cells that do not exist yet take over their transform once they are created
+        globalTransforms.insert(cell, transform);
+        if (cellsCurrent.contains(cell)) {
+            cellsCurrent[cell].globalTransform = transform;
+            changes.cells.insert(cell);
+            current = false;
+        }
+        publish(changes);
+    }
+
+    /// The devices of a cell that move around and are thus evaluated against its boundary.
+    QSet<Identifier> boundedDevices(Cell const &cell) const {
+        auto devices{cell.trackers};
+        for (auto const identifier : cell.equipments) {
+            auto const equipment{that->equipments.value(identifier)};
+            devices += equipment.headMountedDisplays + equipment.headMountedAudios + equipment.controllers;
+        }
+        return devices;
+    }
+
+    void enqueueHotplug(Identifier const identifier, bool const activated) {
+        QMutexLocker locker{&pendingLock};
+        pending.append(qMakePair(identifier, activated));
+        if (!hotplugThread.isRunning()) {
+            hotplugThread.start();
+        }
+        pendingCondition.wakeOne();
+    }
+
+    /// Flushes the pending hotplugs and waits until the hotplug thread has finished.
+    void stopHotplugs() {
+        {
+            QMutexLocker locker{&pendingLock};
+            stopping = true;
+            pendingCondition.wakeOne();
+        }
+        hotplugThread.wait();
+        QMutexLocker locker{&pendingLock};
+        stopping = false;
+    }
+
+    void flushHotplugs() {
+        // transactions must not overtake each other, otherwise the order of events per device could be lost
+        QMutexLocker transactionLocker{&transactionLock};
+        QList<QPair<Identifier, bool>> events{};
+        {
+            QMutexLocker locker{&pendingLock};
+            events.swap(pending);
+        }
+
+        // reduce the events of each device in their order to at most one removal followed by at most one addition
+        QList<Identifier> order{};
+        QHash<Identifier, QPair<bool, bool>> reduced{}; // deactivated in between, activated at last
+        for (auto const &event : events) {
+            if (!reduced.contains(event.first)) {
+                order.append(event.first);
+            }
+            auto &state{reduced[event.first]};
+            state.first = state.first || !event.second;
+            state.second = event.second;
+        }
+        QList<Identifier> removals{};
+        QList<Identifier> additions{};
+        {
+            QReadLocker locker{&updateLock};
+            for (auto const identifier : order) {
+                auto const state{reduced.value(identifier)};
+                auto const known{devicesCurrent.contains(identifier)};
+                if (known && state.first) {
+                    removals.append(identifier);
+                }
+                if (state.second && (!known || state.first)) {
+                    additions.append(identifier);
+                }
+            }
+        }
+        applyTransaction(removals, additions);
+    }
+
 public: // variables
     System *that{nullptr};
     QReadWriteLock initializeLock{QReadWriteLock::RecursionMode::Recursive};
     bool initialized{false};
     QSharedPointer<SystemEventProvider> eventProvider;
     QSharedPointer<SystemTrackingProvider> trackingProvider;
+    QSharedPointer<GlobalPoseStage> poseStage;
+    QSharedPointer<DefaultBoundaryProvider> boundaryProvider;
+    Cell::Boundary boundaryCurrent{};
+    QHash<Identifier, QMatrix4x4> globalTransforms{};
+    QHash<Identifier, QSharedPointer<BoundaryMonitor>> boundaryMonitors{};
+    EquipmentAssigner equipmentAssigner{};
+    QSharedPointer<NodeHub> hub;
+    QMap<Identifier, QSet<Identifier>> nodeDevices{};
+    QMap<Identifier, QMap<Identifier, Components::CompactPose>> remotePoses{};
+    QVector<Internal::TransformKernels::Rigid> remoteTransforms{};
+    QVector<Components::CompactPose> remoteGlobalPoses{};
     QReadWriteLock updateLock{QReadWriteLock::RecursionMode::Recursive};
     bool current{true};
     QMap<CuteVR::Identifier, QSharedPointer<CuteVR::Device>> devicesCurrent{};
     QMap<CuteVR::Identifier, CuteVR::System::Equipment> equipmentsCurrent{};
     QMap<CuteVR::Identifier, CuteVR::System::Cell> cellsCurrent{};
+    QMutex transactionLock{};
+    QMutex pendingLock{};
+    QWaitCondition pendingCondition{};
+    QList<QPair<Identifier, bool>> pending{};
+    bool stopping{false};
+    HotplugThread hotplugThread;
+    QMutex poolLock{};
+    QHash<Identifier, QString> serials{};
+    QHash<PoolKey, QSharedPointer<Device>> pool{};
+    QList<PoolKey> poolOrder{};
 };
 
 System::System() :
@@ -257,24 +918,23 @@ System::~System() = default;
 QList<Identifier> System::filteredDevices(Optional<Identifier> const cell,
                                           Optional<Identifier> const equipment) const noexcept {
     auto const cellEnabled{
-            ConfigurationServer::isEnabled(feature(Feature::cell)).right(false) && cell.hasValue()};
+            Profile::isEnabled<Feature::cell>() && cell.hasValue()};
     auto const equipmentEnabled{
-            ConfigurationServer::isEnabled(feature(Feature::equipment)).right(false) && equipment.hasValue()};
-    if ((!cellEnabled && !equipmentEnabled) ||
-        (cellEnabled && cell.value() != 0) ||
-        (equipmentEnabled && equipment.value() != 0)) {
+            Profile::isEnabled<Feature::equipment>() && equipment.hasValue()};
+    if (!cellEnabled && !equipmentEnabled) {
         return {};
     }
-    QVector<Device::Category> const included{
-            Device::Category::headMountedDisplay,
-            Device::Category::headMountedAudio,
-            Device::Category::controller,
-    };
-    QReadLocker{&_private->updateLock};
+    QReadLocker locker{&_private->updateLock};
+    if ((cellEnabled && cell.value() != 0 && !cells.contains(cell.value())) ||
+        (equipmentEnabled && !equipments.contains(equipment.value()))) {
+        return {};
+    }
+    auto const selected{equipmentEnabled ? equipments.value(equipment.value()) : Equipment{}};
+    auto const members{selected.headMountedDisplays + selected.headMountedAudios + selected.controllers};
     QList<Identifier> filtered{};
     for (auto const &device : devices) {
-        if ((cellEnabled && !equipmentEnabled) ||
-            (equipmentEnabled && included.contains(device->category()))) {
+        if ((!cellEnabled || _private->cellOf(device->identifier) == cell.value()) &&
+            (!equipmentEnabled || members.contains(device->identifier))) {
             filtered.append(device->identifier);
         }
     }
@@ -282,7 +942,7 @@ QList<Identifier> System::filteredDevices(Optional<Identifier> const cell,
 }
 
 QList<Identifier> System::filteredDevices(Device::Category const category) const noexcept {
-    QReadLocker{&_private->updateLock};
+    QReadLocker locker{&_private->updateLock};
     QList<Identifier> filtered{};
     for (auto const &device : devices) {
         if (device->category() == category) {
@@ -293,58 +953,82 @@ QList<Identifier> System::filteredDevices(Device::Category const category) const
 }
 
 Optional<Identifier> System::equipment(Identifier const device) const noexcept {
-    if (!ConfigurationServer::isEnabled(feature(Feature::equipment)).right(false)) {
+    if (!Profile::isEnabled<Feature::equipment>()) {
         return {};
     }
-    QVector<Device::Category> const included{
-            Device::Category::headMountedDisplay,
-            Device::Category::headMountedAudio,
-            Device::Category::controller,
-    };
-    QReadLocker{&_private->updateLock};
-    return devices.contains(device) &&
-           included.contains(devices.value(device)->category()) ? Optional<Identifier>{Identifier{0}}
-                                                                : Optional<Identifier>{};
+    QReadLocker locker{&_private->updateLock};
+    for (auto equipment = equipments.cbegin(); equipment != equipments.cend(); ++equipment) {
+        if (equipment->headMountedDisplays.contains(device) || equipment->headMountedAudios.contains(device) ||
+            equipment->controllers.contains(device)) {
+            return Optional<Identifier>{equipment.key()};
+        }
+    }
+    return {};
 }
 
 Optional<Identifier> System::cell(Identifier const device) const noexcept {
-    if (!ConfigurationServer::isEnabled(feature(Feature::cell)).right(false)) {
+    if (!Profile::isEnabled<Feature::cell>()) {
         return {};
     }
-    QReadLocker{&_private->updateLock};
-    return devices.contains(device) ? Optional<Identifier>{Identifier{0}}
+    QReadLocker locker{&_private->updateLock};
+    return devices.contains(device) ? Optional<Identifier>{_private->cellOf(device)}
                                     : Optional<Identifier>{};
 }
 
+void System::setGlobalTransform(Identifier const cell, QMatrix4x4 const &transform) {
+    if (!Profile::isEnabled<Feature::cell>()) {
+        return;
+    }
+    _private->applyGlobalTransform(cell, transform);
+}
+
+QMatrix4x4 System::universeTransform(TrackingUniverse const from, TrackingUniverse const to) const {
+    QReadLocker locker{&_private->initializeLock};
+    if (_private->poseStage.isNull()) {
+        return {};
+    }
+    return _private->poseStage->universeTransform(static_cast<qint32>(from), static_cast<qint32>(to));
+}
+
+quint16 System::nodePort() const noexcept {
+    QReadLocker locker{&_private->initializeLock};
+    return _private->hub.isNull() ? quint16{0} : _private->hub->port();
+}
+
 void System::destroy() {
-    QWriteLocker{&_private->initializeLock};
+    QWriteLocker locker{&_private->initializeLock};
     if (_private->initialized) {
         _private->eventProvider.clear();
         _private->trackingProvider.clear();
+        _private->poseStage.clear();
+        _private->boundaryProvider.clear();
+        _private->hub.clear();
         _private->initialized = false;
     }
-    // remove all devices
-    for (auto &deviceIdentifier : devices.keys()) {
-        _private->handleDeviceDeactivated(deviceIdentifier);
-    }
+    // flush hotplugs that are still pending, then remove all devices at once
+    _private->stopHotplugs();
+    QMutexLocker transactionLocker{&_private->transactionLock};
+    _private->dropNodes();
+    _private->applyTransaction(_private->devicesCurrent.keys(), {});
+    _private->clearPool();
 }
 
 bool System::isDestroyed() const noexcept {
-    QReadLocker{&_private->initializeLock};
+    QReadLocker locker{&_private->initializeLock};
     return !_private->initialized;
 }
 
 void System::initialize() {
-    QWriteLocker{&_private->initializeLock};
+    QWriteLocker locker{&_private->initializeLock};
     if (!_private->initialized) {
         _private->eventProvider.reset(new Private::SystemEventProvider{this, [&](vr::VREvent_t const &event) {
             switch (event.eventType) {
                 case vr::VREvent_TrackedDeviceActivated: {
-                    QtConcurrent::run([this,event]() { _private->handleDeviceActivated(event.trackedDeviceIndex);});
+                    _private->enqueueHotplug(event.trackedDeviceIndex, true);
                     break;
                 }
                 case vr::VREvent_TrackedDeviceDeactivated: {
-                    QtConcurrent::run([this,event]() { _private->handleDeviceDeactivated(event.trackedDeviceIndex);});
+                    _private->enqueueHotplug(event.trackedDeviceIndex, false);
                     break;
                 }
                 default: break;
@@ -361,30 +1045,66 @@ void System::initialize() {
         });
         _private->trackingProvider.reset(new Private::SystemTrackingProvider{});
         DriverServer::announce(_private->trackingProvider.toWeakRef(), QSet<Identifier>{});
+        _private->poseStage.reset(new GlobalPoseStage{});
+        DriverServer::announce(_private->poseStage.staticCast<Interface::EventHandler>().toWeakRef(), {}, {
+                vr::VREvent_ChaperoneDataHasChanged,
+                vr::VREvent_ChaperoneUniverseHasChanged,
+                vr::VREvent_ChaperoneSettingsHaveChanged,
+                vr::VREvent_SeatedZeroPoseReset,
+        });
+        if (Profile::isEnabled<Feature::cell>()) {
+            // the stage keeps answering universe transforms, but only transforms the frames if there are cells
+            DriverServer::announceFrame(_private->poseStage.staticCast<Interface::TrackingHandler>().toWeakRef());
+            _private->boundaryProvider.reset(new DefaultBoundaryProvider{[&](Cell::Boundary const &boundary) {
+                _private->applyBoundary(boundary);
+            }});
+            DriverServer::announce(_private->boundaryProvider.toWeakRef(), {}, {
+                    vr::VREvent_ChaperoneDataHasChanged,
+                    vr::VREvent_ChaperoneUniverseHasChanged,
+            });
+            _private->boundaryProvider->query();
+            if (Profile::isEnabled<Feature::nodeAggregation>()) {
+                _private->hub.reset(new NodeHub{static_cast<quint16>(
+                        ConfigurationServer::value(parameter(Parameter::nodePort)).right(QVariant{47600}).toUInt())});
+            }
+        }
 
         // add devices after all other is initialized
+        QList<Identifier> connected{};
         DriverServer::synchronized([&] {
             for (quint32 index = 0; index < vr::k_unMaxTrackedDeviceCount; index++) {
                 if (vr::VRSystem()->IsTrackedDeviceConnected(index)) {
-                    _private->handleDeviceActivated(index);
+                    connected.append(index);
                 }
             }
         }, Trilean::yes);
+        QMutexLocker transactionLocker{&_private->transactionLock};
+        _private->applyTransaction({}, connected);
 
         _private->initialized = true;
     }
 }
 
 bool System::isInitialized() const noexcept {
-    QReadLocker{&_private->initializeLock};
+    QReadLocker locker{&_private->initializeLock};
     return _private->initialized;
 }
 
 void System::update() {
-    QWriteLocker{&_private->updateLock};
+    QSharedPointer<GlobalPoseStage> poseStage{};
+    QSharedPointer<NodeHub> hub{};
+    {
+        QReadLocker locker{&_private->initializeLock};
+        poseStage = _private->poseStage;
+        hub = _private->hub;
+    }
+    if (!hub.isNull()) {
+        _private->aggregateNodes(*hub);
+    }
+    QWriteLocker locker{&_private->updateLock};
     if (!_private->current) {
-        auto const equipmentEnabled{ConfigurationServer::isEnabled(feature(Feature::equipment)).right(false)};
-        auto const cellEnabled{ConfigurationServer::isEnabled(feature(Feature::cell)).right(false)};
+        auto const equipmentEnabled{Profile::isEnabled<Feature::equipment>()};
+        auto const cellEnabled{Profile::isEnabled<Feature::cell>()};
         devices = _private->devicesCurrent;
         if (equipmentEnabled) {
             equipments = _private->equipmentsCurrent;
@@ -396,12 +1116,53 @@ void System::update() {
         } else {
             cells.clear();
         }
+        if (!poseStage.isNull()) {
+            poseStage->setCellTransforms(cellEnabled ? _private->cellTransforms() : QHash<Identifier, QMatrix4x4>{});
+        }
         _private->current = true;
     }
+    quint64 frame{0};
+    if (!poseStage.isNull()) {
+        auto const snapshot{poseStage->snapshot()};
+        cellPoses = snapshot.cellPoses;
+        globalPoses = snapshot.globalPoses;
+        frame = snapshot.frame;
+    }
+    if (!hub.isNull()) {
+        _private->mergeRemotePoses();
+    }
+    if (Profile::isEnabled<Feature::equipment>() && Profile::isEnabled<Feature::multiEquipment>()) {
+        _private->assignEquipments(frame, cellPoses);
+    }
+
+    // all positions of a cell are evaluated at once, but only state transitions are signaled
+    auto const nearDistance{ConfigurationServer::value(parameter(Parameter::boundaryNearDistance))
+                                    .right(QVariant{0.4}).toDouble()};
+    boundaryDistances.clear();
+    for (auto const &cell : cells) {
+        QMap<Identifier, QVector3D> positions{};
+        for (auto const device : _private->boundedDevices(cell)) {
+            auto const pose{cellPoses.constFind(device)};
+            if (pose != cellPoses.constEnd() && (pose->flags & Components::CompactPose::isValid)) {
+                positions.insert(device, pose->position);
+            }
+        }
+        auto &monitor{_private->boundaryMonitors[cell.identifier]};
+        if (monitor.isNull()) {
+            monitor.reset(new BoundaryMonitor{});
+        }
+        auto const evaluation{monitor->evaluate(cell.boundary, positions, nearDistance)};
+        for (auto distance = evaluation.distances.cbegin(); distance != evaluation.distances.cend(); ++distance) {
+            boundaryDistances.insert(distance.key(), distance.value());
+        }
+        for (auto const &transition : evaluation.transitions) {
+            emit boundaryStateChanged(cell.identifier, transition.device, transition.state);
+        }
+    }
 }
 
 bool System::isCurrent() const noexcept {
-    QReadLocker{&_private->updateLock};
+    QReadLocker locker{&_private->updateLock};
     return _private->current;
 }
 
@@ -0,0 +1,90 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cstddef>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Components/CompactPose.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Components::Pose;
+using Extension::Trilean;
+
+class CompactPoseTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void layout_Always_IsAlignedPlainOldData() {
+        QVERIFY(std::is_trivially_copyable<CompactPose>::value);
+        QCOMPARE(alignof(CompactPose), std::size_t{16});
+        QCOMPARE(offsetof(CompactPose, orientation) % 16, std::size_t{0});
+        QCOMPARE(offsetof(CompactPose, linearVelocity) % 16, std::size_t{0});
+        QCOMPARE(offsetof(CompactPose, angularVelocity) % 16, std::size_t{0});
+    }
+
+    void valid_Flags_MapToTrilean() {
+        CompactPose pose{};
+        QVERIFY(pose.valid() == Trilean::maybe);
+        pose.flags = CompactPose::isValid;
+        QVERIFY(pose.valid() == Trilean::yes);
+        pose.flags = CompactPose::isInvalid;
+        QVERIFY(pose.valid() == Trilean::no);
+    }
+
+    void fromPose_ThenToPose_KeepsEverythingButAccelerations() {
+        Pose pose{};
+        pose.valid = Trilean::yes;
+        pose.poseTransform.translate(1.0f, 2.0f, 3.0f);
+        pose.poseTransform.rotate(90.0f, 0.0f, 1.0f, 0.0f);
+        pose.linearVelocity.setValue(QVector3D{4.0f, 5.0f, 6.0f});
+        pose.linearAcceleration.setValue(QVector3D{7.0f, 8.0f, 9.0f});
+        auto const compact{CompactPose::fromPose(pose)};
+        QVERIFY(compact.valid() == Trilean::yes);
+        QVERIFY(compact.position == QVector3D(1.0f, 2.0f, 3.0f));
+        QVERIFY(qFuzzyCompare(compact.orientation, QQuaternion::fromAxisAndAngle(0.0f, 1.0f, 0.0f, 90.0f)));
+        QVERIFY(compact.flags & CompactPose::hasLinearVelocity);
+        QVERIFY(!(compact.flags & CompactPose::hasAngularVelocity));
+        auto const expanded{compact.toPose()};
+        QVERIFY(expanded.valid == Trilean::yes);
+        QVERIFY(qFuzzyCompare(expanded.poseTransform, pose.poseTransform));
+        QVERIFY(expanded.linearVelocity == pose.linearVelocity);
+        QVERIFY(!expanded.angularVelocity.hasValue());
+        QVERIFY(!expanded.linearAcceleration.hasValue());
+    }
+
+    void equals_DifferentValues_ReturnsFalse() {
+        CompactPose left{}, right{};
+        QVERIFY(left == right);
+        right.position.setX(1.0f);
+        QVERIFY(left != right);
+        left.position.setX(1.0f);
+        left.flags = CompactPose::isValid;
+        QVERIFY(left != right);
+    }
+
+    void copy_CompactPose_Benchmark() {
+        QVector<CompactPose> poses(64);
+        QVector<CompactPose> copies{};
+        QBENCHMARK {
+            copies = poses;
+            copies.detach();
+        }
+    }
+
+    void copy_Pose_Benchmark() {
+        QVector<Pose> poses(64);
+        QVector<Pose> copies{};
+        QBENCHMARK {
+            copies = poses;
+            copies.detach();
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(CompactPoseTest)
+
+#include "Components/CompactPoseTest.moc"
@@ -0,0 +1,97 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Cone.hpp>
+#include <CuteVR/Internal/TestHelper.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cone;
+
+class ConeTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void cloneableInterface_data() {
+        Cone cone{};
+        cone.r = 1.0f;
+        cone.h = 2.0f;
+        QTest::addColumn<Cone>("object");
+        QTest::newRow("HasAllValuesCustomized_ClonedHasSameValues") << cone;
+    }
+
+    void cloneableInterface() { Internal::cloneableInterfaceTestHelper<Cone>(); }
+
+    void equalityComparableInterface_data() {
+        Cone left{}, right{};
+        QTest::addColumn<Cone>("left");
+        QTest::addColumn<Cone>("right");
+        QTest::addColumn<bool>("result");
+        QTest::newRow("LeftAndRightAreDefault_ReturnsTrue") << left << right << true;
+        left.r = 3.0f;
+        QTest::newRow("LeftHasNewRNow_ReturnsFalse") << left << right << false;
+        right.r = 3.0f;
+        QTest::newRow("RightHasNewRNow_ReturnsTrue") << left << right << true;
+        left.h = 4.0f;
+        QTest::newRow("LeftHasNewHNow_ReturnsFalse") << left << right << false;
+        right.h = 4.0f;
+        QTest::newRow("RightHasNewHNow_ReturnsTrue") << left << right << true;
+    }
+
+    void equalityComparableInterface() { Internal::equalityComparableInterfaceTestHelper<Cone>(); }
+
+    void serializableInterface_data() {
+        Cone cone{};
+        cone.r = 5.0f;
+        cone.h = 6.0f;
+        QTest::addColumn<Cone>("object");
+        QTest::newRow("HasAllValuesCustomized_SerializedHasSameValues") << cone;
+    }
+
+    void serializableInterface() { Internal::serializableInterfaceTestHelper<Cone>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Cone cone{};
+        cone.r = 1.0;
+        cone.h = 4.0;
+        QCOMPARE(cone.distance({0.0f, 0.0f, 0.0f}), -3.0 / std::sqrt(17.0));
+        QCOMPARE(cone.distance({0.0f, -3.0f, 0.0f}), 2.0);
+        QCOMPARE(cone.distance({0.0f, 5.0f, 0.0f}), 2.0);
+        QCOMPARE(cone.distance({4.0f, -1.0f, 0.0f}), 3.0);
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Cone cone{};
+        cone.r = 1.0;
+        cone.h = 4.0;
+        QVERIFY(cone.contains({0.0f, 2.5f, 0.0f}));
+        QVERIFY(!cone.contains({0.5f, 2.5f, 0.0f}));
+        QVERIFY(!cone.contains({0.0f, -1.5f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Cone cone{};
+        cone.r = 1.0;
+        cone.h = 4.0;
+        QCOMPARE(cone.intersect({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 2.0);
+        QCOMPARE(cone.intersect({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 2.25);
+        QVERIFY(qIsInf(cone.intersect({0.0f, -2.0f, 0.0f}, {0.0f, -1.0f, 0.0f})));
+        QVERIFY(qIsInf(Cone{}.intersect({0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f})));
+    }
+
+    void bounds_Default_EnclosesCone() {
+        Cone cone{};
+        cone.r = 1.0;
+        cone.h = 4.0;
+        QVERIFY(cone.bounds().first == QVector3D(-1.0f, -1.0f, -1.0f));
+        QVERIFY(cone.bounds().second == QVector3D(1.0f, 3.0f, 1.0f));
+    }
+};
+
+QTEST_APPLESS_MAIN(ConeTest)
+
+#include "Components/Geometry/ConeTest.moc"
@@ -3,6 +3,8 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <cmath>
+
 #include <CuteVR/Components/Geometry/Cube.hpp>
 #include <CuteVR/Internal/TestHelper.hpp>
 
@@ -45,6 +47,39 @@ private slots: // tests
     }
 
     void serializableInterface() { Internal::serializableInterfaceTestHelper<Cube>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Cube cube{};
+        cube.a = 2.0;
+        QCOMPARE(cube.distance({0.0f, 0.0f, 0.0f}), -1.0);
+        QCOMPARE(cube.distance({0.0f, 0.5f, 0.0f}), -0.5);
+        QCOMPARE(cube.distance({2.0f, 0.0f, 0.0f}), 1.0);
+        QCOMPARE(cube.distance({2.0f, -2.0f, 1.0f}), std::sqrt(2.0));
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Cube cube{};
+        cube.a = 2.0;
+        QVERIFY(cube.contains({0.5f, -0.5f, 0.9f}));
+        QVERIFY(cube.contains({1.0f, 1.0f, 1.0f}));
+        QVERIFY(!cube.contains({1.5f, 0.0f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Cube cube{};
+        cube.a = 2.0;
+        QCOMPARE(cube.intersect({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 2.0);
+        QCOMPARE(cube.intersect({0.5f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 0.0);
+        QVERIFY(qIsInf(cube.intersect({-3.0f, 1.5f, 0.0f}, {1.0f, 0.0f, 0.0f})));
+        QVERIFY(qIsInf(cube.intersect({3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f})));
+    }
+
+    void bounds_Default_EnclosesCube() {
+        Cube cube{};
+        cube.a = 2.0;
+        QVERIFY(cube.bounds().first == QVector3D(-1.0f, -1.0f, -1.0f));
+        QVERIFY(cube.bounds().second == QVector3D(1.0f, 1.0f, 1.0f));
+    }
 };
 
 QTEST_APPLESS_MAIN(CubeTest)
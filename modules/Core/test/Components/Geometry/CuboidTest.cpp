@@ -57,6 +57,46 @@ private slots: // tests
     }
 
     void serializableInterface() { Internal::serializableInterfaceTestHelper<Cuboid>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 4.0;
+        cuboid.c = 6.0;
+        QCOMPARE(cuboid.distance({0.0f, 0.0f, 0.0f}), -1.0);
+        QCOMPARE(cuboid.distance({0.0f, 1.5f, 2.0f}), -0.5);
+        QCOMPARE(cuboid.distance({0.0f, 0.0f, 5.0f}), 2.0);
+        QCOMPARE(cuboid.distance({-4.0f, 6.0f, 0.0f}), 5.0);
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 4.0;
+        cuboid.c = 6.0;
+        QVERIFY(cuboid.contains({0.5f, -1.5f, 2.5f}));
+        QVERIFY(!cuboid.contains({0.0f, 2.5f, 0.0f}));
+        QVERIFY(!cuboid.contains({1.5f, 0.0f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 4.0;
+        cuboid.c = 6.0;
+        QCOMPARE(cuboid.intersect({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 3.0);
+        QCOMPARE(cuboid.intersect({0.0f, 0.0f, 2.5f}, {0.0f, 0.0f, 1.0f}), 0.0);
+        QVERIFY(qIsInf(cuboid.intersect({0.0f, 5.0f, 3.5f}, {0.0f, -1.0f, 0.0f})));
+    }
+
+    void bounds_Default_EnclosesCuboid() {
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 4.0;
+        cuboid.c = 6.0;
+        QVERIFY(cuboid.bounds().first == QVector3D(-1.0f, -2.0f, -3.0f));
+        QVERIFY(cuboid.bounds().second == QVector3D(1.0f, 2.0f, 3.0f));
+    }
 };
 
 QTEST_APPLESS_MAIN(CuboidTest)
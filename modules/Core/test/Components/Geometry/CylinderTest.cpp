@@ -0,0 +1,97 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Cylinder.hpp>
+#include <CuteVR/Internal/TestHelper.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cylinder;
+
+class CylinderTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void cloneableInterface_data() {
+        Cylinder cylinder{};
+        cylinder.r = 1.0f;
+        cylinder.h = 2.0f;
+        QTest::addColumn<Cylinder>("object");
+        QTest::newRow("HasAllValuesCustomized_ClonedHasSameValues") << cylinder;
+    }
+
+    void cloneableInterface() { Internal::cloneableInterfaceTestHelper<Cylinder>(); }
+
+    void equalityComparableInterface_data() {
+        Cylinder left{}, right{};
+        QTest::addColumn<Cylinder>("left");
+        QTest::addColumn<Cylinder>("right");
+        QTest::addColumn<bool>("result");
+        QTest::newRow("LeftAndRightAreDefault_ReturnsTrue") << left << right << true;
+        left.r = 3.0f;
+        QTest::newRow("LeftHasNewRNow_ReturnsFalse") << left << right << false;
+        right.r = 3.0f;
+        QTest::newRow("RightHasNewRNow_ReturnsTrue") << left << right << true;
+        left.h = 4.0f;
+        QTest::newRow("LeftHasNewHNow_ReturnsFalse") << left << right << false;
+        right.h = 4.0f;
+        QTest::newRow("RightHasNewHNow_ReturnsTrue") << left << right << true;
+    }
+
+    void equalityComparableInterface() { Internal::equalityComparableInterfaceTestHelper<Cylinder>(); }
+
+    void serializableInterface_data() {
+        Cylinder cylinder{};
+        cylinder.r = 5.0f;
+        cylinder.h = 6.0f;
+        QTest::addColumn<Cylinder>("object");
+        QTest::newRow("HasAllValuesCustomized_SerializedHasSameValues") << cylinder;
+    }
+
+    void serializableInterface() { Internal::serializableInterfaceTestHelper<Cylinder>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Cylinder cylinder{};
+        cylinder.r = 1.0;
+        cylinder.h = 4.0;
+        QCOMPARE(cylinder.distance({0.0f, 0.0f, 0.0f}), -1.0);
+        QCOMPARE(cylinder.distance({0.0f, 1.5f, 0.0f}), -0.5);
+        QCOMPARE(cylinder.distance({3.0f, 0.0f, 0.0f}), 2.0);
+        QCOMPARE(cylinder.distance({4.0f, 6.0f, 0.0f}), 5.0);
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Cylinder cylinder{};
+        cylinder.r = 1.0;
+        cylinder.h = 4.0;
+        QVERIFY(cylinder.contains({0.5f, -1.5f, 0.5f}));
+        QVERIFY(!cylinder.contains({0.0f, 2.5f, 0.0f}));
+        QVERIFY(!cylinder.contains({1.5f, 0.0f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Cylinder cylinder{};
+        cylinder.r = 1.0;
+        cylinder.h = 4.0;
+        QCOMPARE(cylinder.intersect({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 2.0);
+        QCOMPARE(cylinder.intersect({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 3.0);
+        QCOMPARE(cylinder.intersect({0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 0.0);
+        QVERIFY(qIsInf(cylinder.intersect({0.0f, 5.0f, 1.5f}, {0.0f, -1.0f, 0.0f})));
+    }
+
+    void bounds_Default_EnclosesCylinder() {
+        Cylinder cylinder{};
+        cylinder.r = 1.0;
+        cylinder.h = 4.0;
+        QVERIFY(cylinder.bounds().first == QVector3D(-1.0f, -2.0f, -1.0f));
+        QVERIFY(cylinder.bounds().second == QVector3D(1.0f, 2.0f, 1.0f));
+    }
+};
+
+QTEST_APPLESS_MAIN(CylinderTest)
+
+#include "Components/Geometry/CylinderTest.moc"
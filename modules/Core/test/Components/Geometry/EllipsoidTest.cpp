@@ -0,0 +1,107 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Ellipsoid.hpp>
+#include <CuteVR/Internal/TestHelper.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Ellipsoid;
+
+class EllipsoidTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void cloneableInterface_data() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 1.0f;
+        ellipsoid.b = 2.0f;
+        ellipsoid.c = 3.0f;
+        QTest::addColumn<Ellipsoid>("object");
+        QTest::newRow("HasAllValuesCustomized_ClonedHasSameValues") << ellipsoid;
+    }
+
+    void cloneableInterface() { Internal::cloneableInterfaceTestHelper<Ellipsoid>(); }
+
+    void equalityComparableInterface_data() {
+        Ellipsoid left{}, right{};
+        QTest::addColumn<Ellipsoid>("left");
+        QTest::addColumn<Ellipsoid>("right");
+        QTest::addColumn<bool>("result");
+        QTest::newRow("LeftAndRightAreDefault_ReturnsTrue") << left << right << true;
+        left.a = 4.0f;
+        QTest::newRow("LeftHasNewANow_ReturnsFalse") << left << right << false;
+        right.a = 4.0f;
+        QTest::newRow("RightHasNewANow_ReturnsTrue") << left << right << true;
+        left.b = 5.0f;
+        QTest::newRow("LeftHasNewBNow_ReturnsFalse") << left << right << false;
+        right.b = 5.0f;
+        QTest::newRow("RightHasNewBNow_ReturnsTrue") << left << right << true;
+        left.c = 6.0f;
+        QTest::newRow("LeftHasNewCNow_ReturnsFalse") << left << right << false;
+        right.c = 6.0f;
+        QTest::newRow("RightHasNewCNow_ReturnsTrue") << left << right << true;
+    }
+
+    void equalityComparableInterface() { Internal::equalityComparableInterfaceTestHelper<Ellipsoid>(); }
+
+    void serializableInterface_data() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 7.0f;
+        ellipsoid.b = 8.0f;
+        ellipsoid.c = 9.0f;
+        QTest::addColumn<Ellipsoid>("object");
+        QTest::newRow("HasAllValuesCustomized_SerializedHasSameValues") << ellipsoid;
+    }
+
+    void serializableInterface() { Internal::serializableInterfaceTestHelper<Ellipsoid>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 1.0;
+        ellipsoid.b = 2.0;
+        ellipsoid.c = 3.0;
+        QCOMPARE(ellipsoid.distance({0.0f, 0.0f, 0.0f}), -1.0);
+        QCOMPARE(ellipsoid.distance({0.0f, 0.0f, 5.0f}), 2.0);
+        QCOMPARE(ellipsoid.distance({0.0f, 2.0f, 0.0f}), 0.0);
+        QVERIFY(qIsInf(Ellipsoid{}.distance({0.0f, 0.0f, 0.0f})));
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 1.0;
+        ellipsoid.b = 2.0;
+        ellipsoid.c = 3.0;
+        QVERIFY(ellipsoid.contains({0.5f, 1.0f, 1.0f}));
+        QVERIFY(!ellipsoid.contains({0.0f, 2.5f, 0.0f}));
+        QVERIFY(!ellipsoid.contains({0.9f, 0.0f, 1.5f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 1.0;
+        ellipsoid.b = 2.0;
+        ellipsoid.c = 3.0;
+        QCOMPARE(ellipsoid.intersect({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 2.0);
+        QCOMPARE(ellipsoid.intersect({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 3.0);
+        QCOMPARE(ellipsoid.intersect({0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}), 0.0);
+        QVERIFY(qIsInf(ellipsoid.intersect({2.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f})));
+    }
+
+    void bounds_Default_EnclosesEllipsoid() {
+        Ellipsoid ellipsoid{};
+        ellipsoid.a = 1.0;
+        ellipsoid.b = 2.0;
+        ellipsoid.c = 3.0;
+        QVERIFY(ellipsoid.bounds().first == QVector3D(-1.0f, -2.0f, -3.0f));
+        QVERIFY(ellipsoid.bounds().second == QVector3D(1.0f, 2.0f, 3.0f));
+    }
+};
+
+QTEST_APPLESS_MAIN(EllipsoidTest)
+
+#include "Components/Geometry/EllipsoidTest.moc"
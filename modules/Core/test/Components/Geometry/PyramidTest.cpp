@@ -0,0 +1,107 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+
+#include <CuteVR/Components/Geometry/Pyramid.hpp>
+#include <CuteVR/Internal/TestHelper.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Pyramid;
+
+class PyramidTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void cloneableInterface_data() {
+        Pyramid pyramid{};
+        pyramid.a = 1.0f;
+        pyramid.b = 2.0f;
+        pyramid.c = 3.0f;
+        QTest::addColumn<Pyramid>("object");
+        QTest::newRow("HasAllValuesCustomized_ClonedHasSameValues") << pyramid;
+    }
+
+    void cloneableInterface() { Internal::cloneableInterfaceTestHelper<Pyramid>(); }
+
+    void equalityComparableInterface_data() {
+        Pyramid left{}, right{};
+        QTest::addColumn<Pyramid>("left");
+        QTest::addColumn<Pyramid>("right");
+        QTest::addColumn<bool>("result");
+        QTest::newRow("LeftAndRightAreDefault_ReturnsTrue") << left << right << true;
+        left.a = 4.0f;
+        QTest::newRow("LeftHasNewANow_ReturnsFalse") << left << right << false;
+        right.a = 4.0f;
+        QTest::newRow("RightHasNewANow_ReturnsTrue") << left << right << true;
+        left.b = 5.0f;
+        QTest::newRow("LeftHasNewBNow_ReturnsFalse") << left << right << false;
+        right.b = 5.0f;
+        QTest::newRow("RightHasNewBNow_ReturnsTrue") << left << right << true;
+        left.c = 6.0f;
+        QTest::newRow("LeftHasNewCNow_ReturnsFalse") << left << right << false;
+        right.c = 6.0f;
+        QTest::newRow("RightHasNewCNow_ReturnsTrue") << left << right << true;
+    }
+
+    void equalityComparableInterface() { Internal::equalityComparableInterfaceTestHelper<Pyramid>(); }
+
+    void serializableInterface_data() {
+        Pyramid pyramid{};
+        pyramid.a = 7.0f;
+        pyramid.b = 8.0f;
+        pyramid.c = 9.0f;
+        QTest::addColumn<Pyramid>("object");
+        QTest::newRow("HasAllValuesCustomized_SerializedHasSameValues") << pyramid;
+    }
+
+    void serializableInterface() { Internal::serializableInterfaceTestHelper<Pyramid>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Pyramid pyramid{};
+        pyramid.a = 2.0;
+        pyramid.b = 4.0;
+        pyramid.c = 2.0;
+        QCOMPARE(pyramid.distance({0.0f, 0.0f, 0.0f}), -3.0 / std::sqrt(17.0));
+        QCOMPARE(pyramid.distance({0.0f, -3.0f, 0.0f}), 2.0);
+        QCOMPARE(pyramid.distance({0.0f, 5.0f, 0.0f}), 2.0);
+        QCOMPARE(pyramid.distance({4.0f, -1.0f, 5.0f}), 5.0);
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Pyramid pyramid{};
+        pyramid.a = 2.0;
+        pyramid.b = 4.0;
+        pyramid.c = 2.0;
+        QVERIFY(pyramid.contains({0.0f, 2.5f, 0.0f}));
+        QVERIFY(!pyramid.contains({0.5f, 2.5f, 0.0f}));
+        QVERIFY(!pyramid.contains({0.0f, -1.5f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Pyramid pyramid{};
+        pyramid.a = 2.0;
+        pyramid.b = 4.0;
+        pyramid.c = 2.0;
+        QCOMPARE(pyramid.intersect({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}), 2.0);
+        QCOMPARE(pyramid.intersect({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}), 2.25);
+        QCOMPARE(pyramid.intersect({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}), 0.0);
+        QVERIFY(qIsInf(pyramid.intersect({0.0f, -2.0f, 0.0f}, {0.0f, -1.0f, 0.0f})));
+    }
+
+    void bounds_Default_EnclosesPyramid() {
+        Pyramid pyramid{};
+        pyramid.a = 2.0;
+        pyramid.b = 4.0;
+        pyramid.c = 2.0;
+        QVERIFY(pyramid.bounds().first == QVector3D(-1.0f, -1.0f, -1.0f));
+        QVERIFY(pyramid.bounds().second == QVector3D(1.0f, 3.0f, 1.0f));
+    }
+};
+
+QTEST_APPLESS_MAIN(PyramidTest)
+
+#include "Components/Geometry/PyramidTest.moc"
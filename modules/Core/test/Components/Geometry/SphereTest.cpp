@@ -45,6 +45,38 @@ private slots: // tests
     }
 
     void serializableInterface() { Internal::serializableInterfaceTestHelper<Sphere>(); }
+
+    void distance_Points_AreSignedDistancesToSurface() {
+        Sphere sphere{};
+        sphere.r = 2.0;
+        QCOMPARE(sphere.distance({0.0f, 0.0f, 0.0f}), -2.0);
+        QCOMPARE(sphere.distance({0.0f, 1.0f, 0.0f}), -1.0);
+        QCOMPARE(sphere.distance({3.0f, 0.0f, 4.0f}), 3.0);
+    }
+
+    void contains_Points_ReturnsWhetherInside() {
+        Sphere sphere{};
+        sphere.r = 2.0;
+        QVERIFY(sphere.contains({1.0f, 1.0f, 1.0f}));
+        QVERIFY(sphere.contains({0.0f, -2.0f, 0.0f}));
+        QVERIFY(!sphere.contains({1.5f, 1.5f, 0.0f}));
+    }
+
+    void intersect_Rays_AreDistancesToSurface() {
+        Sphere sphere{};
+        sphere.r = 2.0;
+        QCOMPARE(sphere.intersect({0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}), 3.0);
+        QCOMPARE(sphere.intersect({0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}), 0.0);
+        QVERIFY(qIsInf(sphere.intersect({0.0f, 3.0f, -5.0f}, {0.0f, 0.0f, 1.0f})));
+        QVERIFY(qIsInf(sphere.intersect({0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, -1.0f})));
+    }
+
+    void bounds_Default_EnclosesSphere() {
+        Sphere sphere{};
+        sphere.r = 2.0;
+        QVERIFY(sphere.bounds().first == QVector3D(-2.0f, -2.0f, -2.0f));
+        QVERIFY(sphere.bounds().second == QVector3D(2.0f, 2.0f, 2.0f));
+    }
 };
 
 QTEST_APPLESS_MAIN(SphereTest)
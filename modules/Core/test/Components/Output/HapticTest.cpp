@@ -0,0 +1,58 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <CuteVR/Components/Output/Haptic.hpp>
+#include <CuteVR/Internal/TestHelper.hpp>
+
+using namespace CuteVR;
+using Components::Output::Haptic;
+
+class HapticTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void cloneableInterface_data() {
+        Haptic haptic{};
+        haptic.interval = 0.005;
+        haptic.duration = 0.004;
+        QTest::addColumn<Haptic>("object");
+        QTest::newRow("HasAllValuesCustomized_ClonedHasSameValues") << haptic;
+    }
+
+    void cloneableInterface() { Internal::cloneableInterfaceTestHelper<Haptic>(); }
+
+    void equalityComparableInterface_data() {
+        Haptic left{}, right{};
+        QTest::addColumn<Haptic>("left");
+        QTest::addColumn<Haptic>("right");
+        QTest::addColumn<bool>("result");
+        QTest::newRow("LeftAndRightAreDefault_ReturnsTrue") << left << right << true;
+        left.interval = 0.005;
+        QTest::newRow("LeftHasNewIntervalNow_ReturnsFalse") << left << right << false;
+        right.interval = 0.005;
+        QTest::newRow("RightHasNewIntervalNow_ReturnsTrue") << left << right << true;
+        left.duration = 0.004;
+        QTest::newRow("LeftHasNewDurationNow_ReturnsFalse") << left << right << false;
+        right.duration = 0.004;
+        QTest::newRow("RightHasNewDurationNow_ReturnsTrue") << left << right << true;
+    }
+
+    void equalityComparableInterface() { Internal::equalityComparableInterfaceTestHelper<Haptic>(); }
+
+    void serializableInterface_data() {
+        Haptic haptic{};
+        haptic.interval = 0.01;
+        haptic.duration = 0.002;
+        QTest::addColumn<Haptic>("object");
+        QTest::newRow("HasAllValuesCustomized_SerializedHasSameValues") << haptic;
+    }
+
+    void serializableInterface() { Internal::serializableInterfaceTestHelper<Haptic>(); }
+};
+
+QTEST_APPLESS_MAIN(HapticTest)
+
+#include "Components/Output/HapticTest.moc"
@@ -0,0 +1,110 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QPluginLoader>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/TestDevice.hpp>
+#include <CuteVR/DeviceServer.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using Emulator::OpenVR::anyDevice;
+using Emulator::OpenVR::anyProperty;
+using Emulator::OpenVR::vrSystem;
+using TestDevice = Internal::TestDevice<>;
+
+class DeviceServerTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+        vrSystem.getTrackedDeviceClass_data.unDeviceIndex = anyDevice;
+        vrSystem.getTrackedDeviceClass_data.returns = vr::TrackedDeviceClass_GenericTracker;
+        vrSystem.getStringTrackedDeviceProperty_data.unDeviceIndex = anyDevice;
+        vrSystem.getStringTrackedDeviceProperty_data.prop = anyProperty;
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "Emulated\0";
+        vrSystem.getStringTrackedDeviceProperty_data.unBufferSize = 9;
+        vrSystem.getStringTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getStringTrackedDeviceProperty_data.returns = 9;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void create_RepeatedModel_CreatesDevicesOfSameCategory() {
+        for (Identifier identifier = 1; identifier < 4; identifier++) {
+            auto const either{DeviceServer::create(identifier)};
+            QVERIFY(either.isRight());
+            QVERIFY(either.right()->category() == Device::Category::tracker);
+            QCOMPARE(either.right()->identifier, identifier);
+        }
+    }
+
+    void create_FactoryRegisteredAfterResolution_UsesNewFactory() {
+        QVERIFY(DeviceServer::create(5).isRight());
+        // the factory stays registered after this test, hence it must not refer to its locals
+        QSharedPointer<QAtomicInt> calls{new QAtomicInt{0}};
+        QVERIFY(!DeviceServer::registerDevice([calls](Identifier const identifier) {
+            calls->ref();
+            QSharedPointer<TestDevice> device{new TestDevice{identifier}};
+            device->dummyCategory = Device::Category::user;
+            return device.staticCast<Device>();
+        }, QStringList{"Emulated_Emulated_Emulated"}).hasValue());
+        auto const either{DeviceServer::create(5)};
+        QVERIFY(either.isRight());
+        QVERIFY(either.right()->category() == Device::Category::user);
+        QCOMPARE(calls->load(), 1);
+    }
+
+    void discover_PluginManifest_Benchmark() {
+        QBENCHMARK {
+            QPluginLoader{CUTE_VR_TEST_DEVICE_PLUGIN}.metaData();
+        }
+    }
+
+    void load_PluginLibrary_Benchmark() {
+        QBENCHMARK {
+            QPluginLoader loader{CUTE_VR_TEST_DEVICE_PLUGIN};
+            QVERIFY(loader.load());
+            loader.unload();
+        }
+    }
+
+    void create_DiscoveredSignature_LoadsPluginOnDemand() {
+        auto const directory{QFileInfo{CUTE_VR_TEST_DEVICE_PLUGIN}.absolutePath()};
+        QCOMPARE(DeviceServer::discover(directory), 1);
+        QCOMPARE(DeviceServer::discover(directory), 0);
+        QVERIFY(!QPluginLoader{CUTE_VR_TEST_DEVICE_PLUGIN}.isLoaded());
+        auto const either{DeviceServer::create(7)};
+        QVERIFY(QPluginLoader{CUTE_VR_TEST_DEVICE_PLUGIN}.isLoaded());
+        QVERIFY(either.isRight());
+        QVERIFY(either.right()->category() == static_cast<Device::Category>(101));
+    }
+
+    void create_ResolvedModel_Benchmark() {
+        DeviceServer::create(6);
+        QBENCHMARK {
+            DeviceServer::create(6);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(DeviceServerTest)
+
+#include "DeviceServerTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
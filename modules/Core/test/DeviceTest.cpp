@@ -3,10 +3,16 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
 #include <CuteVR/Internal/TestDevice.hpp>
 #include <CuteVR/Internal/TestHelper.hpp>
+#include <CuteVR/DriverServer.hpp>
 
 using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using ChangeSet = Device::ChangeSet;
 using TestDevice = Internal::TestDevice<>;
 
 Q_DECLARE_METATYPE(QSharedPointer<TestDevice>)
@@ -58,6 +64,44 @@ private slots: // tests
     }
 
     void serializableInterface() { Internal::serializableInterfaceTestHelper<QSharedPointer<TestDevice>>(); }
+
+#ifdef CUTE_VR_OPEN_VR
+    void changed_ChangeSetsEnabled_EmitsOncePerPoll() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        ConfigurationServer::enable(feature(Feature::changeSets));
+        DriverServer::instance().initialize();
+        auto &vrSystem{Emulator::OpenVR::vrSystem};
+        vrSystem.getStringTrackedDeviceProperty_data.unDeviceIndex = Emulator::OpenVR::anyDevice;
+        vrSystem.getStringTrackedDeviceProperty_data.prop = Emulator::OpenVR::anyProperty;
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "Emulated\0";
+        vrSystem.getStringTrackedDeviceProperty_data.unBufferSize = 9;
+        vrSystem.getStringTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getStringTrackedDeviceProperty_data.returns = 9;
+
+        TestDevice device{7};
+        device.Device::initialize();
+        QSignalSpy spy{&device, &Device::changed};
+        DriverServer::pollEvents(); // publishes the descriptions of the initialization
+        spy.clear();
+        device.recordChange(ChangeSet::Member::buttons, Component::Category::input, 1);
+        device.recordChange(ChangeSet::Member::buttons, Component::Category::input, 1);
+        device.recordChange(ChangeSet::Member::axes, Component::Category::input, 0);
+        DriverServer::pollEvents();
+        DriverServer::pollEvents();
+        QCOMPARE(spy.count(), 1);
+        auto const changes{spy.at(0).at(0).value<ChangeSet>()};
+        QVERIFY(changes.contains(ChangeSet::Member::buttons));
+        QVERIFY(changes.contains(ChangeSet::Member::axes));
+        QVERIFY(!changes.contains(ChangeSet::Member::pose));
+        QCOMPARE(changes.components.size(), 2);
+
+        device.Device::destroy();
+        DriverServer::instance().destroy();
+        ConfigurationServer::reset(feature(Feature::changeSets));
+    }
+#endif // CUTE_VR_OPEN_VR
 };
 
 QTEST_APPLESS_MAIN(DeviceTest)
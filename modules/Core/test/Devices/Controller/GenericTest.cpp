@@ -3,18 +3,68 @@
 /// @copyright Copyright (c) 2017-2018 Marcus Meeßen
 /// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
 
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
 #include <CuteVR/Devices/Controller/Generic.hpp>
 #include <CuteVR/Internal/TestHelper.hpp>
 
+#ifdef CUTE_VR_OPEN_VR
+
 using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
+using Configurations::feature;
+using Configurations::parameter;
+using Devices::Controller::Generic;
+using Emulator::OpenVR::anyDevice;
+using Emulator::OpenVR::vrSystem;
 
 class GenericTest :
         public QObject {
 Q_OBJECT
 
 private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+        vrSystem.isTrackedDeviceConnected_data.unDeviceIndex = anyDevice;
+        vrSystem.isTrackedDeviceConnected_data.returns = true;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void initialize_TrackingOnlyProfile_ProvidesNoInput() {
+        ConfigurationServer::setValue(parameter(Parameter::controllerProfile),
+                                      {static_cast<quint32>(Device::ProviderProfile::trackingOnly)});
+        Generic controller{3};
+        QVERIFY(controller.providerProfile() == Device::ProviderProfile::trackingOnly);
+        controller.initialize();
+        controller.update();
+        QVERIFY(controller.isInitialized());
+        QVERIFY(controller.availability.connected == Extension::yes);
+        QVERIFY(controller.axes.isEmpty());
+        QVERIFY(controller.buttons.isEmpty());
+        QVERIFY(controller.hands.isEmpty());
+        QVERIFY(controller.haptics.isEmpty());
+        QVERIFY(!controller.vibrate(0, {1.0}));
+        controller.destroy();
+        ConfigurationServer::resetValue(parameter(Parameter::controllerProfile));
+    }
+
+    void providerProfile_InvalidValue_FallsBackToFull() {
+        ConfigurationServer::setValue(parameter(Parameter::controllerProfile), {200});
+        Generic controller{3};
+        QVERIFY(controller.providerProfile() == Device::ProviderProfile::full);
+        ConfigurationServer::resetValue(parameter(Parameter::controllerProfile));
+    }
 };
 
 QTEST_APPLESS_MAIN(GenericTest)
 
 #include "Devices/Controller/GenericTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
@@ -0,0 +1,174 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/DriverServer.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
+using Configurations::feature;
+using Configurations::parameter;
+
+/*! @private */
+class FunctorHandler :
+        public Interface::CyclicHandler {
+public: // constructor
+    explicit FunctorHandler(std::function<void()> functor) :
+            functor{std::move(functor)} {}
+
+public: // methods
+    bool handleCyclic(void const *) override {
+        functor();
+        return true;
+    }
+
+private: // variables
+    std::function<void()> functor;
+};
+
+class DriverServerTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        ConfigurationServer::enable(feature(Feature::driverThread));
+        DriverServer::instance().initialize();
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+        ConfigurationServer::reset(feature(Feature::driverThread));
+    }
+
+    void execute_EmptyBatch_DoesNothing() {
+        DriverServer::Batch batch{};
+        QVERIFY(batch.isEmpty());
+        DriverServer::execute(batch, Extension::yes);
+        QVERIFY(batch.isEmpty());
+    }
+
+    void execute_SubmittedCalls_RunInOrder() {
+        QVector<int> order{};
+        DriverServer::Batch batch{};
+        batch.submit([&order] { order.append(1); });
+        batch.submit([&order] { order.append(2); });
+        batch.submit([&order] { order.append(3); });
+        QCOMPARE(batch.size(), 3);
+        DriverServer::execute(batch, Extension::yes);
+        QVERIFY(batch.isEmpty());
+        QCOMPARE(order, (QVector<int>{1, 2, 3}));
+    }
+
+    void execute_RequestedCalls_FuturesHoldResults() {
+        DriverServer::Batch batch{};
+        auto answer{batch.request([] { return 42; })};
+        auto nothing{batch.request([] {})};
+        auto failure{batch.request([]() -> int { DriverServer::CallLocked().raise(); return 0; })};
+        DriverServer::execute(batch, Extension::yes);
+        QCOMPARE(answer.get(), 42);
+        nothing.get();
+        QVERIFY_EXCEPTION_THROWN(failure.get(), DriverServer::CallLocked);
+    }
+
+    void execute_NotExecuted_BreaksPromise() {
+        std::future<int> future{};
+        {
+            DriverServer::Batch batch{};
+            future = batch.request([] { return 1; });
+        }
+        QVERIFY_EXCEPTION_THROWN(future.get(), std::future_error);
+    }
+
+    void synchronized_DriverThread_SerializesOnOneThread() {
+        QThread *first{nullptr};
+        QThread *second{nullptr};
+        DriverServer::synchronized([&first] { first = QThread::currentThread(); }, Extension::yes);
+        auto future{QtConcurrent::run([&second] {
+            DriverServer::synchronized([&second] { second = QThread::currentThread(); }, Extension::yes);
+        })};
+        future.waitForFinished();
+        QVERIFY(first != nullptr);
+        QVERIFY(first != QThread::currentThread());
+        QCOMPARE(first, second);
+    }
+
+    void runCycle_Priorities_CallsHigherFirst() {
+        QVector<int> order{};
+        QSharedPointer<FunctorHandler> low{new FunctorHandler{[&order] { order.append(1); }}};
+        QSharedPointer<FunctorHandler> high{new FunctorHandler{[&order] { order.append(5); }}};
+        DriverServer::Schedule lowSchedule{}, highSchedule{};
+        lowSchedule.priority = 1;
+        highSchedule.priority = 5;
+        DriverServer::announce(low.toWeakRef(), {}, lowSchedule);
+        DriverServer::announce(high.toWeakRef(), {}, highSchedule);
+        DriverServer::runCycle();
+        DriverServer::runCycle();
+        QCOMPARE(order, (QVector<int>{5, 1, 5, 1}));
+    }
+
+    void runCycle_Period_CallsOnlyWhenDue() {
+        auto everyCycle{0}, periodic{0};
+        QSharedPointer<FunctorHandler> fast{new FunctorHandler{[&everyCycle] { everyCycle++; }}};
+        QSharedPointer<FunctorHandler> slow{new FunctorHandler{[&periodic] { periodic++; }}};
+        DriverServer::Schedule schedule{};
+        schedule.period = 60000;
+        DriverServer::announce(fast.toWeakRef());
+        DriverServer::announce(slow.toWeakRef(), {}, schedule);
+        for (auto cycle = 0; cycle < 10; cycle++) {
+            DriverServer::runCycle();
+        }
+        QCOMPARE(everyCycle, 10);
+        QCOMPARE(periodic, 1);
+    }
+
+    void runCycle_BudgetSpent_DefersRemainingHandlers() {
+        ConfigurationServer::setValue(parameter(Parameter::cycleBudget), {1});
+        auto slowCalls{0}, deferredCalls{0};
+        QSharedPointer<FunctorHandler> slow{new FunctorHandler{[&slowCalls] {
+            slowCalls++;
+            QThread::msleep(2);
+        }}};
+        QSharedPointer<FunctorHandler> deferred{new FunctorHandler{[&deferredCalls] { deferredCalls++; }}};
+        DriverServer::Schedule slowSchedule{}, deferredSchedule{};
+        slowSchedule.period = 60000;
+        slowSchedule.priority = 10;
+        deferredSchedule.period = 60000;
+        DriverServer::announce(slow.toWeakRef(), {}, slowSchedule);
+        DriverServer::announce(deferred.toWeakRef(), {}, deferredSchedule);
+        DriverServer::runCycle();
+        QCOMPARE(slowCalls, 1);
+        QCOMPARE(deferredCalls, 0);
+        DriverServer::runCycle();
+        QCOMPARE(slowCalls, 1);
+        QCOMPARE(deferredCalls, 1);
+        ConfigurationServer::resetValue(parameter(Parameter::cycleBudget));
+    }
+
+    void synchronized_NestedCall_RunsInline() {
+        auto depth{0};
+        DriverServer::synchronized([&depth] {
+            depth++;
+            DriverServer::synchronized([&depth] { depth++; }, Extension::yes);
+        }, Extension::yes);
+        QCOMPARE(depth, 2);
+    }
+};
+
+QTEST_APPLESS_MAIN(DriverServerTest)
+
+#include "DriverServerTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
@@ -0,0 +1,138 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <cmath>
+#include <random>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Components/Geometry/Cube.hpp>
+#include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Components/Geometry/Sphere.hpp>
+#include <CuteVR/Internal/BoundaryKernels.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cube;
+using Components::Geometry::Cuboid;
+using Components::Geometry::Sphere;
+using Internal::BoundaryKernels::InstructionSet;
+using Internal::BoundaryKernels::Shape;
+
+namespace BoundaryKernels = Internal::BoundaryKernels;
+
+Q_DECLARE_METATYPE(CuteVR::Internal::Simd::InstructionSet)
+
+class BoundaryKernelsTest :
+        public QObject {
+Q_OBJECT
+
+private: // constants
+    // an odd count covers the remainder that is left over by the vectorized path
+    static constexpr qint32 count{67};
+    static constexpr float tolerance{1.0e-5f};
+
+private: // methods
+    static QVector<QVector3D> makePoints(quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> distribution{-3.0f, 3.0f};
+        QVector<QVector3D> points{};
+        for (auto index = 0; index < count; index++) {
+            points.append(QVector3D{distribution(generator), distribution(generator), distribution(generator)});
+        }
+        return points;
+    }
+
+    static QMatrix4x4 makeTransform() {
+        QMatrix4x4 transform{};
+        transform.translate(0.5f, 1.25f, -0.75f);
+        transform.rotate(37.0f, QVector3D{1.0f, 2.0f, 3.0f}.normalized());
+        return transform;
+    }
+
+private slots: // tests
+    void initTestCase_data() {
+        QTest::addColumn<InstructionSet>("set");
+        QTest::newRow("Scalar") << InstructionSet::scalar;
+        QTest::newRow("SSE2") << InstructionSet::sse2;
+        QTest::newRow("AVX2") << InstructionSet::avx2;
+    }
+
+    void distances_Cuboid_MatchesGeometry() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 1.0;
+        cuboid.c = 3.0;
+        auto const transform{makeTransform()};
+        auto const points{makePoints(1)};
+        QVector<float> result(count);
+        BoundaryKernels::distances(BoundaryKernels::shape(&cuboid), transform.inverted(), points.constData(),
+                                   result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            auto const local{transform.inverted().map(points.at(index))};
+            QVERIFY(qAbs(result.at(index) - cuboid.distance(local)) <= tolerance);
+        }
+    }
+
+    void distances_Sphere_MatchesGeometry() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        Sphere sphere{};
+        sphere.r = 1.5;
+        auto const transform{makeTransform()};
+        auto const points{makePoints(2)};
+        QVector<float> result(count);
+        BoundaryKernels::distances(BoundaryKernels::shape(&sphere), transform.inverted(), points.constData(),
+                                   result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            auto const local{transform.inverted().map(points.at(index))};
+            QVERIFY(qAbs(result.at(index) - sphere.distance(local)) <= tolerance);
+        }
+    }
+
+    void distances_NoShape_IsInfinitelyInside() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const points{makePoints(3)};
+        QVector<float> result(count);
+        BoundaryKernels::distances(Shape{}, {}, points.constData(), result.data(), count, set);
+        for (auto const distance : result) {
+            QVERIFY(std::isinf(distance) && distance < 0.0f);
+        }
+    }
+
+    void shape_Geometries_AreReduced() {
+        Cube cube{};
+        cube.a = 2.0;
+        auto const box{BoundaryKernels::shape(&cube)};
+        QVERIFY(box.type == Shape::Type::box);
+        QVERIFY(box.halfExtents == QVector3D(1.0f, 1.0f, 1.0f));
+        Sphere sphere{};
+        sphere.r = 3.0;
+        auto const ball{BoundaryKernels::shape(&sphere)};
+        QVERIFY(ball.type == Shape::Type::sphere);
+        QCOMPARE(ball.radius, 3.0f);
+        QVERIFY(BoundaryKernels::shape(nullptr).type == Shape::Type::none);
+    }
+
+    void distances_Cuboid_Benchmark() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        Cuboid cuboid{};
+        cuboid.a = 2.0;
+        cuboid.b = 1.0;
+        cuboid.c = 3.0;
+        auto const shape{BoundaryKernels::shape(&cuboid)};
+        auto const toShape{makeTransform().inverted()};
+        auto const points{makePoints(4)};
+        QVector<float> result(count);
+        QBENCHMARK {
+            BoundaryKernels::distances(shape, toShape, points.constData(), result.data(), count, set);
+        }
+    }
+};
+
+constexpr qint32 BoundaryKernelsTest::count;
+constexpr float BoundaryKernelsTest::tolerance;
+
+QTEST_APPLESS_MAIN(BoundaryKernelsTest)
+
+#include "Internal/BoundaryKernelsTest.moc"
@@ -0,0 +1,73 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Internal/BoundaryMonitor.hpp>
+
+using namespace CuteVR;
+using Components::Geometry::Cuboid;
+using Internal::BoundaryMonitor;
+
+class BoundaryMonitorTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    /// a play area of 4 x 2 x 3 meters that stands on the floor
+    static System::Cell::Boundary makeBoundary() {
+        QSharedPointer<Cuboid> cuboid{new Cuboid{}};
+        cuboid->a = 4.0;
+        cuboid->b = 2.0;
+        cuboid->c = 3.0;
+        System::Cell::Boundary boundary{};
+        boundary.first.translate(0.0f, 1.0f, 0.0f);
+        boundary.second = cuboid;
+        return boundary;
+    }
+
+private slots: // tests
+    void classify_Distances_AreStates() {
+        QVERIFY(BoundaryMonitor::classify(-1.0, 0.5) == System::BoundaryState::inside);
+        QVERIFY(BoundaryMonitor::classify(-0.25, 0.5) == System::BoundaryState::near);
+        QVERIFY(BoundaryMonitor::classify(0.0, 0.5) == System::BoundaryState::near);
+        QVERIFY(BoundaryMonitor::classify(0.25, 0.5) == System::BoundaryState::outside);
+    }
+
+    void evaluate_FirstInside_ReportsNoTransition() {
+        BoundaryMonitor monitor{};
+        auto const evaluation{monitor.evaluate(makeBoundary(), {{1, {0.0f, 1.0f, 0.0f}}}, 0.5)};
+        QVERIFY(evaluation.transitions.isEmpty());
+        QCOMPARE(evaluation.distances.value(1), -1.0);
+    }
+
+    void evaluate_StateChanges_ReportsOnlyTransitions() {
+        BoundaryMonitor monitor{};
+        auto const boundary{makeBoundary()};
+        monitor.evaluate(boundary, {{1, {0.0f, 1.0f, 0.0f}}, {2, {0.0f, 1.0f, 0.0f}}}, 0.5);
+        auto evaluation{monitor.evaluate(boundary, {{1, {1.75f, 1.0f, 0.0f}}, {2, {0.0f, 1.0f, 0.0f}}}, 0.5)};
+        QCOMPARE(evaluation.transitions.size(), 1);
+        QCOMPARE(evaluation.transitions.first().device, Identifier{1});
+        QVERIFY(evaluation.transitions.first().state == System::BoundaryState::near);
+        evaluation = monitor.evaluate(boundary, {{1, {1.75f, 1.0f, 0.0f}}, {2, {0.0f, 1.0f, 0.0f}}}, 0.5);
+        QVERIFY(evaluation.transitions.isEmpty());
+        evaluation = monitor.evaluate(boundary, {{1, {0.0f, 1.0f, 0.0f}}, {2, {0.0f, 1.0f, 2.0f}}}, 0.5);
+        QCOMPARE(evaluation.transitions.size(), 2);
+        QVERIFY(evaluation.transitions.at(0).state == System::BoundaryState::inside);
+        QVERIFY(evaluation.transitions.at(1).state == System::BoundaryState::outside);
+    }
+
+    void evaluate_NoGeometry_EvaluatesNothing() {
+        BoundaryMonitor monitor{};
+        auto const evaluation{monitor.evaluate({}, {{1, {10.0f, 0.0f, 0.0f}}}, 0.5)};
+        QVERIFY(evaluation.distances.isEmpty());
+        QVERIFY(evaluation.transitions.isEmpty());
+    }
+};
+
+QTEST_APPLESS_MAIN(BoundaryMonitorTest)
+
+#include "Internal/BoundaryMonitorTest.moc"
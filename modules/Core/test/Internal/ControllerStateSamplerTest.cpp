@@ -0,0 +1,127 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/ControllerStateSampler.hpp>
+#include <CuteVR/Internal/DefaultButtonsProvider.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Components::Input::Button;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using Emulator::OpenVR::vrSystem;
+using Extension::Trilean;
+using Interface::CyclicHandler;
+using Internal::ControllerStateSampler;
+using Internal::DefaultButtonsProvider;
+
+/*! @private */
+class StateConsumer :
+        public CyclicHandler {
+public: // methods
+    bool handleCyclic(void const *data) override {
+        calls++;
+        pressed = static_cast<vr::VRControllerState_t const *>(data)->ulButtonPressed;
+        return true;
+    }
+
+public: // variables
+    qint32 calls{0};
+    quint64 pressed{0};
+};
+
+class ControllerStateSamplerTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+        vrSystem.getControllerState_data.unControllerDeviceIndex = 3;
+        vrSystem.getControllerState_data.unControllerStateSize = sizeof(vr::VRControllerState_t);
+        vrSystem.getControllerState_data.returns = true;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void handleCyclic_UnchangedPacket_SkipsConsumers() {
+        QSharedPointer<StateConsumer> consumer{new StateConsumer};
+        ControllerStateSampler sampler{3, {consumer.staticCast<CyclicHandler>().toWeakRef()}};
+        vrSystem.getControllerState_data.pControllerState = {};
+        vrSystem.getControllerState_data.pControllerState.unPacketNum = 1;
+        vrSystem.getControllerState_data.pControllerState.ulButtonPressed = 0b100;
+        QVERIFY(sampler.handleCyclic(nullptr));
+        QVERIFY(!sampler.handleCyclic(nullptr));
+        QCOMPARE(consumer->calls, 1);
+        QCOMPARE(consumer->pressed, quint64{0b100});
+        vrSystem.getControllerState_data.pControllerState.unPacketNum = 2;
+        vrSystem.getControllerState_data.pControllerState.ulButtonPressed = 0b110;
+        QVERIFY(sampler.handleCyclic(nullptr));
+        QCOMPARE(consumer->calls, 2);
+        QCOMPARE(consumer->pressed, quint64{0b110});
+        QCOMPARE(sampler.samples(), quint64{2});
+    }
+
+    void handleCyclic_Chord_ReportsOnlyTransitions() {
+        vrSystem.getUint64TrackedDeviceProperty_data.unDeviceIndex = 3;
+        vrSystem.getUint64TrackedDeviceProperty_data.prop = vr::Prop_SupportedButtons_Uint64;
+        vrSystem.getUint64TrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getUint64TrackedDeviceProperty_data.returns = vr::ButtonMaskFromId(vr::k_EButton_ApplicationMenu) |
+                                                               vr::ButtonMaskFromId(vr::k_EButton_Grip) |
+                                                               vr::ButtonMaskFromId(vr::k_EButton_SteamVR_Trigger);
+        QList<Button> buttons{};
+        QSharedPointer<DefaultButtonsProvider> provider{
+                new DefaultButtonsProvider{3, [&buttons](Button const &button) { buttons.append(button); }}};
+        ControllerStateSampler sampler{3, {provider.staticCast<CyclicHandler>().toWeakRef()}};
+        vrSystem.getControllerState_data.pControllerState = {};
+        vrSystem.getControllerState_data.pControllerState.unPacketNum = 10;
+        sampler.handleCyclic(nullptr);
+        QCOMPARE(buttons.size(), 3);
+        buttons.clear();
+        vrSystem.getControllerState_data.pControllerState.unPacketNum = 11;
+        vrSystem.getControllerState_data.pControllerState.ulButtonPressed =
+                vr::ButtonMaskFromId(vr::k_EButton_Grip) | vr::ButtonMaskFromId(vr::k_EButton_SteamVR_Trigger);
+        sampler.handleCyclic(nullptr);
+        QCOMPARE(buttons.size(), 2);
+        for (auto const &button : buttons) {
+            QVERIFY(button.pressed == Trilean::yes);
+            QVERIFY(button.touched == Trilean::no);
+        }
+        buttons.clear();
+        vr::VREvent_t vrEvent{};
+        vrEvent.eventType = vr::VREvent_ButtonUnpress;
+        vrEvent.trackedDeviceIndex = 3;
+        vrEvent.data.controller.button = vr::k_EButton_Grip;
+        QVERIFY(provider->handleEvent(&vrEvent, nullptr));
+        QCOMPARE(buttons.size(), 1);
+        QCOMPARE(buttons.first().identifier, Identifier{vr::k_EButton_Grip});
+        QVERIFY(buttons.first().pressed == Trilean::no);
+    }
+
+    void handleCyclic_UnchangedPacket_Benchmark() {
+        QSharedPointer<StateConsumer> consumer{new StateConsumer};
+        ControllerStateSampler sampler{3, {consumer.staticCast<CyclicHandler>().toWeakRef()}};
+        QBENCHMARK {
+            sampler.handleCyclic(nullptr);
+        }
+        QCOMPARE(consumer->calls, 1);
+    }
+};
+
+QTEST_APPLESS_MAIN(ControllerStateSamplerTest)
+
+#include "Internal/ControllerStateSamplerTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
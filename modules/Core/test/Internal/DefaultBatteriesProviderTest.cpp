@@ -0,0 +1,19 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/DefaultBatteriesProvider.hpp>
+
+class DefaultBatteriesProviderTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+};
+
+QTEST_APPLESS_MAIN(DefaultBatteriesProviderTest)
+
+#include "Internal/DefaultBatteriesProviderTest.moc"
@@ -5,15 +5,97 @@
 
 #include <QtTest/QtTest>
 
+#include <CuteVR/Configurations/CoreProfile.hpp>
 #include <CuteVR/Internal/DefaultPoseProvider.hpp>
 
+#ifdef CUTE_VR_OPEN_VR
+
+#include <openvr.h>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Components::Pose;
+using Internal::DefaultPoseProvider;
+
+namespace Profile = Configurations::Core::Profile;
+
 class DefaultPoseProviderTest :
         public QObject {
 Q_OBJECT
 
 private slots: // tests
+    void handleTracking_Nullptr_ReturnsFalse() {
+        DefaultPoseProvider provider{0, [](DefaultPoseProvider::Sample const &) {
+            QFAIL("Callback must not be called.");
+        }};
+        QVERIFY(!provider.handleTracking(nullptr));
+    }
+
+    void handleTracking_ValidPose_CallsBack() {
+        vr::TrackedDevicePose_t vrPose{};
+        vrPose.bPoseIsValid = true;
+        vrPose.mDeviceToAbsoluteTracking = {{{1.0f, 0.0f, 0.0f, 1.0f},
+                                             {0.0f, 1.0f, 0.0f, 2.0f},
+                                             {0.0f, 0.0f, 1.0f, 3.0f}}};
+        CompactPose result{};
+        DefaultPoseProvider provider{0, [&result](DefaultPoseProvider::Sample const &sample) {
+            result = sample.compact;
+        }};
+        QVERIFY(provider.handleTracking(&vrPose));
+        QVERIFY(result.valid() == Extension::yes);
+        QVERIFY(result.position == QVector3D(1.0f, 2.0f, 3.0f));
+        QVERIFY(result.orientation == QQuaternion{});
+    }
+
+    void handleTracking_RotatedPose_KeepsExactMatrix() {
+        vr::TrackedDevicePose_t vrPose{};
+        vrPose.bPoseIsValid = true;
+        vrPose.mDeviceToAbsoluteTracking = {{{0.36f, 0.48f, -0.8f, 0.1f},
+                                             {-0.8f, 0.6f, 0.0f, 0.2f},
+                                             {0.48f, 0.64f, 0.6f, 0.3f}}};
+        Pose result{};
+        DefaultPoseProvider provider{0, [&result](DefaultPoseProvider::Sample const &sample) {
+            result = sample.pose;
+        }};
+        QVERIFY(provider.handleTracking(&vrPose));
+        for (auto row = 0; row < 3; row++) {
+            for (auto column = 0; column < 4; column++) {
+                QCOMPARE(result.poseTransform(row, column), vrPose.mDeviceToAbsoluteTracking.m[row][column]);
+            }
+        }
+    }
+
+    void handleTracking_Velocities_AreAlwaysProvided() {
+        vr::TrackedDevicePose_t vrPose{};
+        vrPose.vVelocity = {{1.0f, 2.0f, 3.0f}};
+        vrPose.vAngularVelocity = {{4.0f, 5.0f, 6.0f}};
+        CompactPose result{};
+        DefaultPoseProvider provider{0, [&result](DefaultPoseProvider::Sample const &sample) {
+            result = sample.compact;
+        }};
+        QVERIFY(provider.handleTracking(&vrPose));
+        QVERIFY(result.valid() == Extension::no);
+        QVERIFY(result.linearVelocity == QVector3D(1.0f, 2.0f, 3.0f));
+        QVERIFY(result.angularVelocity == QVector3D(4.0f, 5.0f, 6.0f));
+        QCOMPARE(static_cast<bool>(result.flags & CompactPose::hasLinearVelocity),
+                 Profile::isEnabled<Configurations::Core::Feature::linearVelocity>());
+    }
+
+    void handleTracking_ValidPose_Benchmark() {
+        qInfo("Measuring per-frame cost with core profile '%s'.", Profile::name);
+        vr::TrackedDevicePose_t vrPose{};
+        vrPose.bPoseIsValid = true;
+        quint64 calls{0};
+        DefaultPoseProvider provider{0, [&calls](DefaultPoseProvider::Sample const &) { calls++; }};
+        QBENCHMARK {
+            provider.handleTracking(&vrPose);
+        }
+        QVERIFY(calls > 0);
+    }
 };
 
 QTEST_APPLESS_MAIN(DefaultPoseProviderTest)
 
 #include "Internal/DefaultPoseProviderTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
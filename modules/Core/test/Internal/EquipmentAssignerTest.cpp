@@ -0,0 +1,158 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/EquipmentAssigner.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Internal::EquipmentAssigner;
+
+class EquipmentAssignerTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static CompactPose makePose(QVector3D const &position, QVector3D const &velocity = {}) {
+        CompactPose pose{};
+        pose.position = position;
+        pose.linearVelocity = velocity;
+        pose.flags = CompactPose::isValid | CompactPose::hasLinearVelocity;
+        return pose;
+    }
+
+    /// two users who stand two meters apart
+    static QMap<Identifier, CompactPose> makeUsers() {
+        return {{0, makePose({0.0f, 1.7f, 0.0f})}, {1, makePose({2.0f, 1.7f, 0.0f})}};
+    }
+
+    static EquipmentAssigner::Tuning makeTuning() {
+        EquipmentAssigner::Tuning tuning{};
+        tuning.window = 10;
+        tuning.hysteresis = 0.15;
+        tuning.persistence = 5;
+        return tuning;
+    }
+
+private: // variables
+    quint64 trackingFrame{0};
+
+private slots: // tests
+    void assign_UnassignedControllers_TakeNearest() {
+        EquipmentAssigner assigner{};
+        QMap<Identifier, CompactPose> const controllers{{3, makePose({0.3f, 1.0f, 0.0f})},
+                                                        {4, makePose({1.8f, 1.0f, 0.0f})}};
+        auto const reassignments{assigner.assign(++trackingFrame, makeUsers(), controllers, makeTuning())};
+        QCOMPARE(reassignments.size(), 2);
+        QCOMPARE(reassignments.first().controller, Identifier{3});
+        QCOMPARE(reassignments.first().previous, invalidIdentifier);
+        QCOMPARE(reassignments.first().headMountedDisplay, Identifier{0});
+        QCOMPARE(assigner.assignment(4), Identifier{1});
+        QVERIFY(assigner.assign(++trackingFrame, makeUsers(), controllers, makeTuning()).isEmpty());
+    }
+
+    void assign_HandedOverController_WaitsForPersistence() {
+        EquipmentAssigner assigner{};
+        auto const tuning{makeTuning()};
+        for (auto frame = 0; frame < tuning.window; frame++) {
+            assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({0.3f, 1.0f, 0.0f})}}, tuning);
+        }
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+        // the window still remembers the old holder, so the new one must first catch up and then persist
+        auto frames{0};
+        QList<EquipmentAssigner::Reassignment> reassignments{};
+        while (reassignments.isEmpty() && frames < 2 * tuning.window + tuning.persistence) {
+            reassignments = assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({1.7f, 1.0f, 0.0f})}}, tuning);
+            frames++;
+        }
+        QCOMPARE(reassignments.size(), 1);
+        QCOMPARE(reassignments.first().previous, Identifier{0});
+        QCOMPARE(reassignments.first().headMountedDisplay, Identifier{1});
+        QVERIFY(frames >= tuning.persistence);
+        QVERIFY(frames <= tuning.window + tuning.persistence);
+    }
+
+    void assign_SameFrame_IsIgnored() {
+        EquipmentAssigner assigner{};
+        auto tuning{makeTuning()};
+        tuning.persistence = 2;
+        assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({0.3f, 1.0f, 0.0f})}}, tuning);
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+        // repeated updates within one tracking frame neither fill the window nor count towards the persistence
+        for (auto update = 0; update < 100; update++) {
+            QVERIFY(assigner.assign(trackingFrame, makeUsers(), {{3, makePose({1.7f, 1.0f, 0.0f})}}, tuning).isEmpty());
+        }
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+    }
+
+    void assign_ControllerBetweenUsers_DoesNotFlap() {
+        EquipmentAssigner assigner{};
+        auto const tuning{makeTuning()};
+        assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({0.9f, 1.0f, 0.0f})}}, tuning);
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+        for (auto frame = 0; frame < 100; frame++) {
+            auto const x{frame % 2 == 0 ? 0.95f : 1.05f};
+            QVERIFY(assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({x, 1.0f, 0.0f})}}, tuning).isEmpty());
+        }
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+    }
+
+    void assign_CommonMotion_DecidesBetweenEqualDistances() {
+        EquipmentAssigner assigner{};
+        QMap<Identifier, CompactPose> const users{{0, makePose({0.0f, 1.7f, 0.0f}, {1.0f, 0.0f, 0.0f})},
+                                                  {1, makePose({2.0f, 1.7f, 0.0f})}};
+        auto const reassignments{assigner.assign(++trackingFrame, users, {{3, makePose({1.0f, 1.7f, 0.0f})}},
+                                                 makeTuning())};
+        QCOMPARE(reassignments.size(), 1);
+        QCOMPARE(reassignments.first().headMountedDisplay, Identifier{1});
+        assigner.clear();
+        assigner.assign(++trackingFrame, users, {{3, makePose({1.0f, 1.7f, 0.0f}, {1.0f, 0.0f, 0.0f})}}, makeTuning());
+        QCOMPARE(assigner.assignment(3), Identifier{0});
+    }
+
+    void assign_InvalidPoses_KeepAssignment() {
+        EquipmentAssigner assigner{};
+        assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({1.8f, 1.0f, 0.0f})}}, makeTuning());
+        auto users{makeUsers()};
+        users[1].flags = CompactPose::isInvalid;
+        QVERIFY(assigner.assign(++trackingFrame, users, {{3, makePose({0.1f, 1.0f, 0.0f})}}, makeTuning()).isEmpty());
+        QVERIFY(assigner.assign(++trackingFrame, makeUsers(), {{3, CompactPose{}}}, makeTuning()).isEmpty());
+        QCOMPARE(assigner.assignment(3), Identifier{1});
+    }
+
+    void remove_HeadMountedDisplay_ReassignsItsControllers() {
+        EquipmentAssigner assigner{};
+        assigner.assign(++trackingFrame, makeUsers(), {{3, makePose({1.8f, 1.0f, 0.0f})}}, makeTuning());
+        assigner.remove(1);
+        QCOMPARE(assigner.assignment(3), invalidIdentifier);
+        auto const reassignments{assigner.assign(++trackingFrame, {{0, makePose({0.0f, 1.7f, 0.0f})}},
+                                                 {{3, makePose({1.8f, 1.0f, 0.0f})}}, makeTuning())};
+        QCOMPARE(reassignments.size(), 1);
+        QCOMPARE(reassignments.first().previous, invalidIdentifier);
+        QCOMPARE(reassignments.first().headMountedDisplay, Identifier{0});
+    }
+
+    void assign_ManySettledControllers_Benchmark() {
+        EquipmentAssigner assigner{};
+        QMap<Identifier, CompactPose> users{};
+        QMap<Identifier, CompactPose> controllers{};
+        // sixteen users on a grid of three meters, each with a controller in both hands
+        for (auto user = 0; user < 16; user++) {
+            QVector3D const position{3.0f * static_cast<float>(user % 4), 1.7f, 3.0f * static_cast<float>(user / 4)};
+            users.insert(static_cast<Identifier>(user), makePose(position));
+            auto const controller{static_cast<Identifier>(100 + 2 * user)};
+            controllers.insert(controller, makePose(position + QVector3D{-0.3f, -0.5f, 0.0f}));
+            controllers.insert(controller + 1, makePose(position + QVector3D{0.3f, -0.5f, 0.0f}));
+        }
+        QBENCHMARK {
+            assigner.assign(++trackingFrame, users, controllers, makeTuning());
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(EquipmentAssignerTest)
+
+#include "Internal/EquipmentAssignerTest.moc"
@@ -0,0 +1,130 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/EyeMatricesStage.hpp>
+
+using namespace CuteVR;
+using Components::Interaction::Eye;
+using Components::Interaction::EyeMatrices;
+using Internal::EyeMatricesStage;
+
+class EyeMatricesStageTest :
+        public QObject {
+Q_OBJECT
+
+private: // constants
+    static constexpr float tolerance{1.0e-5f};
+
+private: // methods
+    static bool isClose(QMatrix4x4 const &left, QMatrix4x4 const &right) {
+        for (auto index = 0; index < 16; index++) {
+            if (qAbs(left.constData()[index] - right.constData()[index]) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static QMap<Identifier, Eye> makeEyes(float const ipd) {
+        QMap<Identifier, Eye> eyes{};
+        for (auto const type : {Eye::Type::left, Eye::Type::right}) {
+            Eye eye{};
+            eye.identifier = static_cast<Identifier>(type);
+            eye.type = type;
+            eye.perspectiveProjection.frustum(-0.1f, 0.12f, -0.11f, 0.1f, 0.05f, 500.0f);
+            eye.headTransform.translate((type == Eye::Type::left ? -0.5f : 0.5f) * ipd, 0.0f, 0.015f);
+            eyes.insert(eye.identifier, eye);
+        }
+        return eyes;
+    }
+
+    static QMatrix4x4 makePose(float const angle) {
+        QMatrix4x4 pose{};
+        pose.translate(0.3f, 1.7f, -0.4f);
+        pose.rotate(angle, 0.2f, 1.0f, 0.1f);
+        return pose;
+    }
+
+private slots: // tests
+    void update_PoseGiven_MatchesGeneralInverse() {
+        EyeMatricesStage stage{};
+        auto const eyes{makeEyes(0.064f)};
+        auto const pose{makePose(35.0f)};
+        stage.setEyes(eyes);
+        QVERIFY(stage.update(pose));
+        QCOMPARE(stage.matrices().size(), eyes.size());
+        for (auto const &eye : eyes) {
+            auto const &matrices{stage.matrices().value(eye.identifier)};
+            auto const eyeToWorld{pose * eye.headTransform};
+            QVERIFY(isClose(matrices.view, eyeToWorld.inverted()));
+            QVERIFY(isClose(matrices.inverseView, eyeToWorld));
+            QVERIFY(matrices.projection == eye.perspectiveProjection);
+            QVERIFY(isClose(matrices.viewProjection, eye.perspectiveProjection * eyeToWorld.inverted()));
+            QVERIFY(isClose(matrices.inverseProjection * matrices.projection, QMatrix4x4{}));
+            QVERIFY(isClose(matrices.inverseViewProjection * matrices.viewProjection, QMatrix4x4{}));
+        }
+    }
+
+    void update_NothingChanged_ReturnsFalse() {
+        EyeMatricesStage stage{};
+        stage.setEyes(makeEyes(0.064f));
+        QVERIFY(stage.update(makePose(10.0f)));
+        QVERIFY(!stage.update(makePose(10.0f)));
+        stage.setEyes(makeEyes(0.064f));
+        QVERIFY(!stage.update(makePose(10.0f)));
+        QVERIFY(stage.update(makePose(11.0f)));
+    }
+
+    void update_EyeChanged_ReturnsTrue() {
+        EyeMatricesStage stage{};
+        stage.setEyes(makeEyes(0.064f));
+        QVERIFY(stage.update(makePose(10.0f)));
+        auto const before{stage.matrices()};
+        stage.setEyes(makeEyes(0.068f));
+        QVERIFY(stage.update(makePose(10.0f)));
+        QVERIFY(stage.matrices() != before);
+        stage.setEyes({});
+        QVERIFY(stage.update(makePose(10.0f)));
+        QVERIFY(stage.matrices().isEmpty());
+    }
+
+    void update_MovingPose_Benchmark() {
+        EyeMatricesStage stage{};
+        stage.setEyes(makeEyes(0.064f));
+        auto angle{0.0f};
+        QBENCHMARK {
+            stage.update(makePose(angle));
+            angle += 1.0f;
+        }
+    }
+
+    void update_GeneralInverse_Benchmark() {
+        auto const eyes{makeEyes(0.064f)};
+        auto angle{0.0f};
+        QMap<Identifier, EyeMatrices> result{};
+        QBENCHMARK {
+            auto const pose{makePose(angle)};
+            for (auto const &eye : eyes) {
+                EyeMatrices matrices{};
+                matrices.inverseView = pose * eye.headTransform;
+                matrices.view = matrices.inverseView.inverted();
+                matrices.projection = eye.perspectiveProjection;
+                matrices.inverseProjection = eye.perspectiveProjection.inverted();
+                matrices.viewProjection = matrices.projection * matrices.view;
+                matrices.inverseViewProjection = matrices.viewProjection.inverted();
+                result.insert(eye.identifier, matrices);
+            }
+            angle += 1.0f;
+        }
+    }
+};
+
+constexpr float EyeMatricesStageTest::tolerance;
+
+QTEST_APPLESS_MAIN(EyeMatricesStageTest)
+
+#include "Internal/EyeMatricesStageTest.moc"
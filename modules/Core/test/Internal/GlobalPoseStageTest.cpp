@@ -0,0 +1,189 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <random>
+#include <QtGui/QMatrix4x4>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/GlobalPoseStage.hpp>
+#include <CuteVR/Internal/TrackingFrame.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Internal::GlobalPoseStage;
+using Internal::TransformKernels::InstructionSet;
+using Internal::TransformKernels::Rigid;
+
+Q_DECLARE_METATYPE(CuteVR::Internal::Simd::InstructionSet)
+
+class GlobalPoseStageTest :
+        public QObject {
+Q_OBJECT
+
+private: // constants
+    // an odd count covers the remainder that is left over by the vectorized path
+    static constexpr qint32 count{67};
+    static constexpr float tolerance{1.0e-5f};
+
+private: // methods
+    static bool isClose(QVector3D const &left, QVector3D const &right) {
+        return qAbs(left.x() - right.x()) <= tolerance && qAbs(left.y() - right.y()) <= tolerance &&
+               qAbs(left.z() - right.z()) <= tolerance;
+    }
+
+    // quaternions are compared by their rotations, since q and -q describe the same one
+    static bool isClose(QQuaternion const &left, QQuaternion const &right) {
+        return isClose(left.rotatedVector({1.0f, 0.0f, 0.0f}), right.rotatedVector({1.0f, 0.0f, 0.0f})) &&
+               isClose(left.rotatedVector({0.0f, 1.0f, 0.0f}), right.rotatedVector({0.0f, 1.0f, 0.0f}));
+    }
+
+    static QMatrix4x4 matrix(Rigid const &rigid) {
+        QMatrix4x4 matrix{rigid.rotation.toRotationMatrix()};
+        matrix.setColumn(3, QVector4D{rigid.translation, 1.0f});
+        return matrix;
+    }
+
+    static QVector<Rigid> makeRigids(quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> distribution{-1.0f, 1.0f};
+        QVector<Rigid> rigids(count);
+        for (auto &rigid : rigids) {
+            rigid.rotation = QQuaternion{distribution(generator), distribution(generator), distribution(generator),
+                                         distribution(generator)}.normalized();
+            rigid.translation = QVector3D{distribution(generator), distribution(generator), distribution(generator)};
+        }
+        return rigids;
+    }
+
+    static QVector<CompactPose> makePoses(quint32 const seed) {
+        auto const rigids{makeRigids(seed)};
+        auto const velocities{makeRigids(seed + 1)};
+        QVector<CompactPose> poses(count);
+        for (auto index = 0; index < count; index++) {
+            poses[index].position = rigids.at(index).translation;
+            poses[index].orientation = rigids.at(index).rotation;
+            poses[index].linearVelocity = velocities.at(index).translation;
+            poses[index].angularVelocity = velocities.at(index).rotation.vector();
+            poses[index].flags = static_cast<quint8>(index % 16);
+        }
+        return poses;
+    }
+
+    static void verify(QVector<Rigid> const &transforms, QVector<CompactPose> const &poses,
+                       QVector<CompactPose> const &result) {
+        for (auto index = 0; index < count; index++) {
+            auto const &transform{transforms.at(index)};
+            auto const &pose{poses.at(index)};
+            auto const expected{matrix(transform) * pose.toPose().poseTransform};
+            QVERIFY(isClose(result.at(index).position, expected.column(3).toVector3D()));
+            QVERIFY(isClose(result.at(index).orientation,
+                            QQuaternion::fromRotationMatrix(expected.toGenericMatrix<3, 3>())));
+            QVERIFY(isClose(result.at(index).linearVelocity, transform.rotation.rotatedVector(pose.linearVelocity)));
+            QVERIFY(isClose(result.at(index).angularVelocity, transform.rotation.rotatedVector(pose.angularVelocity)));
+            QCOMPARE(result.at(index).flags, pose.flags);
+        }
+    }
+
+private slots: // tests
+    void initTestCase_data() {
+        QTest::addColumn<InstructionSet>("set");
+        QTest::newRow("Scalar") << InstructionSet::scalar;
+        QTest::newRow("SSE2") << InstructionSet::sse2;
+        QTest::newRow("AVX2") << InstructionSet::avx2;
+    }
+
+    void apply_Poses_MatchesMatrices() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const transforms{makeRigids(1)};
+        auto const poses{makePoses(2)};
+        QVector<CompactPose> result(count);
+        GlobalPoseStage::apply(transforms.constData(), poses.constData(), result.data(), count, set);
+        verify(transforms, poses, result);
+    }
+
+    void apply_InPlace_MatchesMatrices() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const transforms{makeRigids(4)};
+        auto const poses{makePoses(5)};
+        auto result{poses};
+        auto *const data{result.data()};
+        GlobalPoseStage::apply(transforms.constData(), data, data, count, set);
+        verify(transforms, poses, result);
+    }
+
+    void apply_Identity_KeepsPoses() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        QVector<Rigid> const transforms(count);
+        auto const poses{makePoses(7)};
+        QVector<CompactPose> result(count);
+        GlobalPoseStage::apply(transforms.constData(), poses.constData(), result.data(), count, set);
+        verify(transforms, poses, result);
+    }
+
+    void rigid_Matrix_SplitsRotationAndTranslation() {
+        for (auto const &expected : makeRigids(8)) {
+            auto const rigid{GlobalPoseStage::rigid(matrix(expected))};
+            QVERIFY(isClose(rigid.rotation, expected.rotation));
+            QVERIFY(isClose(rigid.translation, expected.translation));
+        }
+    }
+
+    void snapshot_NoFrame_IsEmpty() {
+        GlobalPoseStage stage{};
+        QVERIFY(stage.snapshot().cellPoses.isEmpty());
+        QVERIFY(stage.snapshot().globalPoses.isEmpty());
+        QCOMPARE(stage.snapshot().frame, quint64{0});
+        QVERIFY(!stage.handleTracking(nullptr));
+        QVERIFY(!stage.handleEvent(nullptr, nullptr));
+    }
+
+#ifdef CUTE_VR_OPEN_VR
+    void handleTracking_CellTransform_ReachesGlobalPoses() {
+        GlobalPoseStage stage{};
+        QMatrix4x4 transform{};
+        transform.translate(2.0f, 0.0f, -1.0f);
+        transform.rotate(90.0f, 0.0f, 1.0f, 0.0f);
+        stage.setCellTransforms({{1, transform}});
+        vr::TrackedDevicePose_t poses[2]{};
+        for (auto &pose : poses) {
+            pose.mDeviceToAbsoluteTracking.m[0][0] = 1.0f;
+            pose.mDeviceToAbsoluteTracking.m[1][1] = 1.0f;
+            pose.mDeviceToAbsoluteTracking.m[2][2] = 1.0f;
+            pose.mDeviceToAbsoluteTracking.m[0][3] = 0.5f;
+            pose.mDeviceToAbsoluteTracking.m[1][3] = 1.5f;
+            pose.bPoseIsValid = true;
+            pose.bDeviceIsConnected = true;
+        }
+        Internal::TrackingFrame const frame{poses, 2, vr::TrackingUniverseStanding};
+        QVERIFY(stage.handleTracking(&frame));
+        auto const snapshot{stage.snapshot()};
+        QCOMPARE(snapshot.frame, quint64{1});
+        QCOMPARE(snapshot.globalPoses.size(), 2);
+        // a device without a surrounding cell keeps its pose, the other one is moved by the transform of its cell
+        QVERIFY(isClose(snapshot.cellPoses.value(1).position, {0.5f, 1.5f, 0.0f}));
+        QVERIFY(isClose(snapshot.globalPoses.value(0).position, {0.5f, 1.5f, 0.0f}));
+        QVERIFY(isClose(snapshot.globalPoses.value(1).position, transform * QVector3D{0.5f, 1.5f, 0.0f}));
+        QVERIFY(isClose(snapshot.globalPoses.value(1).orientation,
+                        QQuaternion::fromAxisAndAngle(0.0f, 1.0f, 0.0f, 90.0f)));
+    }
+#endif // CUTE_VR_OPEN_VR
+
+    void apply_Poses_Benchmark() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const transforms{makeRigids(10)};
+        auto poses{makePoses(11)};
+        auto *const data{poses.data()};
+        QBENCHMARK {
+            GlobalPoseStage::apply(transforms.constData(), data, data, count, set);
+        }
+    }
+};
+
+constexpr qint32 GlobalPoseStageTest::count;
+constexpr float GlobalPoseStageTest::tolerance;
+
+QTEST_APPLESS_MAIN(GlobalPoseStageTest)
+
+#include "Internal/GlobalPoseStageTest.moc"
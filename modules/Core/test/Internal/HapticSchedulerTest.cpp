@@ -0,0 +1,95 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/HapticScheduler.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using Emulator::OpenVR::vrSystem;
+using Internal::HapticScheduler;
+
+class HapticSchedulerTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+        vrSystem.triggerHapticPulse_data.unControllerDeviceIndex = 3;
+        vrSystem.triggerHapticPulse_data.unAxisId = 0;
+        vrSystem.triggerHapticPulse_data.usDurationMicroSec = HapticScheduler::maximumPulse;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void submit_OverlappingEnvelopes_MergesPulses() {
+        HapticScheduler::resetStatistics();
+        vrSystem.triggerHapticPulse_data.calls = 0;
+        QVERIFY(HapticScheduler::submit(3, 0, {1.0, 1.0, 1.0}));
+        QVERIFY(HapticScheduler::submit(3, 0, {1.0, 1.0, 0.0, 1.0}));
+        QElapsedTimer timer{};
+        timer.start();
+        while (HapticScheduler::pulses() < 4 && timer.elapsed() < 5000) {
+            QThread::msleep(5);
+        }
+        QThread::msleep(4 * HapticScheduler::interval / 1000);
+        // the second envelope only extends the first one by its last amplitude
+        QCOMPARE(HapticScheduler::pulses(), quint64{4});
+        QCOMPARE(vrSystem.triggerHapticPulse_data.calls.load(), 4u);
+        QCOMPARE(HapticScheduler::merged(), quint64{2});
+        QCOMPARE(HapticScheduler::dropped(), quint64{0});
+    }
+
+    void cancel_ScheduledEnvelope_StopsPulses() {
+        HapticScheduler::resetStatistics();
+        QVector<qreal> const envelope(200, 1.0);
+        QVERIFY(HapticScheduler::submit(3, 0, envelope));
+        HapticScheduler::cancel(3);
+        QThread::msleep(20 * HapticScheduler::interval / 1000);
+        QVERIFY(HapticScheduler::pulses() < 10);
+    }
+
+    void cancel_FullQueue_StopsPulses() {
+        HapticScheduler::resetStatistics();
+        QVector<qreal> const envelope(200, 1.0);
+        QVERIFY(HapticScheduler::submit(3, 0, envelope));
+        QThread::msleep(2 * HapticScheduler::interval / 1000);
+        // silent requests of another device flood the queue until it drops them
+        for (auto request = 0; request < 4 * HapticScheduler::depth; request++) {
+            if (!HapticScheduler::submit(5, 0, {0.0})) {
+                break;
+            }
+        }
+        HapticScheduler::cancel(3);
+        auto const pulses{HapticScheduler::pulses()};
+        QThread::msleep(20 * HapticScheduler::interval / 1000);
+        QVERIFY(HapticScheduler::pulses() - pulses < 3);
+    }
+
+    void submit_CallerThread_Benchmark() {
+        QBENCHMARK {
+            HapticScheduler::submit(3, 0, {1.0});
+        }
+        HapticScheduler::cancel(3);
+    }
+};
+
+QTEST_APPLESS_MAIN(HapticSchedulerTest)
+
+#include "Internal/HapticSchedulerTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
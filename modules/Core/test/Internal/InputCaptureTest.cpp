@@ -0,0 +1,76 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/InputCapture.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using Emulator::OpenVR::vrSystem;
+using Internal::InputCapture;
+using Record = InputCapture::Record;
+
+class InputCaptureTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+        vrSystem.getControllerState_data.unControllerDeviceIndex = 3;
+        vrSystem.getControllerState_data.unControllerStateSize = sizeof(vr::VRControllerState_t);
+        vrSystem.getControllerState_data.returns = true;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void drain_ChangedState_RecordsOnlyChanges() {
+        vr::VRControllerState_t state{};
+        state.unPacketNum = 1;
+        state.ulButtonPressed = vr::ButtonMaskFromId(vr::k_EButton_Grip);
+        state.rAxis[1].x = 0.5f;
+        vrSystem.getControllerState_data.pControllerState = state;
+        InputCapture capture{3, 2000, 64};
+        capture.start();
+        QVERIFY(capture.isRunning());
+        QVector<Record> records{};
+        QElapsedTimer timer{};
+        timer.start();
+        while (records.size() < 2 && timer.elapsed() < 5000) {
+            capture.drain(records);
+            QThread::msleep(1);
+        }
+        capture.stop();
+        QVERIFY(!capture.isRunning());
+        capture.drain(records);
+        // the unchanged packet must not produce further records
+        QCOMPARE(records.size(), 2);
+        QVERIFY(records.at(0).kind == Record::Kind::axis);
+        QCOMPARE(records.at(0).identifier, quint16{2});
+        QCOMPARE(records.at(0).value, 0.5f);
+        QVERIFY(records.at(1).kind == Record::Kind::press);
+        QCOMPARE(records.at(1).identifier, quint16{vr::k_EButton_Grip});
+        QCOMPARE(records.at(1).value, 1.0f);
+        QVERIFY(records.at(0).timestamp > 0);
+        QCOMPARE(capture.dropped(), quint64{0});
+    }
+};
+
+QTEST_APPLESS_MAIN(InputCaptureTest)
+
+#include "Internal/InputCaptureTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
@@ -0,0 +1,135 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <algorithm>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/LensMeshCache.hpp>
+
+using namespace CuteVR;
+using Components::Output::DistortionMesh;
+using Components::Output::HiddenAreaMesh;
+using Internal::LensMeshCache;
+
+class LensMeshCacheTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static bool shift(QVector2D const &position, DistortionMesh::Vertex &vertex) {
+        vertex.red = position * 0.9f;
+        vertex.green = position;
+        vertex.blue = position * 1.1f;
+        return true;
+    }
+
+private slots: // tests
+    void build_Resolution_SamplesRegularGrid() {
+        auto const mesh{LensMeshCache::build(QSize{3, 4}, &shift)};
+        QCOMPARE(mesh.resolution, QSize(3, 4));
+        QCOMPARE(mesh.vertices.size(), 12);
+        QVERIFY(mesh.vertices.first().position == QVector2D(0.0f, 0.0f));
+        QVERIFY(mesh.vertices.at(1).position == QVector2D(0.5f, 0.0f));
+        QVERIFY(mesh.vertices.last().position == QVector2D(1.0f, 1.0f));
+        QVERIFY(mesh.vertices.at(5).blue == mesh.vertices.at(5).position * 1.1f);
+        QCOMPARE(mesh.indices.size(), 2 * 3 * 6);
+        QCOMPARE(*std::max_element(mesh.indices.cbegin(), mesh.indices.cend()), quint16{11});
+    }
+
+    void build_ResolutionOutOfBounds_IsBounded() {
+        auto const mesh{LensMeshCache::build(QSize{1, 1000}, &shift)};
+        QCOMPARE(mesh.resolution, QSize(LensMeshCache::minimumResolution, LensMeshCache::maximumResolution));
+        QCOMPARE(*std::max_element(mesh.indices.cbegin(), mesh.indices.cend()),
+                 static_cast<quint16>(mesh.vertices.size() - 1));
+    }
+
+    void build_SampleFails_ReturnsEmptyMesh() {
+        auto const mesh{LensMeshCache::build(QSize{4, 4}, [](QVector2D const &position, DistortionMesh::Vertex &) {
+            return position.x() < 1.0f;
+        })};
+        QVERIFY(mesh.isEmpty());
+        QVERIFY(mesh.indices.isEmpty());
+    }
+
+    void compact_Triangles_SharesEqualVertices() {
+        QVector<QVector2D> const triangles{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f},
+                                           {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        auto const mesh{LensMeshCache::compact(triangles, HiddenAreaMesh::Type::standard)};
+        QCOMPARE(mesh.vertices.size(), 4);
+        QCOMPARE(mesh.indices, (QVector<quint16>{0, 1, 2, 1, 3, 2}));
+        for (auto index = 0; index < triangles.size(); index++) {
+            QVERIFY(mesh.vertices.at(mesh.indices.at(index)) == triangles.at(index));
+        }
+    }
+
+    void compact_NoVertices_ReturnsEmptyMesh() {
+        auto const mesh{LensMeshCache::compact({}, HiddenAreaMesh::Type::lineLoop)};
+        QVERIFY(mesh.isEmpty());
+        QVERIFY(mesh.type == HiddenAreaMesh::Type::lineLoop);
+    }
+
+    void stream_DistortionMesh_RoundTrips() {
+        auto const mesh{LensMeshCache::build(QSize{5, 3}, &shift)};
+        QByteArray buffer{};
+        QDataStream out{&buffer, QIODevice::WriteOnly};
+        out.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        out << mesh;
+        DistortionMesh copy{};
+        QDataStream in{buffer};
+        in.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        in >> copy;
+        QVERIFY(in.status() == QDataStream::Ok);
+        QVERIFY(copy == mesh);
+    }
+
+    void stream_TruncatedDistortionMesh_Fails() {
+        auto const mesh{LensMeshCache::build(QSize{5, 3}, &shift)};
+        QByteArray buffer{};
+        QDataStream out{&buffer, QIODevice::WriteOnly};
+        out << mesh;
+        buffer.chop(buffer.size() / 2);
+        DistortionMesh copy{};
+        QDataStream in{buffer};
+        in >> copy;
+        QVERIFY(in.status() != QDataStream::Ok);
+    }
+
+    void stream_BogusIndexCount_Fails() {
+        QByteArray buffer{};
+        QDataStream out{&buffer, QIODevice::WriteOnly};
+        out << QSize{2, 2} << quint32{0} << quint32{0xffffffffu} << quint16{0};
+        DistortionMesh copy{};
+        QDataStream in{buffer};
+        in >> copy;
+        QVERIFY(in.status() != QDataStream::Ok);
+        QCOMPARE(copy.indices.size(), 1);
+    }
+
+    void isConsistent_BuiltMesh_IsConsistent() {
+        auto const mesh{LensMeshCache::build(QSize{5, 3}, &shift)};
+        QVERIFY(LensMeshCache::isConsistent(mesh, QSize{5, 3}));
+        QVERIFY(!LensMeshCache::isConsistent(mesh, QSize{3, 5}));
+    }
+
+    void isConsistent_CorruptedIndices_IsInconsistent() {
+        auto const mesh{LensMeshCache::build(QSize{5, 3}, &shift)};
+        auto missing{mesh};
+        missing.indices.removeLast();
+        QVERIFY(!LensMeshCache::isConsistent(missing, QSize{5, 3}));
+        auto outOfRange{mesh};
+        outOfRange.indices[7] = static_cast<quint16>(mesh.vertices.size());
+        QVERIFY(!LensMeshCache::isConsistent(outOfRange, QSize{5, 3}));
+    }
+
+    void build_Resolution64_Benchmark() {
+        QBENCHMARK {
+            LensMeshCache::build(QSize{64, 64}, &shift);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(LensMeshCacheTest)
+
+#include "Internal/LensMeshCacheTest.moc"
@@ -0,0 +1,87 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/MpscQueue.hpp>
+
+using CuteVR::Internal::MpscQueue;
+
+class MpscQueueTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void pop_EmptyQueue_ReturnsFalse() {
+        MpscQueue<int> queue{4};
+        auto value{-1};
+        QVERIFY(!queue.pop(value));
+        QCOMPARE(value, -1);
+    }
+
+    void push_FullQueue_DropsNewest() {
+        MpscQueue<int> queue{2};
+        QVERIFY(queue.push(1));
+        QVERIFY(queue.push(2));
+        QVERIFY(!queue.push(3));
+        QCOMPARE(queue.dropped(), quint64{1});
+        auto value{0};
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, 1);
+        QVERIFY(queue.push(4));
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, 2);
+        QVERIFY(queue.pop(value));
+        QCOMPARE(value, 4);
+    }
+
+    void pop_ManyRounds_ReusesSlots() {
+        MpscQueue<int> queue{3};
+        auto value{0};
+        for (auto round = 0; round < 100; round++) {
+            QVERIFY(queue.isEmpty());
+            QVERIFY(queue.push(2 * round));
+            QVERIFY(queue.push(2 * round + 1));
+            QVERIFY(!queue.isEmpty());
+            QVERIFY(queue.pop(value));
+            QCOMPARE(value, 2 * round);
+            QVERIFY(queue.pop(value));
+            QCOMPARE(value, 2 * round + 1);
+        }
+        QCOMPARE(queue.dropped(), quint64{0});
+    }
+
+    void pop_ConcurrentProducers_KeepsOrderPerProducer() {
+        MpscQueue<QPair<int, int>> queue{1 << 20};
+        auto const producers{4}, count{20000};
+        QList<QFuture<void>> futures{};
+        for (auto producer = 0; producer < producers; producer++) {
+            futures.append(QtConcurrent::run([&queue, producer, count] {
+                for (auto value = 0; value < count; value++) {
+                    queue.push(qMakePair(producer, value));
+                }
+            }));
+        }
+        QVector<int> next(producers, 0);
+        auto taken{0};
+        QPair<int, int> pair{};
+        while (taken < producers * count) {
+            if (queue.pop(pair)) {
+                QCOMPARE(pair.second, next.at(pair.first));
+                next[pair.first]++;
+                taken++;
+            }
+        }
+        for (auto &future : futures) {
+            future.waitForFinished();
+        }
+        QCOMPARE(queue.dropped(), quint64{0});
+    }
+};
+
+QTEST_APPLESS_MAIN(MpscQueueTest)
+
+#include "Internal/MpscQueueTest.moc"
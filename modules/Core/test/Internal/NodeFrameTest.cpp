@@ -0,0 +1,81 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/NodeFrame.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Internal::NodeFrame;
+
+class NodeFrameTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static NodeFrame makeFrame(qint32 const count) {
+        NodeFrame frame{};
+        frame.node = 3;
+        frame.sequence = 42;
+        for (auto index = 0; index < count; index++) {
+            CompactPose pose{};
+            pose.position = {0.5f * index, 1.7f, -0.25f};
+            pose.orientation = QQuaternion::fromAxisAndAngle(0.0f, 1.0f, 0.0f, 10.0f * index);
+            pose.linearVelocity = {0.1f, 0.0f, 0.0f};
+            pose.angularVelocity = {0.0f, 0.0f, 0.2f};
+            pose.flags = CompactPose::isValid | CompactPose::hasLinearVelocity;
+            frame.entries.append(NodeFrame::Entry{static_cast<Identifier>(index), Device::Category::tracker, pose});
+        }
+        return frame;
+    }
+
+private slots: // tests
+    void decode_EncodedFrame_RoundTrips() {
+        auto const frame{makeFrame(4)};
+        auto const decoded{NodeFrame::decode(frame.encode())};
+        QVERIFY(decoded.hasValue());
+        QCOMPARE(decoded.value().node, frame.node);
+        QCOMPARE(decoded.value().sequence, frame.sequence);
+        QCOMPARE(decoded.value().entries.size(), frame.entries.size());
+        for (auto index = 0; index < frame.entries.size(); index++) {
+            QCOMPARE(decoded.value().entries[index].device, frame.entries[index].device);
+            QVERIFY(decoded.value().entries[index].category == frame.entries[index].category);
+            QVERIFY(decoded.value().entries[index].pose == frame.entries[index].pose);
+        }
+    }
+
+    void decode_EmptyFrame_RoundTrips() {
+        auto const decoded{NodeFrame::decode(makeFrame(0).encode())};
+        QVERIFY(decoded.hasValue());
+        QVERIFY(decoded.value().entries.isEmpty());
+    }
+
+    void decode_TruncatedDatagram_ReturnsNothing() {
+        auto const datagram{makeFrame(2).encode()};
+        QVERIFY(!NodeFrame::decode(datagram.left(datagram.size() - 1)).hasValue());
+        QVERIFY(!NodeFrame::decode(datagram + QByteArray{1, '\0'}).hasValue());
+        QVERIFY(!NodeFrame::decode({}).hasValue());
+    }
+
+    void decode_ForeignDatagram_ReturnsNothing() {
+        auto datagram{makeFrame(1).encode()};
+        datagram[0] = static_cast<char>(datagram[0] ^ 0x5a);
+        QVERIFY(!NodeFrame::decode(datagram).hasValue());
+        QVERIFY(!NodeFrame::decode(QByteArray{"not a frame of a node"}).hasValue());
+    }
+
+    void isNewer_WrappedSequence_IsNewer() {
+        QVERIFY(NodeFrame::isNewer(2, 1));
+        QVERIFY(!NodeFrame::isNewer(1, 2));
+        QVERIFY(!NodeFrame::isNewer(7, 7));
+        QVERIFY(NodeFrame::isNewer(3, 0xfffffffeu));
+        QVERIFY(!NodeFrame::isNewer(0xfffffffeu, 3));
+    }
+};
+
+QTEST_APPLESS_MAIN(NodeFrameTest)
+
+#include "Internal/NodeFrameTest.moc"
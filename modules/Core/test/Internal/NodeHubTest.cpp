@@ -0,0 +1,102 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Devices/Proxy.hpp>
+#include <CuteVR/Internal/NodeHub.hpp>
+#include <CuteVR/Internal/TestDevice.hpp>
+#include <CuteVR/Node.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Internal::NodeFrame;
+using Internal::NodeHub;
+using TestDevice = Internal::TestDevice<>;
+
+class NodeHubTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static QByteArray makeDatagram(Identifier const node, quint32 const sequence) {
+        NodeFrame frame{};
+        frame.node = node;
+        frame.sequence = sequence;
+        frame.entries.append(NodeFrame::Entry{1, Device::Category::tracker, {}});
+        return frame.encode();
+    }
+
+private slots: // tests
+    void accept_NewerFrame_ReplacesFrame() {
+        NodeHub hub{0};
+        QVERIFY(hub.accept(makeDatagram(1, 1), 0));
+        QVERIFY(hub.accept(makeDatagram(1, 3), 0));
+        QVERIFY(hub.accept(makeDatagram(2, 1), 0));
+        QCOMPARE(hub.frames().size(), 2);
+        QCOMPARE(hub.frames().value(1).sequence, quint32{3});
+        QCOMPARE(hub.dropped(), quint64{0});
+    }
+
+    void accept_StaleFrame_IsDropped() {
+        NodeHub hub{0};
+        QVERIFY(hub.accept(makeDatagram(1, 5), 0));
+        QVERIFY(!hub.accept(makeDatagram(1, 4), 0));
+        QVERIFY(!hub.accept(makeDatagram(1, 5), 0));
+        QCOMPARE(hub.frames().value(1).sequence, quint32{5});
+        QCOMPARE(hub.dropped(), quint64{2});
+    }
+
+    void accept_InvalidNode_IsDropped() {
+        NodeHub hub{0};
+        QVERIFY(!hub.accept(makeDatagram(0, 1), 0));
+        QVERIFY(!hub.accept(makeDatagram(0x10000, 1), 0));
+        QVERIFY(!hub.accept(QByteArray{"garbage"}, 0));
+        QVERIFY(hub.frames().isEmpty());
+        QCOMPARE(hub.dropped(), quint64{3});
+    }
+
+    void expire_SilentNode_IsForgotten() {
+        NodeHub hub{0};
+        hub.accept(makeDatagram(1, 1), 0);
+        hub.accept(makeDatagram(2, 1), 400);
+        QCOMPARE(hub.expire(500, 500), QList<Identifier>{});
+        QCOMPARE(hub.expire(600, 500), QList<Identifier>{1});
+        QCOMPARE(hub.frames().keys(), QList<Identifier>{2});
+        // a restarted node starts over with its sequence
+        QVERIFY(hub.accept(makeDatagram(1, 1), 600));
+    }
+
+    void receive_PublishedFrame_ArrivesOverLoopback() {
+        NodeHub hub{0};
+        if (hub.port() == 0) {
+            QSKIP("No UDP port available.");
+        }
+        QSharedPointer<TestDevice> tracker{new TestDevice{4}};
+        tracker->dummyCategory = Device::Category::tracker;
+        QSharedPointer<Device> proxy{new Devices::Proxy{Device::Category::controller, 2, 1}};
+        CompactPose pose{};
+        pose.position = {1.0f, 2.0f, 3.0f};
+        pose.flags = CompactPose::isValid;
+        Node node{7, QStringLiteral("127.0.0.1"), hub.port()};
+        QVERIFY(node.publish({{4, tracker}, {proxy->identifier, proxy}}, {{4, pose}}));
+        QCOMPARE(node.sequence(), quint32{1});
+        for (auto attempt = 0; attempt < 100 && hub.frames().isEmpty(); attempt++) {
+            QTest::qSleep(10);
+            hub.receive(0);
+        }
+        QCOMPARE(hub.frames().keys(), QList<Identifier>{7});
+        auto const frame{hub.frames().value(7)};
+        QCOMPARE(frame.sequence, quint32{1});
+        QCOMPARE(frame.entries.size(), 1);
+        QCOMPARE(frame.entries.first().device, Identifier{4});
+        QVERIFY(frame.entries.first().category == Device::Category::tracker);
+        QVERIFY(frame.entries.first().pose == pose);
+    }
+};
+
+QTEST_APPLESS_MAIN(NodeHubTest)
+
+#include "Internal/NodeHubTest.moc"
@@ -0,0 +1,120 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/Matrix4x4.hpp>
+#include <CuteVR/Internal/PoseBatch.hpp>
+#include <CuteVR/Internal/Vector3.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Internal::Matrix4x4::from;
+using Internal::PoseBatch::InstructionSet;
+using Internal::PoseBatch::matrixSize;
+using Internal::Vector3::from;
+
+class PoseBatchTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static void makePoses(vr::TrackedDevicePose_t *poses) {
+        for (auto index = 0u; index < vr::k_unMaxTrackedDeviceCount; index++) {
+            auto const value{static_cast<float>(index)};
+            QMatrix4x4 transform{};
+            transform.translate(value * 0.25f, -value, value * 3.0f);
+            transform.rotate(value * 7.5f, QVector3D{1.0f, value, -2.0f});
+            for (auto row = 0; row < 3; row++) {
+                for (auto column = 0; column < 4; column++) {
+                    poses[index].mDeviceToAbsoluteTracking.m[row][column] = transform(row, column);
+                }
+            }
+            poses[index].vVelocity = {{value, value * 0.5f, -value}};
+            poses[index].vAngularVelocity = {{-value, value * 2.0f, value / 3.0f}};
+        }
+    }
+
+private slots: // tests
+    void toMatrices_EveryInstructionSet_EqualsScalarConversion() {
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        makePoses(poses);
+        // an odd count covers the remainder of the paths that convert several poses at once
+        for (auto const count : {static_cast<qint32>(vr::k_unMaxTrackedDeviceCount), 7}) {
+            for (auto const set : {InstructionSet::scalar, InstructionSet::sse2, InstructionSet::avx2}) {
+                QVector<float> matrices(count * matrixSize, -1.0f);
+                Internal::PoseBatch::toMatrices(poses, count, matrices.data(), set);
+                for (auto index = 0; index < count; index++) {
+                    auto const expected{from(poses[index].mDeviceToAbsoluteTracking)};
+                    auto const actual{Internal::PoseBatch::matrix(matrices.constData() + index * matrixSize)};
+                    QVERIFY(actual == expected);
+                }
+            }
+        }
+    }
+
+    void toPacked_Poses_EqualsScalarConversion() {
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        makePoses(poses);
+        QVector<Internal::PoseBatch::Packed> packed(vr::k_unMaxTrackedDeviceCount);
+        Internal::PoseBatch::toPacked(poses, packed.size(), packed.data());
+        for (auto index = 0; index < packed.size(); index++) {
+            auto const transform{from(poses[index].mDeviceToAbsoluteTracking)};
+            auto const &entry{packed.at(index)};
+            QVERIFY(Internal::PoseBatch::position(entry) == transform.column(3).toVector3D());
+            QVERIFY(Internal::PoseBatch::orientation(entry) ==
+                    QQuaternion::fromRotationMatrix(transform.toGenericMatrix<3, 3>()));
+            QVERIFY((QVector3D{entry.linearVelocity[0], entry.linearVelocity[1], entry.linearVelocity[2]}) ==
+                    from(poses[index].vVelocity));
+            QVERIFY((QVector3D{entry.angularVelocity[0], entry.angularVelocity[1], entry.angularVelocity[2]}) ==
+                    from(poses[index].vAngularVelocity));
+        }
+    }
+
+    void supported_Always_IsUsableByToMatrices() {
+        vr::TrackedDevicePose_t pose{};
+        pose.mDeviceToAbsoluteTracking.m[0][3] = 1.0f;
+        float matrix[matrixSize]{};
+        Internal::PoseBatch::toMatrices(&pose, 1, matrix, Internal::PoseBatch::supported());
+        QCOMPARE(matrix[12], 1.0f);
+        QCOMPARE(matrix[15], 1.0f);
+    }
+
+    void from_AllDevices_Benchmark() {
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        makePoses(poses);
+        QVector<QMatrix4x4> matrices(vr::k_unMaxTrackedDeviceCount);
+        QBENCHMARK {
+            for (auto index = 0; index < matrices.size(); index++) {
+                matrices[index] = from(poses[index].mDeviceToAbsoluteTracking);
+            }
+        }
+    }
+
+    void toMatrices_AllDevices_Benchmark() {
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        makePoses(poses);
+        QVector<float> matrices(vr::k_unMaxTrackedDeviceCount * matrixSize);
+        QBENCHMARK {
+            Internal::PoseBatch::toMatrices(poses, vr::k_unMaxTrackedDeviceCount, matrices.data());
+        }
+    }
+
+    void toPacked_AllDevices_Benchmark() {
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        makePoses(poses);
+        QVector<Internal::PoseBatch::Packed> packed(vr::k_unMaxTrackedDeviceCount);
+        QBENCHMARK {
+            Internal::PoseBatch::toPacked(poses, packed.size(), packed.data());
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(PoseBatchTest)
+
+#include "Internal/PoseBatchTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
@@ -0,0 +1,152 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/Property.hpp>
+#include <CuteVR/Internal/PropertyCache.hpp>
+
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::feature;
+using Emulator::OpenVR::vrSystem;
+using Internal::PropertyCache;
+using Internal::Property::query;
+
+class PropertyCacheTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        DriverServer::instance().initialize();
+    }
+
+    void init() {
+        PropertyCache::clear();
+        PropertyCache::resetStatistics();
+    }
+
+    void query_RepeatedSuccess_HitsCache() {
+        if (!PropertyCache::isEnabled()) {
+            QSKIP("The property cache is disabled.");
+        }
+        vrSystem.getFloatTrackedDeviceProperty_data.unDeviceIndex = 3;
+        vrSystem.getFloatTrackedDeviceProperty_data.prop = vr::Prop_DisplayFrequency_Float;
+        vrSystem.getFloatTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getFloatTrackedDeviceProperty_data.returns = 90.0f;
+        QVERIFY(query<float>(3, vr::Prop_DisplayFrequency_Float, nullptr) == 90.0f);
+        vrSystem.getFloatTrackedDeviceProperty_data.returns = 120.0f;
+        vr::ETrackedPropertyError error{vr::TrackedProp_UnknownProperty};
+        QVERIFY(query<float>(3, vr::Prop_DisplayFrequency_Float, &error) == 90.0f);
+        QVERIFY(error == vr::TrackedProp_Success);
+        QCOMPARE(PropertyCache::misses(), quint64{1});
+        QCOMPARE(PropertyCache::hits(), quint64{1});
+    }
+
+    void query_PreparedError_IsNotCached() {
+        if (!PropertyCache::isEnabled()) {
+            QSKIP("The property cache is disabled.");
+        }
+        vrSystem.getInt32TrackedDeviceProperty_data.unDeviceIndex = 3;
+        vrSystem.getInt32TrackedDeviceProperty_data.prop = vr::Prop_NumCameras_Int32;
+        vrSystem.getInt32TrackedDeviceProperty_data.pError = vr::TrackedProp_NotYetAvailable;
+        vrSystem.getInt32TrackedDeviceProperty_data.returns = 0;
+        vr::ETrackedPropertyError error{};
+        query<qint32>(3, vr::Prop_NumCameras_Int32, &error);
+        query<qint32>(3, vr::Prop_NumCameras_Int32, &error);
+        QVERIFY(error == vr::TrackedProp_NotYetAvailable);
+        QCOMPARE(PropertyCache::misses(), quint64{2});
+        QCOMPARE(PropertyCache::hits(), quint64{0});
+    }
+
+    void observe_PropertyChanged_InvalidatesProperty() {
+        if (!PropertyCache::isEnabled()) {
+            QSKIP("The property cache is disabled.");
+        }
+        vrSystem.getStringTrackedDeviceProperty_data.unDeviceIndex = 3;
+        vrSystem.getStringTrackedDeviceProperty_data.prop = vr::Prop_ModelNumber_String;
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "old\0";
+        vrSystem.getStringTrackedDeviceProperty_data.unBufferSize = 4;
+        vrSystem.getStringTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getStringTrackedDeviceProperty_data.returns = 4;
+        QCOMPARE(query<QString>(3, vr::Prop_ModelNumber_String, nullptr), QString{"old"});
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "new\0";
+        QCOMPARE(query<QString>(3, vr::Prop_ModelNumber_String, nullptr), QString{"old"});
+        vr::VREvent_t vrEvent{};
+        vrEvent.eventType = vr::VREvent_PropertyChanged;
+        vrEvent.trackedDeviceIndex = 3;
+        vrEvent.data.property.prop = vr::Prop_ModelNumber_String;
+        PropertyCache::observe(&vrEvent);
+        QCOMPARE(query<QString>(3, vr::Prop_ModelNumber_String, nullptr), QString{"new"});
+        QCOMPARE(PropertyCache::misses(), quint64{2});
+        QCOMPARE(PropertyCache::hits(), quint64{1});
+    }
+
+    void store_InvalidatedDuringFetch_DropsValue() {
+        if (!PropertyCache::isEnabled()) {
+            QSKIP("The property cache is disabled.");
+        }
+        // the generation is read before the fetch, whose value is outdated by the change event in between
+        auto const generation{PropertyCache::generation(3, vr::Prop_DisplayFrequency_Float)};
+        vr::VREvent_t vrEvent{};
+        vrEvent.eventType = vr::VREvent_PropertyChanged;
+        vrEvent.trackedDeviceIndex = 3;
+        vrEvent.data.property.prop = vr::Prop_DisplayFrequency_Float;
+        PropertyCache::observe(&vrEvent);
+        QVERIFY(!PropertyCache::store(3, vr::Prop_DisplayFrequency_Float, 90.0f, generation));
+        auto value{0.0f};
+        QVERIFY(!PropertyCache::lookup(3, vr::Prop_DisplayFrequency_Float, value));
+        QVERIFY(PropertyCache::store(3, vr::Prop_DisplayFrequency_Float, 120.0f,
+                                     PropertyCache::generation(3, vr::Prop_DisplayFrequency_Float)));
+        QVERIFY(PropertyCache::lookup(3, vr::Prop_DisplayFrequency_Float, value));
+        QVERIFY(value == 120.0f);
+    }
+
+    void observe_DeviceDeactivated_ClearsDevice() {
+        if (!PropertyCache::isEnabled()) {
+            QSKIP("The property cache is disabled.");
+        }
+        vrSystem.getBoolTrackedDeviceProperty_data.unDeviceIndex = 4;
+        vrSystem.getBoolTrackedDeviceProperty_data.prop = vr::Prop_NeverTracked_Bool;
+        vrSystem.getBoolTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getBoolTrackedDeviceProperty_data.returns = true;
+        QVERIFY(query<bool>(4, vr::Prop_NeverTracked_Bool, nullptr));
+        vr::VREvent_t vrEvent{};
+        vrEvent.eventType = vr::VREvent_TrackedDeviceDeactivated;
+        vrEvent.trackedDeviceIndex = 4;
+        PropertyCache::observe(&vrEvent);
+        vrSystem.getBoolTrackedDeviceProperty_data.returns = false;
+        QVERIFY(!query<bool>(4, vr::Prop_NeverTracked_Bool, nullptr));
+        QCOMPARE(PropertyCache::misses(), quint64{2});
+    }
+
+    void query_CachedString_Benchmark() {
+        vrSystem.getStringTrackedDeviceProperty_data.unDeviceIndex = 3;
+        vrSystem.getStringTrackedDeviceProperty_data.prop = vr::Prop_SerialNumber_String;
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "LHR-00000000\0";
+        vrSystem.getStringTrackedDeviceProperty_data.unBufferSize = 13;
+        vrSystem.getStringTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getStringTrackedDeviceProperty_data.returns = 13;
+        QString serial{};
+        QBENCHMARK {
+            serial = query<QString>(3, vr::Prop_SerialNumber_String, nullptr);
+        }
+        QCOMPARE(serial, QString{"LHR-00000000"});
+    }
+};
+
+QTEST_APPLESS_MAIN(PropertyCacheTest)
+
+#include "Internal/PropertyCacheTest.moc"
+
+#endif // CUTE_VR_OPEN_VR
@@ -0,0 +1,118 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/ProviderRegistry.hpp>
+
+using namespace CuteVR;
+using Internal::ProviderRegistry;
+
+/*! @private */
+class CountingProvider {
+public: // constructor
+    CountingProvider(Identifier const, std::function<void(qint32 const &)> callback) :
+            callback{std::move(callback)} {
+        constructions++;
+    }
+
+public: // variables
+    static qint32 constructions;
+    std::function<void(qint32 const &)> callback;
+};
+
+qint32 CountingProvider::constructions{0};
+
+/*! @private */
+class NestingProvider {
+public: // constructor
+    NestingProvider(Identifier const device, std::function<void(qint32 const &)> callback) :
+            subscription{ProviderRegistry::subscribe<CountingProvider, qint32>(device, std::move(callback), {})} {}
+
+public: // variables
+    QSharedPointer<ProviderRegistry::Subscription> subscription;
+};
+
+class ProviderRegistryTest :
+        public QObject {
+Q_OBJECT
+
+private: // methods
+    static QSharedPointer<ProviderRegistry::Subscription>
+    subscribe(Identifier const device, QList<qint32> &values, QSharedPointer<CountingProvider> *announced = nullptr) {
+        return ProviderRegistry::subscribe<CountingProvider, qint32>(device, [&values](qint32 const &value) {
+            values.append(value);
+        }, [announced](QSharedPointer<CountingProvider> const &provider) {
+            if (announced) {
+                *announced = provider;
+            }
+        });
+    }
+
+private slots: // tests
+    void init() {
+        CountingProvider::constructions = 0;
+    }
+
+    void subscribe_SameDevice_FansOutOneProvider() {
+        QList<qint32> first{}, second{};
+        QSharedPointer<CountingProvider> provider{};
+        auto const firstSubscription{subscribe(3, first, &provider)};
+        auto const secondSubscription{subscribe(3, second)};
+        QCOMPARE(CountingProvider::constructions, 1);
+        QCOMPARE(ProviderRegistry::providers(), 1);
+        QVERIFY(!provider.isNull());
+        provider->callback(42);
+        QCOMPARE(first, (QList<qint32>{42}));
+        QCOMPARE(second, (QList<qint32>{42}));
+    }
+
+    void subscribe_OtherDevice_CreatesOwnProvider() {
+        QList<qint32> first{}, second{};
+        auto const firstSubscription{subscribe(3, first)};
+        auto const secondSubscription{subscribe(4, second)};
+        QCOMPARE(CountingProvider::constructions, 2);
+        QCOMPARE(ProviderRegistry::providers(), 2);
+    }
+
+    void subscribe_LateSubscriber_ReceivesLastValue() {
+        QList<qint32> first{}, second{};
+        QSharedPointer<CountingProvider> provider{};
+        auto const firstSubscription{subscribe(3, first, &provider)};
+        provider->callback(7);
+        auto const secondSubscription{subscribe(3, second)};
+        QCOMPARE(second, (QList<qint32>{7}));
+    }
+
+    void subscribe_ProviderSubscribesWhileCreated_DoesNotBlock() {
+        QList<qint32> values{};
+        auto const subscription{ProviderRegistry::subscribe<NestingProvider, qint32>(5, [&values](qint32 const &value) {
+            values.append(value);
+        }, {})};
+        QCOMPARE(CountingProvider::constructions, 1);
+        QCOMPARE(ProviderRegistry::providers(), 2);
+    }
+
+    void subscription_LastReleased_DestroysProvider() {
+        QList<qint32> first{}, second{};
+        QSharedPointer<CountingProvider> provider{};
+        auto firstSubscription{subscribe(3, first, &provider)};
+        auto secondSubscription{subscribe(3, second)};
+        QWeakPointer<CountingProvider> const weak{provider};
+        provider.clear();
+        firstSubscription.clear();
+        QVERIFY(!weak.isNull());
+        weak.toStrongRef()->callback(1);
+        QVERIFY(first.isEmpty());
+        QCOMPARE(second, (QList<qint32>{1}));
+        secondSubscription.clear();
+        QVERIFY(weak.isNull());
+        QCOMPARE(ProviderRegistry::providers(), 0);
+    }
+};
+
+QTEST_APPLESS_MAIN(ProviderRegistryTest)
+
+#include "Internal/ProviderRegistryTest.moc"
@@ -34,6 +34,19 @@ private slots: // tests
         QVERIFY(qQuaternion.y() == quaternion.y);
         QVERIFY(qQuaternion.z() == quaternion.z);
     }
+
+    void from_HmdMatrix34Given_ReturnsItsRotation() {
+        auto const expected{QQuaternion::fromAxisAndAngle(0.0f, 0.0f, 1.0f, 90.0f)};
+        auto const rotation{expected.toRotationMatrix()};
+        vr::HmdMatrix34_t matrix{};
+        for (auto row = 0; row < 3; row++) {
+            for (auto column = 0; column < 3; column++) {
+                matrix.m[row][column] = rotation(row, column);
+            }
+            matrix.m[row][3] = 5.0f;
+        }
+        QVERIFY(qFuzzyCompare(from(matrix), expected));
+    }
 };
 
 QTEST_APPLESS_MAIN(QuaternionTest)
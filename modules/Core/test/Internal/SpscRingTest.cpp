@@ -0,0 +1,71 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/SpscRing.hpp>
+
+using CuteVR::Internal::SpscRing;
+
+class SpscRingTest :
+        public QObject {
+Q_OBJECT
+
+private slots: // tests
+    void capacity_Depth_RoundsUpToPowerOfTwo() {
+        QCOMPARE(SpscRing<int>{0}.capacity(), 1u);
+        QCOMPARE(SpscRing<int>{5}.capacity(), 8u);
+        QCOMPARE(SpscRing<int>{64}.capacity(), 64u);
+    }
+
+    void push_FullRing_DropsNewest() {
+        SpscRing<int> ring{4};
+        for (auto value = 0; value < 6; value++) {
+            QCOMPARE(ring.push(value), value < 4);
+        }
+        QCOMPARE(ring.dropped(), quint64{2});
+        QVector<int> values{};
+        QCOMPARE(ring.drain(values), 4);
+        QCOMPARE(values, (QVector<int>{0, 1, 2, 3}));
+        QVERIFY(ring.push(6));
+    }
+
+    void drain_Maximum_KeepsRemaining() {
+        SpscRing<int> ring{8};
+        for (auto value = 0; value < 5; value++) {
+            ring.push(value);
+        }
+        QVector<int> values{};
+        QCOMPARE(ring.drain(values, 2), 2);
+        QCOMPARE(ring.drain(values), 3);
+        QCOMPARE(values, (QVector<int>{0, 1, 2, 3, 4}));
+        QCOMPARE(ring.drain(values), 0);
+    }
+
+    void drain_ConcurrentProducer_KeepsOrder() {
+        SpscRing<int> ring{64};
+        auto const count{100000};
+        auto producer{QtConcurrent::run([&ring, count] {
+            for (auto value = 0; value < count;) {
+                if (ring.push(value)) {
+                    value++;
+                }
+            }
+        })};
+        QVector<int> values{};
+        while (values.size() < count) {
+            ring.drain(values);
+        }
+        producer.waitForFinished();
+        for (auto index = 0; index < count; index++) {
+            QCOMPARE(values.at(index), index);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(SpscRingTest)
+
+#include "Internal/SpscRingTest.moc"
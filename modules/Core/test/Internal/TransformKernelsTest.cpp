@@ -0,0 +1,249 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <random>
+#include <QtGui/QMatrix4x4>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Internal/TransformKernels.hpp>
+
+using namespace CuteVR;
+using Internal::TransformKernels::InstructionSet;
+using Internal::TransformKernels::Rigid;
+
+namespace TransformKernels = Internal::TransformKernels;
+
+Q_DECLARE_METATYPE(CuteVR::Internal::Simd::InstructionSet)
+
+class TransformKernelsTest :
+        public QObject {
+Q_OBJECT
+
+private: // constants
+    // an odd count covers the remainder that is left over by the vectorized path
+    static constexpr qint32 count{67};
+    static constexpr float tolerance{1.0e-5f};
+
+private: // methods
+    static bool isClose(float const left, float const right) {
+        return qAbs(left - right) <= tolerance;
+    }
+
+    static bool isClose(QQuaternion const &left, QQuaternion const &right) {
+        return isClose(left.scalar(), right.scalar()) && isClose(left.x(), right.x()) && isClose(left.y(), right.y()) &&
+               isClose(left.z(), right.z());
+    }
+
+    static bool isClose(QVector3D const &left, QVector3D const &right) {
+        return isClose(left.x(), right.x()) && isClose(left.y(), right.y()) && isClose(left.z(), right.z());
+    }
+
+    static QVector<QQuaternion> makeRotations(quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> distribution{-1.0f, 1.0f};
+        QVector<QQuaternion> rotations{};
+        for (auto index = 0; index < count; index++) {
+            rotations.append(QQuaternion{distribution(generator), distribution(generator), distribution(generator),
+                                         distribution(generator)}.normalized());
+        }
+        return rotations;
+    }
+
+    static QVector<QVector3D> makeVectors(quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> distribution{-2.0f, 2.0f};
+        QVector<QVector3D> vectors{};
+        for (auto index = 0; index < count; index++) {
+            vectors.append(QVector3D{distribution(generator), distribution(generator), distribution(generator)});
+        }
+        return vectors;
+    }
+
+    static QVector<float> makeWeights() {
+        QVector<float> weights{};
+        for (auto index = 0; index < count; index++) {
+            // the first and the last weights lie outside of the unit interval
+            weights.append(static_cast<float>(index - 1) / static_cast<float>(count - 3));
+        }
+        return weights;
+    }
+
+    static QVector<Rigid> makeRigids(quint32 const seed) {
+        auto const rotations{makeRotations(seed)};
+        auto const translations{makeVectors(seed + 1)};
+        QVector<Rigid> rigids(count);
+        for (auto index = 0; index < count; index++) {
+            rigids[index].rotation = rotations.at(index);
+            rigids[index].translation = translations.at(index);
+        }
+        return rigids;
+    }
+
+private slots: // tests
+    void initTestCase_data() {
+        QTest::addColumn<InstructionSet>("set");
+        QTest::newRow("Scalar") << InstructionSet::scalar;
+        QTest::newRow("SSE2") << InstructionSet::sse2;
+        QTest::newRow("AVX2") << InstructionSet::avx2;
+    }
+
+    void nlerp_Quaternions_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const from{makeRotations(1)}, to{makeRotations(2)};
+        auto const weights{makeWeights()};
+        QVector<QQuaternion> result(count);
+        TransformKernels::nlerp(from.constData(), to.constData(), weights.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), QQuaternion::nlerp(from.at(index), to.at(index), weights.at(index))));
+        }
+    }
+
+    void slerp_Quaternions_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const from{makeRotations(3)}, to{makeRotations(4)};
+        auto const weights{makeWeights()};
+        QVector<QQuaternion> result(count);
+        TransformKernels::slerp(from.constData(), to.constData(), weights.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), QQuaternion::slerp(from.at(index), to.at(index), weights.at(index))));
+        }
+    }
+
+    void multiply_Quaternions_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const left{makeRotations(5)}, right{makeRotations(6)};
+        QVector<QQuaternion> result(count);
+        TransformKernels::multiply(left.constData(), right.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), left.at(index) * right.at(index)));
+        }
+    }
+
+    void multiply_InPlace_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const left{makeRotations(7)}, right{makeRotations(8)};
+        auto result{left};
+        auto *const data{result.data()};
+        TransformKernels::multiply(data, right.constData(), data, count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), left.at(index) * right.at(index)));
+        }
+    }
+
+    void rotate_Vectors_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const rotations{makeRotations(9)};
+        auto const vectors{makeVectors(10)};
+        QVector<QVector3D> result(count);
+        TransformKernels::rotate(rotations.constData(), vectors.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), rotations.at(index).rotatedVector(vectors.at(index))));
+        }
+    }
+
+    void fromMatrices_RotationMatrices_MatchesQt() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const rotations{makeRotations(11)};
+        QVector<float> matrices{};
+        QVector<QQuaternion> expected{};
+        for (auto const &rotation : rotations) {
+            QMatrix4x4 matrix{rotation.toRotationMatrix()};
+            matrix.setColumn(3, QVector4D{1.0f, 2.0f, 3.0f, 1.0f});
+            for (auto value = 0; value < 16; value++) {
+                matrices.append(matrix.constData()[value]);
+            }
+            expected.append(QQuaternion::fromRotationMatrix(matrix.toGenericMatrix<3, 3>()));
+        }
+        QVector<QQuaternion> result(count);
+        TransformKernels::fromMatrices(matrices.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QVERIFY(isClose(result.at(index), expected.at(index)));
+        }
+    }
+
+    void compose_RigidTransforms_MatchesQMatrix4x4() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const left{makeRigids(12)}, right{makeRigids(14)};
+        auto const points{makeVectors(16)};
+        QVector<Rigid> result(count);
+        TransformKernels::compose(left.constData(), right.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            QMatrix4x4 leftMatrix{}, rightMatrix{};
+            leftMatrix.translate(left.at(index).translation);
+            leftMatrix.rotate(left.at(index).rotation);
+            rightMatrix.translate(right.at(index).translation);
+            rightMatrix.rotate(right.at(index).rotation);
+            auto const &composed{result.at(index)};
+            auto const point{points.at(index)};
+            QVERIFY(isClose(composed.rotation.rotatedVector(point) + composed.translation,
+                            (leftMatrix * rightMatrix).map(point)));
+        }
+    }
+
+    void invert_RigidTransforms_RestoresPoints() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const rigids{makeRigids(17)};
+        auto const points{makeVectors(19)};
+        QVector<Rigid> result(count);
+        TransformKernels::invert(rigids.constData(), result.data(), count, set);
+        for (auto index = 0; index < count; index++) {
+            auto const &rigid{rigids.at(index)};
+            auto const &inverse{result.at(index)};
+            auto const moved{rigid.rotation.rotatedVector(points.at(index)) + rigid.translation};
+            QVERIFY(isClose(inverse.rotation.rotatedVector(moved) + inverse.translation, points.at(index)));
+        }
+    }
+
+    void multiply_AllDevices_Benchmark() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const left{makeRotations(20)}, right{makeRotations(21)};
+        QVector<QQuaternion> result(count);
+        QBENCHMARK {
+            TransformKernels::multiply(left.constData(), right.constData(), result.data(), count, set);
+        }
+    }
+
+    void slerp_AllDevices_Benchmark() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const from{makeRotations(22)}, to{makeRotations(23)};
+        auto const weights{makeWeights()};
+        QVector<QQuaternion> result(count);
+        QBENCHMARK {
+            TransformKernels::slerp(from.constData(), to.constData(), weights.constData(), result.data(), count, set);
+        }
+    }
+
+    void compose_AllDevices_Benchmark() {
+        QFETCH_GLOBAL(InstructionSet, set);
+        auto const left{makeRigids(24)}, right{makeRigids(26)};
+        QVector<Rigid> result(count);
+        QBENCHMARK {
+            TransformKernels::compose(left.constData(), right.constData(), result.data(), count, set);
+        }
+    }
+
+    void compose_QMatrix4x4_Benchmark() {
+        auto const left{makeRigids(24)}, right{makeRigids(26)};
+        QVector<QMatrix4x4> leftMatrices(count), rightMatrices(count), result(count);
+        for (auto index = 0; index < count; index++) {
+            leftMatrices[index].translate(left.at(index).translation);
+            leftMatrices[index].rotate(left.at(index).rotation);
+            rightMatrices[index].translate(right.at(index).translation);
+            rightMatrices[index].rotate(right.at(index).rotation);
+        }
+        QBENCHMARK {
+            for (auto index = 0; index < count; index++) {
+                result[index] = leftMatrices.at(index) * rightMatrices.at(index);
+            }
+        }
+    }
+};
+
+constexpr qint32 TransformKernelsTest::count;
+constexpr float TransformKernelsTest::tolerance;
+
+QTEST_APPLESS_MAIN(TransformKernelsTest)
+
+#include "Internal/TransformKernelsTest.moc"
@@ -0,0 +1,39 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <QtCore/QObject>
+
+#include <CuteVR/Internal/TestDevice.hpp>
+#include <CuteVR/Interface/DevicePlugin.hpp>
+#include <CuteVR/DeviceServer.hpp>
+
+using namespace CuteVR;
+using TestDevice = Internal::TestDevice<>;
+
+/// @private
+/// @brief Provides a device for the signatures of its manifest, which is used to test the loading on demand.
+class TestDevicePlugin :
+        public QObject,
+        public Interface::DevicePlugin {
+Q_OBJECT
+    Q_PLUGIN_METADATA(IID CUTE_VR_DEVICE_PLUGIN_IID FILE "TestDevicePlugin.json")
+    Q_INTERFACES(CuteVR::Interface::DevicePlugin)
+
+public: // constants
+    static constexpr Device::Category category{static_cast<Device::Category>(101)};
+
+public: // methods
+    void registerDevices() override {
+        DeviceServer::registerDevice([](Identifier const identifier) {
+            QSharedPointer<TestDevice> device{new TestDevice{identifier}};
+            device->dummyCategory = category;
+            return device.staticCast<Device>();
+        }, QStringList{"Emulated_Emulated_Emulated", "Emulated_Emulated_2"});
+    }
+};
+
+constexpr Device::Category TestDevicePlugin::category;
+
+#include "Plugins/TestDevicePlugin.moc"
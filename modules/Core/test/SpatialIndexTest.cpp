@@ -0,0 +1,288 @@
+/// @file
+/// @author Marcus Meeßen
+/// @copyright Copyright (c) 2017-2018 Marcus Meeßen
+/// @copyright Copyright (c) 2018      MASKOR Institute FH Aachen
+
+#include <random>
+#include <QtTest/QtTest>
+
+#include <CuteVR/Components/Geometry/Cone.hpp>
+#include <CuteVR/Components/Geometry/Cuboid.hpp>
+#include <CuteVR/Components/Geometry/Cylinder.hpp>
+#include <CuteVR/Components/Geometry/Ellipsoid.hpp>
+#include <CuteVR/Components/Geometry/Pyramid.hpp>
+#include <CuteVR/Components/Geometry/Sphere.hpp>
+#include <CuteVR/SpatialIndex.hpp>
+
+using namespace CuteVR;
+using Components::CompactPose;
+using Components::Geometry::Cone;
+using Components::Geometry::Cuboid;
+using Components::Geometry::Cylinder;
+using Components::Geometry::Ellipsoid;
+using Components::Geometry::Pyramid;
+using Components::Geometry::Sphere;
+using Interface::Volumetric;
+
+class SpatialIndexTest :
+        public QObject {
+Q_OBJECT
+
+private: // types
+    struct Zone {
+        SpatialIndex::Geometry geometry{};
+        QMatrix4x4 transform{};
+    };
+
+private: // methods
+    /// zones of all supported geometries that are scattered across a room of 20 x 3 x 20 meters
+    static QMap<Identifier, Zone> makeZones(qint32 const count, quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> size{0.05f, 0.5f};
+        std::uniform_real_distribution<float> unit{-1.0f, 1.0f};
+        QMap<Identifier, Zone> zones{};
+        for (auto index = 0; index < count; index++) {
+            Zone zone{};
+            switch (index % 6) {
+                case 0: {
+                    QSharedPointer<Cuboid> cuboid{new Cuboid{}};
+                    cuboid->a = size(generator);
+                    cuboid->b = size(generator);
+                    cuboid->c = size(generator);
+                    zone.geometry = cuboid;
+                    break;
+                }
+                case 1: {
+                    QSharedPointer<Sphere> sphere{new Sphere{}};
+                    sphere->r = size(generator);
+                    zone.geometry = sphere;
+                    break;
+                }
+                case 2: {
+                    QSharedPointer<Cylinder> cylinder{new Cylinder{}};
+                    cylinder->r = size(generator);
+                    cylinder->h = size(generator);
+                    zone.geometry = cylinder;
+                    break;
+                }
+                case 3: {
+                    QSharedPointer<Cone> cone{new Cone{}};
+                    cone->r = size(generator);
+                    cone->h = size(generator);
+                    zone.geometry = cone;
+                    break;
+                }
+                case 4: {
+                    QSharedPointer<Ellipsoid> ellipsoid{new Ellipsoid{}};
+                    ellipsoid->a = size(generator);
+                    ellipsoid->b = size(generator);
+                    ellipsoid->c = size(generator);
+                    zone.geometry = ellipsoid;
+                    break;
+                }
+                default: {
+                    QSharedPointer<Pyramid> pyramid{new Pyramid{}};
+                    pyramid->a = size(generator);
+                    pyramid->b = size(generator);
+                    pyramid->c = size(generator);
+                    zone.geometry = pyramid;
+                    break;
+                }
+            }
+            zone.transform.translate(10.0f * unit(generator), 1.5f + 1.5f * unit(generator), 10.0f * unit(generator));
+            zone.transform.rotate(180.0f * unit(generator), QVector3D{unit(generator), unit(generator), 1.0f});
+            zones.insert(static_cast<Identifier>(index), zone);
+        }
+        return zones;
+    }
+
+    static QVector<SpatialIndex::Ray> makeRays(qint32 const count, quint32 const seed) {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> unit{-1.0f, 1.0f};
+        QVector<SpatialIndex::Ray> rays{};
+        for (auto index = 0; index < count; index++) {
+            QVector3D const origin{10.0f * unit(generator), 1.5f + 1.5f * unit(generator), 10.0f * unit(generator)};
+            QVector3D const direction{unit(generator), 0.25f * unit(generator), unit(generator)};
+            rays.append(SpatialIndex::Ray{origin, direction.normalized()});
+        }
+        return rays;
+    }
+
+    static QVector<QVector3D> makePoints(qint32 const count, quint32 const seed) {
+        QVector<QVector3D> points{};
+        for (auto const &ray : makeRays(count, seed)) {
+            points.append(ray.origin);
+        }
+        return points;
+    }
+
+    static void insertAll(SpatialIndex &index, QMap<Identifier, Zone> const &zones) {
+        for (auto iterator = zones.cbegin(); iterator != zones.cend(); ++iterator) {
+            index.insert(iterator.key(), iterator->geometry, iterator->transform);
+        }
+        index.update();
+    }
+
+    static Volumetric const *volume(Zone const &zone) {
+        return dynamic_cast<Volumetric const *>(zone.geometry.data());
+    }
+
+private slots: // tests
+    void insert_UnsupportedGeometry_ReturnsFalse() {
+        SpatialIndex index{};
+        QVERIFY(!index.insert(1, {}, {}));
+        QVERIFY(index.isCurrent());
+    }
+
+    void update_InsertedZones_BecomeVisible() {
+        SpatialIndex index{};
+        QSharedPointer<Sphere> sphere{new Sphere{}};
+        sphere->r = 1.0;
+        QVERIFY(index.insert(1, sphere, {}));
+        QVERIFY(!index.isCurrent());
+        QCOMPARE(index.size(), 0);
+        QCOMPARE(index.rayCast({SpatialIndex::Ray{{0.0f, 0.0f, 5.0f}, {0.0f, 0.0f, -1.0f}}}).first().zone,
+                 invalidIdentifier);
+        index.update();
+        QVERIFY(index.isCurrent());
+        QCOMPARE(index.size(), 1);
+        auto const hit{index.rayCast({SpatialIndex::Ray{{0.0f, 0.0f, 5.0f}, {0.0f, 0.0f, -1.0f}}}).first()};
+        QCOMPARE(hit.zone, Identifier{1});
+        QCOMPARE(hit.distance, 4.0);
+    }
+
+    void move_Zone_IsRefitted() {
+        SpatialIndex index{};
+        insertAll(index, makeZones(64, 1));
+        QSharedPointer<Sphere> sphere{new Sphere{}};
+        sphere->r = 0.5;
+        QMatrix4x4 transform{};
+        transform.translate(0.0f, 10.0f, 0.0f);
+        index.insert(100, sphere, transform);
+        index.update();
+        QVERIFY(!index.move(101, transform));
+        transform.translate(5.0f, 0.0f, 0.0f);
+        QVERIFY(index.move(100, transform));
+        QCOMPARE(index.nearest({{0.0f, 10.0f, 0.0f}}).first().zone, Identifier{100});
+        index.update();
+        auto const hit{index.nearest({{5.0f, 10.0f, 0.0f}}).first()};
+        QCOMPARE(hit.zone, Identifier{100});
+        QCOMPARE(hit.distance, -0.5);
+        QVERIFY(index.overlap({{0.0f, 10.0f, 0.0f}}).first().isEmpty());
+    }
+
+    void remove_Zone_IsNoLongerFound() {
+        SpatialIndex index{};
+        QSharedPointer<Sphere> sphere{new Sphere{}};
+        sphere->r = 1.0;
+        index.insert(1, sphere, {});
+        index.insert(2, sphere, {});
+        index.update();
+        QCOMPARE(index.overlap({{0.0f, 0.0f, 0.0f}}).first(), (QList<Identifier>{1, 2}));
+        QVERIFY(index.remove(1));
+        QVERIFY(!index.remove(1));
+        index.update();
+        QCOMPARE(index.size(), 1);
+        QCOMPARE(index.overlap({{0.0f, 0.0f, 0.0f}}).first(), QList<Identifier>{2});
+    }
+
+    void rayCast_RandomRays_MatchesBruteForce() {
+        SpatialIndex index{};
+        auto const zones{makeZones(512, 2)};
+        insertAll(index, zones);
+        auto const rays{makeRays(128, 3)};
+        auto const hits{index.rayCast(rays)};
+        for (auto ray = 0; ray < rays.size(); ray++) {
+            SpatialIndex::Hit expected{};
+            for (auto iterator = zones.cbegin(); iterator != zones.cend(); ++iterator) {
+                auto const toZone{iterator->transform.inverted()};
+                auto const distance{volume(*iterator)->intersect(toZone.map(rays.at(ray).origin),
+                                                                 toZone.mapVector(rays.at(ray).direction))};
+                if (distance < expected.distance) {
+                    expected = SpatialIndex::Hit{iterator.key(), distance};
+                }
+            }
+            QCOMPARE(hits.at(ray).zone, expected.zone);
+        }
+    }
+
+    void nearest_RandomPoints_MatchesBruteForce() {
+        SpatialIndex index{};
+        auto const zones{makeZones(512, 4)};
+        insertAll(index, zones);
+        auto const points{makePoints(128, 5)};
+        auto const hits{index.nearest(points)};
+        auto const bounded{index.nearest(points, 0.25)};
+        for (auto point = 0; point < points.size(); point++) {
+            SpatialIndex::Hit expected{};
+            for (auto iterator = zones.cbegin(); iterator != zones.cend(); ++iterator) {
+                auto const distance{volume(*iterator)->distance(iterator->transform.inverted().map(points.at(point)))};
+                if (distance < expected.distance) {
+                    expected = SpatialIndex::Hit{iterator.key(), distance};
+                }
+            }
+            QCOMPARE(hits.at(point).zone, expected.zone);
+            QCOMPARE(bounded.at(point).zone, expected.distance < 0.25 ? expected.zone : invalidIdentifier);
+        }
+    }
+
+    void overlap_RandomPoints_MatchesBruteForce() {
+        SpatialIndex index{};
+        auto const zones{makeZones(512, 6)};
+        insertAll(index, zones);
+        auto const points{makePoints(128, 7)};
+        auto const overlaps{index.overlap(points, 0.5)};
+        for (auto point = 0; point < points.size(); point++) {
+            QList<Identifier> expected{};
+            for (auto iterator = zones.cbegin(); iterator != zones.cend(); ++iterator) {
+                if (volume(*iterator)->distance(iterator->transform.inverted().map(points.at(point))) <= 0.5) {
+                    expected.append(iterator.key());
+                }
+            }
+            QCOMPARE(overlaps.at(point), expected);
+        }
+    }
+
+    void ray_Pose_PointsAlongNegativeZ() {
+        CompactPose pose{};
+        pose.position = {1.0f, 2.0f, 3.0f};
+        pose.orientation = QQuaternion::fromAxisAndAngle(0.0f, 1.0f, 0.0f, 90.0f);
+        auto const ray{SpatialIndex::ray(pose)};
+        QVERIFY(ray.origin == pose.position);
+        QVERIFY((ray.direction - QVector3D{-1.0f, 0.0f, 0.0f}).length() < 1.0e-6f);
+    }
+
+    void rayCast_ThousandsOfZones_Benchmark() {
+        SpatialIndex index{};
+        insertAll(index, makeZones(4096, 8));
+        auto const rays{makeRays(64, 9)};
+        QBENCHMARK {
+            index.rayCast(rays);
+        }
+    }
+
+    void nearest_ThousandsOfZones_Benchmark() {
+        SpatialIndex index{};
+        insertAll(index, makeZones(4096, 10));
+        auto const points{makePoints(64, 11)};
+        QBENCHMARK {
+            index.nearest(points);
+        }
+    }
+
+    void update_ThousandsOfMovedZones_Benchmark() {
+        SpatialIndex index{};
+        auto const zones{makeZones(4096, 12)};
+        insertAll(index, zones);
+        QBENCHMARK {
+            for (auto iterator = zones.cbegin(); iterator != zones.cend(); ++iterator) {
+                index.move(iterator.key(), iterator->transform);
+            }
+            index.update();
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(SpatialIndexTest)
+
+#include "SpatialIndexTest.moc"
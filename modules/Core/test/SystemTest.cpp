@@ -5,16 +5,235 @@
 
 #include <QtTest/QtTest>
 
+#include <CuteVR/Configurations/Core.hpp>
+#include <CuteVR/Devices/Proxy.hpp>
+#include <CuteVR/Emulator/OpenVR.hpp>
+#include <CuteVR/Internal/TestDevice.hpp>
+#include <CuteVR/Node.hpp>
 #include <CuteVR/System.hpp>
 
+#ifdef CUTE_VR_OPEN_VR
+
+using namespace CuteVR;
+using Configurations::Core::Feature;
+using Configurations::Core::Parameter;
+using Configurations::feature;
+using Configurations::parameter;
+using Emulator::OpenVR::anyDevice;
+using Emulator::OpenVR::anyProperty;
+using Emulator::OpenVR::vrSystem;
+using TestDevice = Internal::TestDevice<>;
+
 /*! @private */
 class SystemTest :
         public QObject {
 Q_OBJECT
 
+private: // methods
+    static bool isClose(QVector3D const &left, QVector3D const &right) {
+        return (left - right).length() <= 1.0e-4f;
+    }
+
 private slots: // tests
+    void initTestCase() {
+        Emulator::OpenVR::invoke();
+        vr::init_data.eApplicationType = vr::VRApplication_Background;
+        ConfigurationServer::disable(feature(Feature::cell));
+        ConfigurationServer::disable(feature(Feature::eventTracking));
+        DriverServer::instance().initialize();
+        // every slot holds a generic tracker
+        vrSystem.isTrackedDeviceConnected_data.unDeviceIndex = anyDevice;
+        vrSystem.isTrackedDeviceConnected_data.returns = true;
+        vrSystem.getTrackedDeviceClass_data.unDeviceIndex = anyDevice;
+        vrSystem.getTrackedDeviceClass_data.returns = vr::TrackedDeviceClass_GenericTracker;
+        vrSystem.getStringTrackedDeviceProperty_data.unDeviceIndex = anyDevice;
+        vrSystem.getStringTrackedDeviceProperty_data.prop = anyProperty;
+        vrSystem.getStringTrackedDeviceProperty_data.pchValue = "Emulated\0";
+        vrSystem.getStringTrackedDeviceProperty_data.unBufferSize = 9;
+        vrSystem.getStringTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getStringTrackedDeviceProperty_data.returns = 9;
+        vrSystem.getBoolTrackedDeviceProperty_data.unDeviceIndex = anyDevice;
+        vrSystem.getBoolTrackedDeviceProperty_data.prop = anyProperty;
+        vrSystem.getBoolTrackedDeviceProperty_data.pError = vr::TrackedProp_Success;
+        vrSystem.getBoolTrackedDeviceProperty_data.returns = false;
+    }
+
+    void cleanupTestCase() {
+        DriverServer::instance().destroy();
+    }
+
+    void initialize_AllDevicesConnected_PublishesOnce() {
+        System system{};
+        QSignalSpy devicesSpy{&system, &System::devicesChanged};
+        QSignalSpy deviceSpy{&system, &System::deviceChanged};
+        system.initialize();
+        QVERIFY(system.isInitialized());
+        QCOMPARE(devicesSpy.count(), 1);
+        QCOMPARE(deviceSpy.count(), static_cast<qint32>(vr::k_unMaxTrackedDeviceCount));
+        system.update();
+        QCOMPARE(system.devices.size(), static_cast<qint32>(vr::k_unMaxTrackedDeviceCount));
+        for (auto const &device : system.devices) {
+            QVERIFY(device->category() == Device::Category::tracker);
+            QCOMPARE(device->thread(), system.thread());
+        }
+        system.destroy();
+    }
+
+    void pollEvents_HotplugBurst_AppliesOneDelta() {
+        ConfigurationServer::setValue(parameter(Parameter::hotplugWindow), {20});
+        System system{};
+        system.initialize();
+        QSignalSpy devicesSpy{&system, &System::devicesChanged};
+        QSignalSpy hotplugSpy{&system, &System::devicesHotplugged};
+        QList<QPair<Identifier, vr::EVREventType>> const hotplugs{
+                {3, vr::VREvent_TrackedDeviceDeactivated},
+                {5, vr::VREvent_TrackedDeviceDeactivated},
+                {3, vr::VREvent_TrackedDeviceActivated},
+        };
+        for (auto const &hotplug : hotplugs) {
+            vr::VREvent_t vrEvent{};
+            vrEvent.eventType = hotplug.second;
+            vrEvent.trackedDeviceIndex = hotplug.first;
+            vrSystem.pollNextEvent_data.queued.push(vrEvent);
+        }
+        DriverServer::pollEvents();
+        QTRY_COMPARE_WITH_TIMEOUT(hotplugSpy.count(), 1, 5000);
+        auto const delta{hotplugSpy.at(0).at(0).value<System::Delta>()};
+        QCOMPARE(delta.removed, (QList<Identifier>{3, 5}));
+        QCOMPARE(delta.added, (QList<Identifier>{3}));
+        QCOMPARE(devicesSpy.count(), 1);
+        system.update();
+        QCOMPARE(system.devices.size(), static_cast<qint32>(vr::k_unMaxTrackedDeviceCount) - 1);
+        QVERIFY(!system.devices.contains(5));
+        system.destroy();
+        ConfigurationServer::resetValue(parameter(Parameter::hotplugWindow));
+    }
+
+    void pollEvents_Reconnect_RevivesParkedDevice() {
+        ConfigurationServer::enable(feature(Feature::devicePool));
+        ConfigurationServer::setValue(parameter(Parameter::hotplugWindow), {0});
+        System system{};
+        system.initialize();
+        system.update();
+        auto const parked{system.devices.value(7)};
+        QVERIFY(!parked.isNull());
+        QSignalSpy hotplugSpy{&system, &System::devicesHotplugged};
+        for (auto const eventType : {vr::VREvent_TrackedDeviceDeactivated, vr::VREvent_TrackedDeviceActivated}) {
+            vr::VREvent_t vrEvent{};
+            vrEvent.eventType = eventType;
+            vrEvent.trackedDeviceIndex = 7;
+            vrSystem.pollNextEvent_data.queued.push(vrEvent);
+            DriverServer::pollEvents();
+            auto const expected{hotplugSpy.count() + 1};
+            QTRY_COMPARE_WITH_TIMEOUT(hotplugSpy.count(), expected, 5000);
+        }
+        system.update();
+        QCOMPARE(system.devices.value(7), parked);
+        QVERIFY(parked->isInitialized());
+        QCOMPARE(parked->thread(), system.thread());
+        system.destroy();
+        ConfigurationServer::resetValue(parameter(Parameter::hotplugWindow));
+        ConfigurationServer::reset(feature(Feature::devicePool));
+    }
+
+    void update_GlobalTransform_ReachesGlobalPoses() {
+        if (ConfigurationServer::enable(feature(Feature::cell)).hasValue()) {
+            QSKIP("The cell feature is bound by the profile.");
+        }
+        vr::HmdMatrix34_t identity{};
+        identity.m[0][0] = identity.m[1][1] = identity.m[2][2] = 1.0f;
+        vrSystem.getRawZeroPoseToStandingAbsoluteTrackingPose_data.returns = identity;
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount]{};
+        for (auto &pose : poses) {
+            pose.mDeviceToAbsoluteTracking = identity;
+            pose.mDeviceToAbsoluteTracking.m[0][3] = 0.5f;
+            pose.mDeviceToAbsoluteTracking.m[1][3] = 1.5f;
+            pose.bPoseIsValid = true;
+            pose.bDeviceIsConnected = true;
+        }
+        vrSystem.getDeviceToAbsoluteTrackingPose_data.eOrigin = vr::TrackingUniverseRawAndUncalibrated;
+        vrSystem.getDeviceToAbsoluteTrackingPose_data.pTrackedDevicePoseArray = poses;
+        vrSystem.getDeviceToAbsoluteTrackingPose_data.unTrackedDevicePoseArrayCount = vr::k_unMaxTrackedDeviceCount;
+        System system{};
+        system.initialize();
+        QMatrix4x4 transform{};
+        transform.translate(3.0f, 0.0f, 0.0f);
+        system.setGlobalTransform(0, transform);
+        // the first update hands the transform over to the tracking, which applies it to the next frame
+        system.update();
+        QCOMPARE(system.cells.value(0).globalTransform, transform);
+        DriverServer::pollTracking();
+        system.update();
+        QVERIFY(system.cellPoses.contains(2));
+        QVERIFY(isClose(system.cellPoses.value(2).position, QVector3D{0.5f, 1.5f, 0.0f}));
+        QVERIFY(isClose(system.globalPoses.value(2).position, QVector3D{3.5f, 1.5f, 0.0f}));
+        system.destroy();
+        vrSystem.getDeviceToAbsoluteTrackingPose_data = {};
+        ConfigurationServer::disable(feature(Feature::cell));
+    }
+
+    void update_NodesWithGlobalTransforms_LandApart() {
+        if (ConfigurationServer::enable(feature(Feature::cell)).hasValue() ||
+            ConfigurationServer::enable(feature(Feature::nodeAggregation)).hasValue()) {
+            QSKIP("The cell or node aggregation feature is not available.");
+        }
+        // any free port is taken, the nodes are then told where the system listens
+        ConfigurationServer::setValue(parameter(Parameter::nodePort), {0});
+        System system{};
+        system.initialize();
+        if (system.nodePort() == 0) {
+            QSKIP("No UDP port available.");
+        }
+        QMatrix4x4 left{};
+        left.translate(-10.0f, 0.0f, 0.0f);
+        QMatrix4x4 right{};
+        right.translate(10.0f, 0.0f, 0.0f);
+        right.rotate(180.0f, 0.0f, 1.0f, 0.0f);
+        // the calibrations are registered before the nodes show up
+        system.setGlobalTransform(1, left);
+        system.setGlobalTransform(2, right);
+        QSharedPointer<Device> tracker{new TestDevice{4}};
+        static_cast<TestDevice *>(tracker.data())->dummyCategory = Device::Category::tracker;
+        Components::CompactPose pose{};
+        pose.position = {0.5f, 1.5f, 0.0f};
+        pose.flags = Components::CompactPose::isValid;
+        Node first{1, QStringLiteral("127.0.0.1"), system.nodePort()};
+        Node second{2, QStringLiteral("127.0.0.1"), system.nodePort()};
+        auto const firstProxy{Devices::Proxy::identifierOf(1, 4)};
+        auto const secondProxy{Devices::Proxy::identifierOf(2, 4)};
+        // datagrams may get lost, hence both nodes keep publishing until the system has received them
+        auto const received{[&] {
+            first.publish({{4, tracker}}, {{4, pose}});
+            second.publish({{4, tracker}}, {{4, pose}});
+            system.update();
+            return system.globalPoses.contains(firstProxy) && system.globalPoses.contains(secondProxy);
+        }};
+        QTRY_VERIFY_WITH_TIMEOUT(received(), 5000);
+        QCOMPARE(system.cell(firstProxy).value(), Identifier{1});
+        QCOMPARE(system.cell(secondProxy).value(), Identifier{2});
+        QVERIFY(isClose(system.cellPoses.value(firstProxy).position, pose.position));
+        QVERIFY(isClose(system.cellPoses.value(secondProxy).position, pose.position));
+        QVERIFY(isClose(system.globalPoses.value(firstProxy).position, QVector3D{-9.5f, 1.5f, 0.0f}));
+        QVERIFY(isClose(system.globalPoses.value(secondProxy).position, QVector3D{9.5f, 1.5f, 0.0f}));
+        system.destroy();
+        system.update();
+        QVERIFY(!system.devices.contains(firstProxy));
+        ConfigurationServer::resetValue(parameter(Parameter::nodePort));
+        ConfigurationServer::disable(feature(Feature::nodeAggregation));
+        ConfigurationServer::disable(feature(Feature::cell));
+    }
+
+    void initialize_AllDevicesConnected_Benchmark() {
+        QBENCHMARK {
+            System system{};
+            system.initialize();
+            system.destroy();
+        }
+    }
 };
 
 QTEST_APPLESS_MAIN(SystemTest)
 
 #include "SystemTest.moc"
+
+#endif // CUTE_VR_OPEN_VR